@@ -3,21 +3,23 @@
 #include <cstddef>
 
 #include <iosfwd>
-#include <optional>
+#include <span>
 #include <vector>
 
+#include "bit_matrix.hpp"
 #include "vertex_identifier.hpp"
 
 namespace g {
 /*!
  * \brief An implementation type for the `Graph` type, implementing an
  *        adjacency matrix.
+ *
+ * Stores one bit per cell in a single `BitMatrix`, so that enumerating the
+ * targets of a vertex scans whole words and skips empty ones.
  **/
 class AdjacencyMatrix {
 public:
-  using this_type       = AdjacencyMatrix;
-  using reference       = std::vector<bool>::reference;
-  using const_reference = std::vector<bool>::const_reference;
+  using this_type = AdjacencyMatrix;
 
   /*!
    * \brief Prints an `AdjacencyMatrix` to an ostream.
@@ -42,6 +44,23 @@ public:
   bool isDirectlyReachable(VertexIdentifier source, VertexIdentifier target)
     const;
 
+  /*!
+   * \brief Views the row of `source`.
+   * \param source The source vertex.
+   * \return The words of the row of `source`, bit i of which is set if
+   *         vertex i is directly reachable from `source`. Empty if `source`
+   *         has no row.
+   * \note Invalidated by any modification.
+   **/
+  std::span<const BitMatrix::word_type> row(VertexIdentifier source) const;
+
+  /*!
+   * \brief Returns the underlying bit matrix.
+   * \return The bit matrix, where the bit at row i and column j is set if
+   *         vertex j is directly reachable from vertex i.
+   **/
+  const BitMatrix& adjacency() const noexcept;
+
   /*!
    * \brief Sets `target` to be directly reachable from `source`.
    * \param source The source vertex.
@@ -94,25 +113,6 @@ private:
    **/
   std::size_t columnCount() const;
 
-  /*!
-   * \brief Returns the cell at `row` and `column`.
-   * \param row The row.
-   * \param column The column.
-   * \return An optional containing a reference proxy object to the cell value,
-   *         or nullopt if there is no cell at `row` and `column`.
-   **/
-  std::optional<reference> fetch(std::size_t row, std::size_t column);
-
-  /*!
-   * \brief Returns the boolean value at `row` and `column`.
-   * \param row The row.
-   * \param column The column.
-   * \return An optional containing the boolean value, or nullopt of there is
-   *         no cell at `row` and `column`.
-   **/
-  std::optional<const_reference> fetch(std::size_t row, std::size_t column)
-    const;
-
   /*!
    * \brief Resizes this adjacency matrix to be able to hold a cell value at
    *        `source` and `target` if necessary.
@@ -126,7 +126,7 @@ private:
    *
    * Represents the matrix.
    **/
-  std::vector<std::vector<bool>> m_data;
+  BitMatrix m_data;
 };
 
 /*!
@@ -17,9 +17,15 @@ template<
   typename Implementation,
   typename VertexData,
   typename IsGoal,
-  typename Heuristic>
+  typename Heuristic,
+  typename Maps>
 [[nodiscard]] Path algorithm(
-  const Graph<TheDirectionality, Implementation, VertexData, std::int64_t>&
+  const Graph<
+    TheDirectionality,
+    Implementation,
+    VertexData,
+    std::int64_t,
+    Maps>&
                                        graph,
   const std::vector<VertexIdentifier>& startVertices,
   IsGoal                               isGoal,
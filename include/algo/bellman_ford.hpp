@@ -15,9 +15,17 @@
 #include "vertex_identifier.hpp"
 
 namespace g::algo {
-template<Directionality TheDirectionality, typename Implementation>
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename Maps>
 ShortestPaths bellmanFord(
-  const Graph<TheDirectionality, Implementation, std::nullptr_t, std::int64_t>&
+  const Graph<
+    TheDirectionality,
+    Implementation,
+    std::nullptr_t,
+    std::int64_t,
+    Maps>&
                    graph,
   VertexIdentifier source)
 {
@@ -0,0 +1,78 @@
+#ifndef INCG_G_ALGO_BOYKOV_KOLMOGOROV_ALGORITHM_HPP
+#define INCG_G_ALGO_BOYKOV_KOLMOGOROV_ALGORITHM_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <iosfwd>
+#include <vector>
+
+#include "algo/boykov_kolmogorov/grid_graph.hpp"
+
+namespace g::algo::boykov_kolmogorov {
+/*!
+ * \brief The side of the minimum cut that a pixel is on.
+ **/
+enum class Segment : std::uint8_t {
+  Source, /*!< The pixel is reachable from the source in the residual graph */
+  Sink    /*!< The pixel is not reachable from the source */
+};
+
+/*!
+ * \brief Prints a `Segment` enumerator.
+ * \param os The ostream to print to.
+ * \param segment The `Segment` enumerator to print.
+ * \return `os`.
+ **/
+std::ostream& operator<<(std::ostream& os, Segment segment);
+
+/*!
+ * \brief The maximum flow of a `GridGraph` and the minimum cut labeling of
+ *        its pixels.
+ **/
+class Result {
+public:
+  /*!
+   * \brief Creates a `Result`.
+   * \param maxFlow The value of the maximum flow.
+   * \param width The width of the image.
+   * \param segments The segment of every pixel in row major order.
+   **/
+  Result(
+    std::int64_t         maxFlow,
+    std::size_t          width,
+    std::vector<Segment> segments);
+
+  [[nodiscard]] std::int64_t maxFlow() const;
+
+  /*!
+   * \brief Returns the segment of a pixel.
+   * \param x The column of the pixel.
+   * \param y The row of the pixel.
+   * \return The segment of the pixel.
+   **/
+  [[nodiscard]] Segment segmentOf(std::size_t x, std::size_t y) const;
+
+  /*!
+   * \brief Read accessor for the segments of all pixels.
+   * \return The segment of every pixel in row major order.
+   **/
+  [[nodiscard]] const std::vector<Segment>& segments() const;
+
+private:
+  std::int64_t         m_maxFlow;
+  std::size_t          m_width;
+  std::vector<Segment> m_segments;
+};
+
+/*!
+ * \brief Computes a maximum flow and a minimum cut of a `GridGraph` with the
+ *        Boykov-Kolmogorov algorithm.
+ * \param graph The graph. Its residual capacities are consumed.
+ * \return The maximum flow and the segment of every pixel.
+ * \note Search trees are grown from both terminals and kept across
+ *       augmentations; pixels cut off by an augmentation are adopted by
+ *       another node of their tree when possible.
+ **/
+[[nodiscard]] Result algorithm(GridGraph graph);
+} // namespace g::algo::boykov_kolmogorov
+#endif // INCG_G_ALGO_BOYKOV_KOLMOGOROV_ALGORITHM_HPP
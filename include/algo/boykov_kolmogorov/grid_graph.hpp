@@ -0,0 +1,187 @@
+#ifndef INCG_G_ALGO_BOYKOV_KOLMOGOROV_GRID_GRAPH_HPP
+#define INCG_G_ALGO_BOYKOV_KOLMOGOROV_GRID_GRAPH_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <iosfwd>
+#include <vector>
+
+namespace g::algo::boykov_kolmogorov {
+/*!
+ * \brief The neighborhood of a pixel.
+ **/
+enum class Connectivity {
+  Four, /*!< The horizontal and vertical neighbors. */
+  Eight /*!< The horizontal, vertical and diagonal neighbors. */
+};
+
+/*!
+ * \brief The neighbors of a pixel, in clockwise order. y grows downwards.
+ **/
+enum class Neighbor : std::uint8_t {
+  East,
+  SouthEast,
+  South,
+  SouthWest,
+  West,
+  NorthWest,
+  North,
+  NorthEast
+};
+
+/*!
+ * \brief Prints a `Connectivity` enumerator.
+ * \param os The ostream to print to.
+ * \param connectivity The `Connectivity` enumerator to print.
+ * \return `os`.
+ **/
+std::ostream& operator<<(std::ostream& os, Connectivity connectivity);
+
+/*!
+ * \brief Prints a `Neighbor` enumerator.
+ * \param os The ostream to print to.
+ * \param neighbor The `Neighbor` enumerator to print.
+ * \return `os`.
+ **/
+std::ostream& operator<<(std::ostream& os, Neighbor neighbor);
+
+/*!
+ * \brief A flow network whose vertices are the pixels of an image.
+ *
+ * Every pixel has an edge to each of its neighbors and may be connected to
+ * the source and the sink terminal. The neighbors are implicit; only the
+ * residual capacities are stored, one slot per pixel and neighbor. The
+ * image is surrounded by a border of pixels without capacities, so that
+ * every pixel of the image has all of its neighbors.
+ **/
+class GridGraph {
+public:
+  /*!
+   * \brief Creates a `GridGraph` without capacities.
+   * \param width The width of the image in pixels.
+   * \param height The height of the image in pixels.
+   * \param connectivity The neighborhood of the pixels.
+   **/
+  GridGraph(std::size_t width, std::size_t height, Connectivity connectivity);
+
+  [[nodiscard]] std::size_t width() const;
+
+  [[nodiscard]] std::size_t height() const;
+
+  [[nodiscard]] Connectivity connectivity() const;
+
+  /*!
+   * \brief Sets the capacity of the edge from a pixel to one of its
+   *        neighbors.
+   * \param x The column of the pixel.
+   * \param y The row of the pixel.
+   * \param neighbor The neighbor.
+   * \param capacity The capacity.
+   * \throws GraphException if the pixel or its neighbor is outside of the
+   *                        image, `neighbor` is diagonal with 4-connectivity
+   *                        or `capacity` is negative.
+   **/
+  void setEdgeCapacity(
+    std::size_t  x,
+    std::size_t  y,
+    Neighbor     neighbor,
+    std::int32_t capacity);
+
+  /*!
+   * \brief Adds capacity to the edges from the source terminal to a pixel
+   *        and from the pixel to the sink terminal.
+   * \param x The column of the pixel.
+   * \param y The row of the pixel.
+   * \param source The capacity to add to the edge from the source.
+   * \param sink The capacity to add to the edge to the sink.
+   * \throws GraphException if the pixel is outside of the image or a
+   *                        capacity is negative.
+   * \note Only the difference of both capacities is stored, the flow that
+   *       both terminal edges can carry right away is accounted for in
+   *       `constantFlow()`.
+   **/
+  void addTerminalCapacities(
+    std::size_t  x,
+    std::size_t  y,
+    std::int64_t source,
+    std::int64_t sink);
+
+  /*!
+   * \brief Returns the count of neighbor slots per pixel.
+   * \return 4 or 8 depending on the connectivity.
+   **/
+  [[nodiscard]] std::size_t slotCount() const;
+
+  /*!
+   * \brief Returns the index of a pixel in the padded storage.
+   * \param x The column of the pixel.
+   * \param y The row of the pixel.
+   * \return The index of the pixel.
+   **/
+  [[nodiscard]] std::size_t pixelAt(std::size_t x, std::size_t y) const;
+
+  /*!
+   * \brief Returns the count of pixels in the padded storage.
+   * \return The count of pixels including the border.
+   **/
+  [[nodiscard]] std::size_t paddedPixelCount() const;
+
+  /*!
+   * \brief Returns the index difference between a pixel and the neighbor
+   *        in `slot`.
+   * \param slot The neighbor slot.
+   * \return The offset to add to a pixel index.
+   **/
+  [[nodiscard]] std::ptrdiff_t slotOffset(std::size_t slot) const
+  {
+    return m_slotOffset[slot];
+  }
+
+  /*!
+   * \brief Returns the slot leading back from the neighbor in `slot`.
+   * \param slot The neighbor slot.
+   * \return The reverse slot.
+   **/
+  [[nodiscard]] std::size_t reverseSlot(std::size_t slot) const
+  {
+    return (slot + m_slotCount / 2) % m_slotCount;
+  }
+
+  /*!
+   * \brief Read / write accessor for the residual capacities of the edges
+   *        between pixels, indexed by pixel * slotCount() + slot.
+   * \return The residual capacities.
+   **/
+  [[nodiscard]] std::vector<std::int32_t>& residuals();
+
+  /*!
+   * \brief Read / write accessor for the residual terminal capacity of every
+   *        pixel. Positive values lead from the source to the pixel,
+   *        negative values from the pixel to the sink.
+   * \return The residual terminal capacities.
+   **/
+  [[nodiscard]] std::vector<std::int64_t>& terminals();
+
+  /*!
+   * \brief Returns the flow sent directly from the source through a pixel to
+   *        the sink.
+   * \return The constant flow.
+   **/
+  [[nodiscard]] std::int64_t constantFlow() const;
+
+private:
+  [[nodiscard]] std::size_t slotOf(Neighbor neighbor) const;
+
+  void checkPixel(std::size_t x, std::size_t y) const;
+
+  std::size_t                 m_width;
+  std::size_t                 m_height;
+  Connectivity                m_connectivity;
+  std::size_t                 m_slotCount;
+  std::vector<std::ptrdiff_t> m_slotOffset;
+  std::vector<std::int32_t>   m_residuals;
+  std::vector<std::int64_t>   m_terminals;
+  std::int64_t                m_constantFlow;
+};
+} // namespace g::algo::boykov_kolmogorov
+#endif // INCG_G_ALGO_BOYKOV_KOLMOGOROV_GRID_GRAPH_HPP
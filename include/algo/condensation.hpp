@@ -0,0 +1,85 @@
+#ifndef INCG_G_ALGO_CONDENSATION_HPP
+#define INCG_G_ALGO_CONDENSATION_HPP
+#include <cstddef>
+
+#include <vector>
+
+#include "algo/indexed_adjacency.hpp"
+
+namespace g::algo {
+/*!
+ * \brief The strongly connected components of a graph and the acyclic graph
+ *        between them in compressed sparse row form.
+ *
+ * Components are found with Tarjan's algorithm, which numbers them in
+ * reverse topological order: every arc leads from a component to one with
+ * a smaller number. There is at most one arc between two components and
+ * none from a component to itself. The arc functions have the same names as
+ * those of `IndexedAdjacency`, so that a `Traversal` can search the
+ * components.
+ **/
+class Condensation {
+public:
+  /*!
+   * \brief Condenses `adjacency`.
+   * \param adjacency The graph.
+   **/
+  explicit Condensation(const IndexedAdjacency& adjacency);
+
+  [[nodiscard]] std::size_t componentCount() const;
+
+  [[nodiscard]] std::size_t arcCount() const;
+
+  /*!
+   * \brief Fetches the component of a vertex.
+   * \param vertex The dense index of the vertex.
+   * \return The component of `vertex`.
+   **/
+  [[nodiscard]] std::size_t componentOf(std::size_t vertex) const
+  {
+    return m_componentOf[vertex];
+  }
+
+  /*!
+   * \brief Read accessor for the component of every vertex.
+   * \return The component of every vertex by dense index.
+   **/
+  [[nodiscard]] const std::vector<std::size_t>& componentsOf() const;
+
+  /*!
+   * \brief Returns the first arc leaving `component`.
+   * \param component The component.
+   * \return The first arc leaving `component`.
+   **/
+  [[nodiscard]] std::size_t firstArc(std::size_t component) const
+  {
+    return m_firstArc[component];
+  }
+
+  /*!
+   * \brief Returns one past the last arc leaving `component`.
+   * \param component The component.
+   * \return One past the last arc leaving `component`.
+   **/
+  [[nodiscard]] std::size_t lastArc(std::size_t component) const
+  {
+    return m_firstArc[component + 1];
+  }
+
+  /*!
+   * \brief Returns the component that `arc` leads to.
+   * \param arc The arc.
+   * \return The target of `arc`, a smaller number than its source.
+   **/
+  [[nodiscard]] std::size_t target(std::size_t arc) const
+  {
+    return m_target[arc];
+  }
+
+private:
+  std::vector<std::size_t> m_componentOf;
+  std::vector<std::size_t> m_firstArc; /*!< CSR offsets, componentCount() + 1 */
+  std::vector<std::size_t> m_target;
+};
+} // namespace g::algo
+#endif // INCG_G_ALGO_CONDENSATION_HPP
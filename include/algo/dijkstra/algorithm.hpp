@@ -8,84 +8,116 @@
 #include <unordered_map>
 #include <vector>
 
+#include "algo/dijkstra/dense.hpp"
 #include "algo/dijkstra/insert.hpp"
 #include "algo/dijkstra/vertex_with_priority.hpp"
 #include "algo/shortest_paths.hpp"
 #include "assert.hpp"
 #include "directionality.hpp"
 #include "graph.hpp"
+#include "graph_exception.hpp"
+#include "throw.hpp"
 
 namespace g::algo::dijkstra {
+/*!
+ * \brief Runs Dijkstra's algorithm.
+ * \param graph The graph. The edge weights must not be negative.
+ * \param source The source vertex.
+ * \return The shortest paths from `source`.
+ * \throws GraphException if an edge leaving a vertex reachable from `source`
+ *                        has a negative weight, whatever the implementation.
+ * \note Runs `denseAlgorithm` for every `MatrixAdjacency` implementation.
+ *       A vertex whose shortest path is longer than INT64_MAX - 1 is treated
+ *       as unreachable, whatever the implementation.
+ **/
 template<
   Directionality TheDirectionality,
   typename Implementation,
-  typename VertexData>
+  typename VertexData,
+  typename Maps>
 [[nodiscard]] ShortestPaths algorithm(
-  const Graph<TheDirectionality, Implementation, VertexData, std::int64_t>&
+  const Graph<
+    TheDirectionality,
+    Implementation,
+    VertexData,
+    std::int64_t,
+    Maps>&
                    graph,
   VertexIdentifier source)
 {
-  constexpr std::int64_t                infinity{INT64_MAX};
-  const std::optional<VertexIdentifier> undefined{std::nullopt};
+  if constexpr (MatrixAdjacency<Implementation>) {
+    return denseAlgorithm(graph, source);
+  }
+  else {
+    constexpr std::int64_t                infinity{INT64_MAX};
+    const std::optional<VertexIdentifier> undefined{std::nullopt};
 
-  std::unordered_map<VertexIdentifier, std::optional<VertexIdentifier>> prev{};
-  std::unordered_map<VertexIdentifier, std::int64_t>                    dist{};
-  std::deque<VertexWithPriority>                                        queue{};
-  const std::vector<VertexIdentifier> vertices{graph.vertices()};
+    std::unordered_map<VertexIdentifier, std::optional<VertexIdentifier>>
+                                                       prev{};
+    std::unordered_map<VertexIdentifier, std::int64_t> dist{};
+    std::deque<VertexWithPriority>                     queue{};
+    const std::vector<VertexIdentifier>                vertices{
+      graph.vertices()};
 
-  dist[source] = 0;
+    dist[source] = 0;
 
-  for (VertexIdentifier v : vertices) {
-    if (v != source) { dist[v] = infinity; }
+    for (VertexIdentifier v : vertices) {
+      if (v != source) { dist[v] = infinity; }
 
-    prev[v] = undefined;
-    insert(queue, VertexWithPriority{v, dist[v]});
-  }
+      prev[v] = undefined;
+      insert(queue, VertexWithPriority{v, dist[v]});
+    }
 
-  while (!queue.empty()) {
-    const VertexWithPriority u{queue.front()};
-    queue.pop_front();
-    const std::vector<VertexIdentifier> directlyReachables{
-      graph.directlyReachables(u.vertex())};
+    while (!queue.empty()) {
+      const VertexWithPriority u{queue.front()};
+      queue.pop_front();
 
-    for (VertexIdentifier directlyReachable : directlyReachables) {
-      const auto queueIterator{std::find_if(
-        queue.begin(),
-        queue.end(),
-        [directlyReachable](const VertexWithPriority& vertexWithPriority) {
-          return vertexWithPriority.vertex() == directlyReachable;
-        })};
+      // The vertices left are unreachable, like for `denseAlgorithm`.
+      if (u.priority() == infinity) { break; }
 
-      if (queueIterator == queue.end()) { continue; }
+      graph.forEachOutEdge(
+        u.vertex(),
+        [&](VertexIdentifier directlyReachable, std::int64_t edgeLength) {
+          if (edgeLength < 0) {
+            G_THROW(
+              GraphException,
+              "Vertex %zu has an edge with a negative weight.",
+              u.vertex());
+          }
 
-      const std::optional<std::int64_t> edgeData{
-        graph.fetchEdgeData(u.vertex(), directlyReachable)};
+          const auto queueIterator{std::find_if(
+            queue.begin(),
+            queue.end(),
+            [directlyReachable](const VertexWithPriority& vertexWithPriority) {
+              return vertexWithPriority.vertex() == directlyReachable;
+            })};
 
-      G_ASSERT(
-        edgeData.has_value(),
-        "edgeData optional had no value for edge from %zu to %zu",
-        u.vertex(),
-        directlyReachable);
-
-      const std::int64_t alt{dist[u.vertex()] + *edgeData};
-      const std::unordered_map<VertexIdentifier, std::int64_t>::iterator
-        neighborIt{dist.find(directlyReachable)};
-      G_ASSERT(
-        neighborIt != dist.end(),
-        "Could not find %zu in dist.",
-        directlyReachable);
-      std::int64_t& distanceNeighbor{neighborIt->second};
-
-      if (alt < distanceNeighbor) {
-        distanceNeighbor        = alt;
-        prev[directlyReachable] = u.vertex();
-        queue.erase(queueIterator);
-        insert(queue, VertexWithPriority{directlyReachable, alt});
-      }
+          if (queueIterator == queue.end()) { return; }
+
+          // The sum would not fit, so the path is no shorter than
+          // unreachable.
+          if (edgeLength > infinity - dist[u.vertex()]) { return; }
+
+          const std::int64_t alt{dist[u.vertex()] + edgeLength};
+          const std::unordered_map<VertexIdentifier, std::int64_t>::iterator
+            neighborIt{dist.find(directlyReachable)};
+          G_ASSERT(
+            neighborIt != dist.end(),
+            "Could not find %zu in dist.",
+            directlyReachable);
+          std::int64_t& distanceNeighbor{neighborIt->second};
+
+          if (alt < distanceNeighbor) {
+            distanceNeighbor        = alt;
+            prev[directlyReachable] = u.vertex();
+            queue.erase(queueIterator);
+            insert(queue, VertexWithPriority{directlyReachable, alt});
+          }
+        });
     }
-  }
 
-  return ShortestPaths{source, prev, dist};
+    return ShortestPaths{source, prev, dist};
+  }
 }
 } // namespace g::algo::dijkstra
 #endif // INCG_G_ALGO_DIJKSTRA_ALGORITHM_HPP
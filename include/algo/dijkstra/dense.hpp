@@ -0,0 +1,126 @@
+#ifndef INCG_G_ALGO_DIJKSTRA_DENSE_HPP
+#define INCG_G_ALGO_DIJKSTRA_DENSE_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "algo/shortest_paths.hpp"
+#include "bit_matrix.hpp"
+#include "directionality.hpp"
+#include "graph.hpp"
+
+namespace g::algo::dijkstra {
+namespace detail {
+/*!
+ * \brief The result of `denseShortestPaths`.
+ **/
+struct DenseShortestPaths {
+  /*!
+   * \brief Marks a vertex without a predecessor.
+   **/
+  static constexpr std::size_t none{SIZE_MAX};
+
+  std::vector<std::int64_t> distance;    /*!< INT64_MAX if unreachable */
+  std::vector<std::size_t>  predecessor; /*!< `none` if there is none */
+};
+
+/*!
+ * \brief Writes the weights of the edges leaving a vertex into a row that
+ *        is filled with INT64_MAX, the weight of a missing edge.
+ **/
+using RowFiller
+  = std::function<void(std::size_t vertex, std::span<std::int64_t> row)>;
+
+/*!
+ * \brief Runs the O(V^2) array version of Dijkstra's algorithm.
+ * \param vertexCount The count of vertices, which are 0 to vertexCount - 1.
+ * \param source The source vertex.
+ * \param fillRow Called once for every vertex that is settled.
+ * \return The distances and predecessors.
+ * \throws GraphException if an edge has a negative weight.
+ * \note Picks the next vertex with a linear minimum search and relaxes every
+ *       column of its row, both using 256 bit vector instructions if
+ *       compiled with AVX2 enabled.
+ **/
+[[nodiscard]] DenseShortestPaths denseShortestPaths(
+  std::size_t      vertexCount,
+  std::size_t      source,
+  const RowFiller& fillRow);
+} // namespace detail
+
+/*!
+ * \brief Runs the O(V^2) array version of Dijkstra's algorithm on a graph
+ *        whose implementation is a matrix.
+ * \param graph The graph. The edge weights must not be negative.
+ * \param source The source vertex.
+ * \return The shortest paths from `source`.
+ * \throws GraphException if an edge has a negative weight.
+ * \note Beats the heap based versions on dense graphs. `algorithm` calls
+ *       this for every `MatrixAdjacency` implementation.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename Maps>
+  requires MatrixAdjacency<Implementation>
+[[nodiscard]] ShortestPaths denseAlgorithm(
+  const Graph<
+    TheDirectionality,
+    Implementation,
+    VertexData,
+    std::int64_t,
+    Maps>&
+                   graph,
+  VertexIdentifier source)
+{
+  constexpr std::int64_t infinity{INT64_MAX};
+  const BitMatrix&       adjacency{graph.adjacency()};
+  const std::size_t      vertexCount{std::max(
+    {adjacency.rowCount(), adjacency.columnCount(), source + 1})};
+
+  const detail::DenseShortestPaths paths{detail::denseShortestPaths(
+    vertexCount,
+    source,
+    [&graph](std::size_t vertex, std::span<std::int64_t> row) {
+      graph.forEachOutEdge(
+        VertexIdentifier{vertex},
+        [row](VertexIdentifier target, std::int64_t weight) {
+          row[target] = weight;
+        });
+    })};
+
+  std::unordered_map<VertexIdentifier, std::optional<VertexIdentifier>> prev{};
+  std::unordered_map<VertexIdentifier, std::int64_t>                    dist{};
+
+  for (VertexIdentifier v : graph.vertices()) {
+    // Vertices beyond the matrix have no edges.
+    if (v >= vertexCount) {
+      prev[v] = std::nullopt;
+      dist[v] = infinity;
+      continue;
+    }
+
+    if (const std::size_t predecessor{paths.predecessor[v]};
+        predecessor != detail::DenseShortestPaths::none) {
+      prev[v] = VertexIdentifier{predecessor};
+    }
+    else {
+      prev[v] = std::nullopt;
+    }
+
+    dist[v] = paths.distance[v];
+  }
+
+  prev[source] = std::nullopt;
+  dist[source] = 0;
+  return ShortestPaths{source, prev, dist};
+}
+} // namespace g::algo::dijkstra
+#endif // INCG_G_ALGO_DIJKSTRA_DENSE_HPP
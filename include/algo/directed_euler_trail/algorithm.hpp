@@ -0,0 +1,113 @@
+#ifndef INCG_G_ALGO_DIRECTED_EULER_TRAIL_ALGORITHM_HPP
+#define INCG_G_ALGO_DIRECTED_EULER_TRAIL_ALGORITHM_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <span>
+#include <vector>
+
+#include "algo/directed_euler_trail/multigraph.hpp"
+#include "graph.hpp"
+
+namespace g::algo::directed_euler_trail {
+/*!
+ * \brief Determines the vertex that an Euler trail of `multigraph` has to
+ *        begin with.
+ * \param multigraph The multigraph.
+ * \return The dense index of the vertex with one more outgoing than incoming
+ *         edge if there is one; otherwise the lowest vertex with an outgoing
+ *         edge, or 0 if there are no edges.
+ * \throws GraphException if the degrees of `multigraph` rule out an Euler
+ *                        trail.
+ **/
+[[nodiscard]] std::size_t trailStart(const Multigraph& multigraph);
+
+/*!
+ * \brief Writes an Euler trail of `multigraph` to `output`.
+ * \param multigraph The multigraph. Every parallel edge is used once.
+ * \param output Receives the dense indices of the vertices of the trail. Must
+ *               hold exactly multigraph.edgeCount() + 1 elements. May be a
+ *               view of a memory mapped file.
+ * \throws GraphException if `output` has the wrong size or if `multigraph`
+ *                        has no Euler trail.
+ * \note Runs Hierholzer's algorithm with an explicit stack in
+ *       O(V + A + E) time, where A is the count of distinct arcs. Besides
+ *       `output` it allocates a cursor per vertex, a copy of the
+ *       multiplicities and a stack of at most E + 1 vertices. A vertex is
+ *       finished in reverse trail order, so it is written to the back of
+ *       `output` and the trail never needs to be reversed.
+ **/
+void writeEulerTrail(
+  const Multigraph&        multigraph,
+  std::span<std::uint32_t> output);
+
+/*!
+ * \brief Writes an Euler trail of `multigraph` to `output` using several
+ *        threads.
+ * \param multigraph The multigraph. Every parallel edge is used once.
+ * \param output Receives the dense indices of the vertices of the trail. Must
+ *               hold exactly multigraph.edgeCount() + 1 elements.
+ * \param threadCount The count of threads to walk the multigraph with.
+ * \throws GraphException if `output` has the wrong size or if `multigraph`
+ *                        has no Euler trail.
+ * \note The vertices are split among the threads of a `ThreadTeam`. Every
+ *       thread walks from each of its vertices, claiming the edges leaving
+ *       a vertex through an atomic cursor per vertex, until it gets stuck.
+ *       The walks are then joined end to start into one trail from the
+ *       start vertex and closed sub-trails, and the closed sub-trails are
+ *       spliced into the trail at vertices they share with it. The trail
+ *       is a valid Euler trail but generally differs from the one of the
+ *       sequential overload. Besides `output` it allocates O(V + A + E)
+ *       words, as the walks are buffered before being spliced.
+ **/
+void writeEulerTrail(
+  const Multigraph&        multigraph,
+  std::span<std::uint32_t> output,
+  std::size_t              threadCount);
+
+/*!
+ * \brief Computes an Euler trail of `multigraph`.
+ * \param multigraph The multigraph. Every parallel edge is used once.
+ * \return The vertices of the trail, multigraph.edgeCount() + 1 of them.
+ * \throws GraphException if `multigraph` has no Euler trail.
+ **/
+[[nodiscard]] std::vector<VertexIdentifier> algorithm(
+  const Multigraph& multigraph);
+
+/*!
+ * \brief Computes an Euler trail of `multigraph` using several threads.
+ * \param multigraph The multigraph. Every parallel edge is used once.
+ * \param threadCount The count of threads to walk the multigraph with.
+ * \return The vertices of the trail, multigraph.edgeCount() + 1 of them.
+ * \throws GraphException if `multigraph` has no Euler trail.
+ **/
+[[nodiscard]] std::vector<VertexIdentifier> algorithm(
+  const Multigraph& multigraph,
+  std::size_t       threadCount);
+
+/*!
+ * \brief Computes an Euler trail of a directed graph.
+ * \param graph The graph.
+ * \return The vertices of the trail.
+ * \throws GraphException if `graph` has no Euler trail.
+ **/
+template<
+  typename Implementation,
+  typename VertexData,
+  typename EdgeData,
+  typename Maps>
+[[nodiscard]] std::vector<VertexIdentifier> algorithm(
+  const Graph<
+    Directionality::Directed,
+    Implementation,
+    VertexData,
+    EdgeData,
+    Maps>&
+    graph)
+{
+  G_ASSERT(graph.hasVertices(), "%s", "The graph given had no vertices.");
+
+  return algorithm(makeMultigraph(graph));
+}
+} // namespace g::algo::directed_euler_trail
+#endif // INCG_G_ALGO_DIRECTED_EULER_TRAIL_ALGORITHM_HPP
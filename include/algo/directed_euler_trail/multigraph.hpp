@@ -0,0 +1,145 @@
+#ifndef INCG_G_ALGO_DIRECTED_EULER_TRAIL_MULTIGRAPH_HPP
+#define INCG_G_ALGO_DIRECTED_EULER_TRAIL_MULTIGRAPH_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <vector>
+
+#include "algo/vertex_index.hpp"
+#include "edge.hpp"
+#include "graph.hpp"
+
+namespace g::algo::directed_euler_trail {
+/*!
+ * \brief An immutable directed multigraph in compressed sparse row form.
+ *
+ * Parallel edges are not stored one by one: every distinct (source, target)
+ * pair is a single arc that carries the count of edges it stands for. Targets
+ * and multiplicities are 32 bit wide, which keeps graphs with many repeated
+ * edges, such as de Bruijn graphs, small.
+ **/
+class Multigraph {
+public:
+  /*!
+   * \brief Creates a `Multigraph` in which every edge has multiplicity 1.
+   * \param vertexIndex The vertices.
+   * \param edges The edges. An edge given more than once is a parallel edge.
+   * \throws GraphException if an endpoint is not in `vertexIndex` or if there
+   *                        are more than 2^32 - 1 vertices.
+   **/
+  Multigraph(VertexIndex vertexIndex, const std::vector<Edge>& edges);
+
+  /*!
+   * \brief Creates a `Multigraph`.
+   * \param vertexIndex The vertices.
+   * \param edges The edges. An edge given more than once has the sum of its
+   *              multiplicities.
+   * \param multiplicities The multiplicity of every edge in `edges`.
+   * \throws GraphException if `edges` and `multiplicities` differ in size, if
+   *                        an endpoint is not in `vertexIndex`, if there are
+   *                        more than 2^32 - 1 vertices or if a multiplicity
+   *                        exceeds 2^32 - 1.
+   **/
+  Multigraph(
+    VertexIndex                       vertexIndex,
+    const std::vector<Edge>&          edges,
+    const std::vector<std::uint32_t>& multiplicities);
+
+  /*!
+   * \brief Read accessor for the mapping of vertices to dense indices.
+   * \return The vertex index.
+   **/
+  [[nodiscard]] const VertexIndex& vertexIndex() const;
+
+  [[nodiscard]] std::size_t vertexCount() const;
+
+  /*!
+   * \brief Returns the count of edges, parallel edges included.
+   * \return The sum of the multiplicities of all arcs.
+   **/
+  [[nodiscard]] std::size_t edgeCount() const;
+
+  /*!
+   * \brief Returns the count of distinct (source, target) pairs.
+   * \return The count of arcs.
+   **/
+  [[nodiscard]] std::size_t arcCount() const;
+
+  /*!
+   * \brief Returns the first arc leaving `vertex`.
+   * \param vertex The dense index of the vertex.
+   * \return The first arc leaving `vertex`.
+   **/
+  [[nodiscard]] std::size_t firstArc(std::size_t vertex) const
+  {
+    return m_firstArc[vertex];
+  }
+
+  /*!
+   * \brief Returns one past the last arc leaving `vertex`.
+   * \param vertex The dense index of the vertex.
+   * \return One past the last arc leaving `vertex`.
+   **/
+  [[nodiscard]] std::size_t lastArc(std::size_t vertex) const
+  {
+    return m_firstArc[vertex + 1];
+  }
+
+  /*!
+   * \brief Returns the vertex that `arc` leads to.
+   * \param arc The arc.
+   * \return The dense index of the target of `arc`.
+   **/
+  [[nodiscard]] std::uint32_t target(std::size_t arc) const
+  {
+    return m_target[arc];
+  }
+
+  /*!
+   * \brief Returns the count of parallel edges that `arc` stands for.
+   * \param arc The arc.
+   * \return The multiplicity of `arc`, at least 1.
+   **/
+  [[nodiscard]] std::uint32_t multiplicity(std::size_t arc) const
+  {
+    return m_multiplicity[arc];
+  }
+
+  /*!
+   * \brief Read accessor for the multiplicities of all arcs.
+   * \return The multiplicities, indexed by arc.
+   **/
+  [[nodiscard]] const std::vector<std::uint32_t>& multiplicities() const;
+
+private:
+  VertexIndex                m_vertexIndex;
+  std::size_t                m_edgeCount;
+  std::vector<std::size_t>   m_firstArc; /*!< CSR offsets, one per vertex + 1 */
+  std::vector<std::uint32_t> m_target;
+  std::vector<std::uint32_t> m_multiplicity;
+};
+
+/*!
+ * \brief Creates a `Multigraph` from a directed `Graph`.
+ * \param graph The graph.
+ * \return The multigraph. Every edge has multiplicity 1.
+ **/
+template<
+  typename Implementation,
+  typename VertexData,
+  typename EdgeData,
+  typename Maps>
+[[nodiscard]] Multigraph makeMultigraph(
+  const Graph<
+    Directionality::Directed,
+    Implementation,
+    VertexData,
+    EdgeData,
+    Maps>&
+    graph)
+{
+  return Multigraph{
+    VertexIndex{graph.vertices()}, graph.edgesUndirectedWithReverseEdges()};
+}
+} // namespace g::algo::directed_euler_trail
+#endif // INCG_G_ALGO_DIRECTED_EULER_TRAIL_MULTIGRAPH_HPP
@@ -0,0 +1,135 @@
+#ifndef INCG_G_ALGO_DIRECTION_OPTIMIZING_BFS_ALGORITHM_HPP
+#define INCG_G_ALGO_DIRECTION_OPTIMIZING_BFS_ALGORITHM_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "algo/indexed_adjacency.hpp"
+#include "algo/vertex_index.hpp"
+#include "graph.hpp"
+#include "thread_team.hpp"
+
+namespace g::algo::direction_optimizing_bfs {
+/*!
+ * \brief The hop distances and breadth first search tree from one source.
+ **/
+class Result {
+public:
+  /*!
+   * \brief Creates a `Result`.
+   * \param vertexIndex The vertices.
+   * \param distance The hop distance of every vertex by dense index, SIZE_MAX
+   *                 for vertices that can't be reached.
+   * \param parent The parent of every vertex in the search tree by dense
+   *               index, SIZE_MAX for the source and for vertices that
+   *               can't be reached.
+   **/
+  Result(
+    VertexIndex              vertexIndex,
+    std::vector<std::size_t> distance,
+    std::vector<std::size_t> parent);
+
+  /*!
+   * \brief Determines whether `vertex` can be reached from the source.
+   * \param vertex The vertex.
+   * \return true if `vertex` can be reached; otherwise false.
+   **/
+  [[nodiscard]] bool isReachable(VertexIdentifier vertex) const;
+
+  /*!
+   * \brief Fetches the count of edges on a shortest path to `vertex`.
+   * \param vertex The vertex.
+   * \return The hop distance or nullopt if `vertex` can't be reached.
+   **/
+  [[nodiscard]] std::optional<std::size_t> distanceTo(
+    VertexIdentifier vertex) const;
+
+  /*!
+   * \brief Fetches the vertex preceding `vertex` on a shortest path.
+   * \param vertex The vertex.
+   * \return The parent or nullopt if `vertex` is the source or can't be
+   *         reached.
+   **/
+  [[nodiscard]] std::optional<VertexIdentifier> parentOf(
+    VertexIdentifier vertex) const;
+
+private:
+  VertexIndex              m_vertexIndex;
+  std::vector<std::size_t> m_distance;
+  std::vector<std::size_t> m_parent;
+};
+
+namespace detail {
+/*!
+ * \brief Searches breadth first from `source` with all threads of `team`.
+ * \param outgoing The arcs leaving every vertex.
+ * \param incoming The arcs entering every vertex, that is the transpose of
+ *                 `outgoing`.
+ * \param source The dense index of the source.
+ * \param team The threads to use.
+ * \param distance Receives the hop distance of every vertex, SIZE_MAX if it
+ *                 can't be reached.
+ * \param parent Receives the parent of every vertex, SIZE_MAX for the source
+ *               and for vertices that can't be reached.
+ * \note Works level by level. A level either expands the frontier top down
+ *       along `outgoing` or lets every unvisited vertex look for a parent in
+ *       the frontier bottom up along `incoming`, stopping at the first one
+ *       found. It switches to bottom up once the arcs leaving the frontier
+ *       outnumber a fifteenth of the arcs leaving unvisited vertices and
+ *       back once a shrinking frontier holds less than an eighteenth of the
+ *       vertices. The frontiers and the visited vertices are bitmaps of
+ *       which every thread owns whole words in the bottom up steps.
+ **/
+void breadthFirstSearch(
+  const IndexedAdjacency&   outgoing,
+  const IndexedAdjacency&   incoming,
+  std::size_t               source,
+  ThreadTeam&               team,
+  std::vector<std::size_t>& distance,
+  std::vector<std::size_t>& parent);
+} // namespace detail
+
+/*!
+ * \brief Computes the hop distances from `source` with a direction
+ *        optimizing parallel breadth first search.
+ * \param graph The graph.
+ * \param source The vertex to search from.
+ * \param threadCount The count of threads to use.
+ * \return The hop distances and the search tree.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename EdgeData,
+  typename Maps>
+[[nodiscard]] Result algorithm(
+  const Graph<TheDirectionality, Implementation, VertexData, EdgeData, Maps>&
+                   graph,
+  VertexIdentifier source,
+  std::size_t      threadCount = defaultThreadCount())
+{
+  const IndexedAdjacency   outgoing{makeIndexedAdjacency(graph)};
+  const std::size_t        sourceIndex{
+    outgoing.vertexIndex().indexOf(source)};
+  ThreadTeam               team{threadCount};
+  std::vector<std::size_t> distance{};
+  std::vector<std::size_t> parent{};
+
+  if constexpr (TheDirectionality == Directionality::Undirected) {
+    detail::breadthFirstSearch(
+      outgoing, outgoing, sourceIndex, team, distance, parent);
+  }
+  else {
+    detail::breadthFirstSearch(
+      outgoing, outgoing.transposed(), sourceIndex, team, distance, parent);
+  }
+
+  return Result{
+    outgoing.vertexIndex(), std::move(distance), std::move(parent)};
+}
+} // namespace g::algo::direction_optimizing_bfs
+#endif // INCG_G_ALGO_DIRECTION_OPTIMIZING_BFS_ALGORITHM_HPP
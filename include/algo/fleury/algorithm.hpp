@@ -1,55 +1,50 @@
 #ifndef INCG_G_ALGO_FLEURY_ALGORITHM_HPP
 #define INCG_G_ALGO_FLEURY_ALGORITHM_HPP
-#include <algorithm>
+#include <vector>
 
-#include "algo/fleury/is_bridge.hpp"
+#include "algo/fleury/bridge_oracle.hpp"
+#include "algo/indexed_adjacency.hpp"
 #include "graph.hpp"
 
 namespace g::algo::fleury {
 namespace detail {
-template<typename Implementation, typename VertexData, typename EdgeData>
-[[nodiscard]] VertexIdentifier pickNextVertex(
-  const Graph<Directionality::Undirected, Implementation, VertexData, EdgeData>&
-                                       graph,
-  VertexIdentifier                     currentVertex,
-  const std::vector<VertexIdentifier>& neighbors)
-{
-  if (neighbors.size() == 1) { return neighbors.front(); }
-
-  const std::vector<VertexIdentifier>::const_iterator it{std::find_if(
-    neighbors.begin(),
-    neighbors.end(),
-    [&graph, currentVertex](VertexIdentifier target) {
-      return !isBridge(graph, currentVertex, target);
-    })};
-  G_ASSERT(it != neighbors.end(), "%s", "Could not find bridge in neighbors!");
-
-  return *it;
-}
+/*!
+ * \brief Computes an Euler trail with Fleury's algorithm.
+ * \param adjacency The undirected graph.
+ * \return The vertices of the trail by dense index. The trail starts at the
+ *         lowest vertex of odd degree if there is one and at the lowest
+ *         vertex with an edge otherwise.
+ * \note A vertex with more than one unused edge has at most one bridge among
+ *       them, so at most two bridge queries are needed per step. The
+ *       bridges are computed once; every later query searches only the
+ *       2-edge-connected block of its edge, see `BridgeOracle`.
+ **/
+[[nodiscard]] std::vector<std::size_t> eulerTrail(
+  const IndexedAdjacency& adjacency);
 } // namespace detail
 
-template<typename Implementation, typename VertexData, typename EdgeData>
+template<
+  typename Implementation,
+  typename VertexData,
+  typename EdgeData,
+  typename Maps>
 [[nodiscard]] std::vector<VertexIdentifier> algorithm(
-  Graph<Directionality::Undirected, Implementation, VertexData, EdgeData> graph)
+  const Graph<
+    Directionality::Undirected,
+    Implementation,
+    VertexData,
+    EdgeData,
+    Maps>&
+    graph)
 {
   G_ASSERT(graph.hasVertices(), "%s", "Graph had no vertices!");
 
-  const std::vector<VertexIdentifier> vertices{graph.vertices()};
-  const VertexIdentifier              startVertex{vertices.front()};
-  VertexIdentifier                    currentVertex{startVertex};
-  std::vector<VertexIdentifier>       result{currentVertex};
-  std::vector<VertexIdentifier>       neighbors{};
+  const IndexedAdjacency         adjacency{makeIndexedAdjacency(graph)};
+  const std::vector<std::size_t> trail{detail::eulerTrail(adjacency)};
+  std::vector<VertexIdentifier>  result(trail.size());
 
-  while (!(neighbors = graph.directlyReachables(currentVertex)).empty()) {
-    const VertexIdentifier nextVertex{
-      detail::pickNextVertex(graph, currentVertex, neighbors)};
-    result.push_back(nextVertex);
-    G_ASSERT(
-      graph.removeEdge(currentVertex, nextVertex),
-      "Couldn't remove edge from %zu to %zu from graph.",
-      currentVertex,
-      nextVertex);
-    currentVertex = nextVertex;
+  for (std::size_t i{0}; i < trail.size(); ++i) {
+    result[i] = adjacency.vertexIndex().vertexAt(trail[i]);
   }
 
   return result;
@@ -0,0 +1,124 @@
+#ifndef INCG_G_ALGO_FLEURY_BRIDGE_ORACLE_HPP
+#define INCG_G_ALGO_FLEURY_BRIDGE_ORACLE_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <vector>
+
+#include "algo/indexed_adjacency.hpp"
+
+namespace g::algo::fleury {
+/*!
+ * \brief Finds the bridges of an undirected graph with Tarjan's low-link
+ *        algorithm in O(V + E).
+ * \param adjacency The undirected graph.
+ * \param isRemoved Flags the edges, by identifier, that are to be ignored.
+ * \return Flags the edges, by identifier, that are bridges of the graph
+ *         without the removed edges.
+ **/
+[[nodiscard]] std::vector<bool> findBridges(
+  const IndexedAdjacency&  adjacency,
+  const std::vector<bool>& isRemoved);
+
+/*!
+ * \brief Answers whether edges are bridges while edges are being removed.
+ *
+ * `findBridges` runs once, on the first query, and assigns every edge that
+ * is not a bridge the 2-edge-connected block it belongs to. A cycle never
+ * leaves its block, so removing an edge can only turn edges of its own
+ * block into bridges. Every later query for an edge (v, w) searches for
+ * another path between v and w within the block, breadth first from both
+ * ends at once. If v and w are still connected the searches meet after
+ * examining about twice the arcs of the shorter detour. Otherwise the
+ * search on the smaller side runs out first. Bridges stay bridges as edges
+ * are removed, so every bridge found is cached.
+ **/
+class BridgeOracle {
+public:
+  /*!
+   * \brief Creates a `BridgeOracle`.
+   * \param adjacency The undirected graph, which has to outlive the
+   *                  `BridgeOracle`.
+   **/
+  explicit BridgeOracle(const IndexedAdjacency& adjacency);
+
+  /*!
+   * \brief Determines whether an edge is a bridge of the graph without the
+   *        removed edges.
+   * \param edgeId The identifier of the edge. Must not have been removed.
+   * \return true if the edge is a bridge; otherwise false.
+   **/
+  [[nodiscard]] bool isBridge(std::size_t edgeId);
+
+  /*!
+   * \brief Removes an edge.
+   * \param edgeId The identifier of the edge.
+   **/
+  void remove(std::size_t edgeId);
+
+  /*!
+   * \brief Determines whether an edge has been removed.
+   * \param edgeId The identifier of the edge.
+   * \return true if the edge has been removed; otherwise false.
+   **/
+  [[nodiscard]] bool isRemoved(std::size_t edgeId) const;
+
+  /*!
+   * \brief Returns how often the bridges of the whole graph have been
+   *        computed.
+   * \return 0 before the first query; otherwise 1.
+   **/
+  [[nodiscard]] std::size_t computationCount() const;
+
+  /*!
+   * \brief Returns the count of arcs examined by the searches of all
+   *        queries so far, a measure of the work done.
+   * \return The count of arcs examined.
+   **/
+  [[nodiscard]] std::size_t examinedArcCount() const;
+
+private:
+  /*!
+   * \brief A breadth first search from one end of the edge queried.
+   **/
+  struct Search {
+    std::vector<std::size_t> queue;
+    std::size_t              head; /*!< The vertex being expanded */
+    std::size_t              arc;  /*!< The next arc of `queue[head]` */
+  };
+
+  enum class Outcome { Continue, Met, Exhausted };
+
+  /*!
+   * \brief Finds the ends and the block of every edge.
+   **/
+  void label();
+
+  /*!
+   * \brief Examines the next arc of a search.
+   * \param search The search to advance.
+   * \param mark The mark of the vertices reached by `search`.
+   * \param otherMark The mark of the vertices reached by the other search.
+   * \param edgeId The edge queried, which the searches must not use.
+   * \return Whether the searches met, `search` ran out of arcs or neither.
+   **/
+  Outcome advance(
+    Search&       search,
+    std::uint32_t mark,
+    std::uint32_t otherMark,
+    std::size_t   edgeId);
+
+  const IndexedAdjacency&    m_adjacency;
+  std::vector<bool>          m_isRemoved;
+  std::vector<bool>          m_isBridge;
+  std::vector<std::size_t>   m_blockOf; /*!< The block of every edge */
+  std::vector<std::size_t>   m_ends;    /*!< Both ends of every edge */
+  std::vector<std::uint32_t> m_marks;   /*!< The last search by vertex */
+  std::uint32_t              m_mark;    /*!< The mark of the last search */
+  std::array<Search, 2>      m_searches;
+  std::size_t                m_computationCount;
+  std::size_t                m_examinedArcCount;
+};
+} // namespace g::algo::fleury
+#endif // INCG_G_ALGO_FLEURY_BRIDGE_ORACLE_HPP
@@ -1,27 +1,55 @@
 #ifndef INCG_G_ALGO_FLEURY_IS_BRIDGE_HPP
 #define INCG_G_ALGO_FLEURY_IS_BRIDGE_HPP
-#include "algo/fleury/reachable_vertices_from.hpp"
+#include <optional>
+
+#include "algo/fleury/bridge_oracle.hpp"
+#include "algo/indexed_adjacency.hpp"
 #include "assert.hpp"
 #include "graph.hpp"
 
 namespace g::algo::fleury {
-template<typename Implementation, typename VertexData, typename EdgeData>
+namespace detail {
+/*!
+ * \brief Looks up the identifier of the edge between two vertices.
+ * \param adjacency The graph.
+ * \param source The dense index of one endpoint.
+ * \param target The dense index of the other endpoint.
+ * \return The identifier of the edge or nullopt if there is none.
+ **/
+[[nodiscard]] std::optional<std::size_t> findEdgeId(
+  const IndexedAdjacency& adjacency,
+  std::size_t             source,
+  std::size_t             target);
+} // namespace detail
+
+template<
+  typename Implementation,
+  typename VertexData,
+  typename EdgeData,
+  typename Maps>
 [[nodiscard]] bool isBridge(
-  const Graph<Directionality::Undirected, Implementation, VertexData, EdgeData>&
+  const Graph<
+    Directionality::Undirected,
+    Implementation,
+    VertexData,
+    EdgeData,
+    Maps>&
                    graph,
   VertexIdentifier edgeSource,
   VertexIdentifier edgeTarget)
 {
-  const std::int64_t count1{reachableVerticesFrom(graph, edgeSource)};
-  Graph<Directionality::Undirected, Implementation, VertexData, EdgeData>
-    graphCopy{graph};
+  const IndexedAdjacency           adjacency{makeIndexedAdjacency(graph)};
+  const std::optional<std::size_t> edgeId{detail::findEdgeId(
+    adjacency,
+    adjacency.vertexIndex().indexOf(edgeSource),
+    adjacency.vertexIndex().indexOf(edgeTarget))};
   G_ASSERT(
-    graphCopy.removeEdge(edgeSource, edgeTarget),
-    "Couldn't remove edge from %zu to %zu from graph.",
+    edgeId.has_value(),
+    "There is no edge from %zu to %zu in the graph.",
     edgeSource,
     edgeTarget);
-  const std::int64_t count2{reachableVerticesFrom(graphCopy, edgeSource)};
-  return count2 < count1;
+  return findBridges(
+    adjacency, std::vector<bool>(adjacency.edgeCount(), false))[*edgeId];
 }
 } // namespace g::algo::fleury
 #endif // INCG_G_ALGO_FLEURY_IS_BRIDGE_HPP
@@ -2,48 +2,38 @@
 #define INCG_G_ALGO_FLEURY_REACHABLE_VERTICES_FROM_HPP
 #include <cstdint>
 
-#include <unordered_map>
-
+#include "algo/indexed_adjacency.hpp"
+#include "algo/traversal.hpp"
 #include "graph.hpp"
 
 namespace g::algo::fleury {
-namespace detail {
-template<typename Implementation, typename VertexData, typename EdgeData>
-[[nodiscard]] std::int64_t reachableVerticesFromImpl(
-  const Graph<Directionality::Undirected, Implementation, VertexData, EdgeData>&
-                                              graph,
-  VertexIdentifier                            vertex,
-  std::unordered_map<VertexIdentifier, bool>& isVisited)
-{
-  isVisited[vertex] = true;
-  std::int64_t count{1};
-
-  for (const std::vector<VertexIdentifier> neighbors{
-         graph.directlyReachables(vertex)};
-       VertexIdentifier neighbor : neighbors) {
-    if (!isVisited[neighbor]) {
-      count += reachableVerticesFromImpl(graph, neighbor, isVisited);
-    }
-  }
-
-  return count;
-}
-} // namespace detail
-
-template<typename Implementation, typename VertexData, typename EdgeData>
+template<
+  typename Implementation,
+  typename VertexData,
+  typename EdgeData,
+  typename Maps>
 [[nodiscard]] std::int64_t reachableVerticesFrom(
-  const Graph<Directionality::Undirected, Implementation, VertexData, EdgeData>&
+  const Graph<
+    Directionality::Undirected,
+    Implementation,
+    VertexData,
+    EdgeData,
+    Maps>&
                    graph,
   VertexIdentifier vertex)
 {
-  std::unordered_map<VertexIdentifier, bool> isVisited{};
-
-  for (const std::vector<VertexIdentifier> vertices{graph.vertices()};
-       VertexIdentifier                    v : vertices) {
-    isVisited.emplace(v, false);
-  }
-
-  return detail::reachableVerticesFromImpl(graph, vertex, isVisited);
+  struct Counter {
+    void discoverVertex(std::size_t) { ++count; }
+
+    std::int64_t count;
+  };
+
+  const IndexedAdjacency adjacency{makeIndexedAdjacency(graph)};
+  Traversal              traversal{adjacency.vertexCount()};
+  Counter                counter{0};
+  traversal.depthFirst(
+    adjacency, adjacency.vertexIndex().indexOf(vertex), counter);
+  return counter.count;
 }
 } // namespace g::algo::fleury
 #endif // INCG_G_ALGO_FLEURY_REACHABLE_VERTICES_FROM_HPP
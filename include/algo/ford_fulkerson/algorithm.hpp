@@ -24,9 +24,15 @@ private:
 template<
   Directionality TheDirectionality,
   typename Implementation,
-  typename VertexData>
+  typename VertexData,
+  typename Maps>
 Result algorithm(
-  const Graph<TheDirectionality, Implementation, VertexData, std::int32_t>&
+  const Graph<
+    TheDirectionality,
+    Implementation,
+    VertexData,
+    std::int32_t,
+    Maps>&
                    graph,
   VertexIdentifier source,
   VertexIdentifier sink)
@@ -55,26 +61,34 @@ Result algorithm(
     capacity[edge] = *optionalEdgeCapacity;
   }
 
-  std::optional<
-    std::unordered_map<VertexIdentifier, std::optional<VertexIdentifier>>>
-    predecessor{std::nullopt};
+  // The residual network has the reverse of every arc as well, so that an
+  // augmenting path can cancel flow sent along an earlier one.
+  const IndexedAdjacency   adjacency{
+    TheDirectionality == Directionality::Directed
+      ? IndexedAdjacency{
+        VertexIndex{graph.vertices()},
+        graph.edges(),
+        Directionality::Undirected}
+      : makeIndexedAdjacency(graph)};
+  const VertexIndex&       index{adjacency.vertexIndex()};
+  const std::size_t        start{index.indexOf(source)};
+  const std::size_t        target{index.indexOf(sink)};
+  Traversal                traversal{adjacency.vertexCount()};
+  std::vector<std::size_t> predecessor(adjacency.vertexCount());
 
-  while ((predecessor = breadthFirstSearch(graph, source, sink, capacity, flow))
-           .has_value()) {
+  while (breadthFirstSearch(
+    adjacency, traversal, start, target, capacity, flow, predecessor)) {
     std::int32_t increment{INT32_MAX};
 
-    for (VertexIdentifier u{sink}; (*predecessor)[u].has_value();
-         u = (*predecessor)[u].value()) {
-      increment = std::min(
-        increment,
-        capacity[Edge{(*predecessor)[u].value(), u}]
-          - flow[Edge{(*predecessor)[u].value(), u}]);
+    for (std::size_t v{target}; v != start; v = predecessor[v]) {
+      const Edge edge{index.vertexAt(predecessor[v]), index.vertexAt(v)};
+      increment = std::min(increment, capacity[edge] - flow[edge]);
     }
 
-    for (VertexIdentifier u{sink}; (*predecessor)[u].has_value();
-         u = (*predecessor)[u].value()) {
-      flow[Edge{(*predecessor)[u].value(), u}] += increment;
-      flow[Edge{u, (*predecessor)[u].value()}] -= increment;
+    for (std::size_t v{target}; v != start; v = predecessor[v]) {
+      const VertexIdentifier u{index.vertexAt(predecessor[v])};
+      flow[Edge{u, index.vertexAt(v)}] += increment;
+      flow[Edge{index.vertexAt(v), u}] -= increment;
     }
 
     maxFlow += increment;
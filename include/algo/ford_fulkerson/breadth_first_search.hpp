@@ -1,70 +1,36 @@
 #ifndef INCG_G_ALGO_FORD_FULKERSON_BREADTH_FIRST_SEARCH_HPP
 #define INCG_G_ALGO_FORD_FULKERSON_BREADTH_FIRST_SEARCH_HPP
+#include <cstddef>
 #include <cstdint>
 
-#include <optional>
-#include <queue>
 #include <unordered_map>
+#include <vector>
 
+#include "algo/indexed_adjacency.hpp"
+#include "algo/traversal.hpp"
 #include "edge.hpp"
-#include "graph.hpp"
 
 namespace g::algo::ford_fulkerson {
-enum class Color { White, Gray, Black };
-
-void enqueue(
-  std::queue<VertexIdentifier>&                q,
-  VertexIdentifier                             x,
-  std::unordered_map<VertexIdentifier, Color>& color);
-
-VertexIdentifier dequeue(
-  std::queue<VertexIdentifier>&                q,
-  std::unordered_map<VertexIdentifier, Color>& color);
-
-template<
-  Directionality TheDirectionality,
-  typename Implementation,
-  typename VertexData>
-std::optional<
-  std::unordered_map<VertexIdentifier, std::optional<VertexIdentifier>>>
-breadthFirstSearch(
-  const Graph<TheDirectionality, Implementation, VertexData, std::int32_t>&
-                                                graph,
-  VertexIdentifier                              start,
-  VertexIdentifier                              target,
+/*!
+ * \brief Searches for a shortest path with residual capacity from `start` to
+ *        `target`.
+ * \param adjacency The graph.
+ * \param traversal The traversal to search with. Is reset first.
+ * \param start The dense index of the vertex to begin with.
+ * \param target The dense index of the vertex to find.
+ * \param capacity The capacity of every pair of vertices.
+ * \param flow The flow of every pair of vertices.
+ * \param predecessor Receives the dense index of the vertex preceding every
+ *                    vertex on the path. Must have an element per vertex.
+ * \return true if `target` was reached; otherwise false.
+ **/
+[[nodiscard]] bool breadthFirstSearch(
+  const IndexedAdjacency&                       adjacency,
+  Traversal&                                    traversal,
+  std::size_t                                   start,
+  std::size_t                                   target,
   const std::unordered_map<Edge, std::int32_t>& capacity,
-  const std::unordered_map<Edge, std::int32_t>& flow)
-{
-  std::unordered_map<VertexIdentifier, Color>                           color{};
-  std::unordered_map<VertexIdentifier, std::optional<VertexIdentifier>> pred{};
-  std::queue<VertexIdentifier>                                          q{};
-
-  for (const std::vector<VertexIdentifier> vertices{graph.vertices()};
-       VertexIdentifier                    u : vertices) {
-    color[u] = Color::White;
-    pred[u]  = std::nullopt;
-  }
-
-  enqueue(q, start, color);
-
-  while (!q.empty()) {
-    const VertexIdentifier u{dequeue(q, color)};
-
-    for (const std::vector<VertexIdentifier> targets{
-           graph.directlyReachables(u)};
-         VertexIdentifier v : targets) {
-      if (
-        color[v] == Color::White
-        && capacity.at(Edge{u, v}) - flow.at(Edge{u, v}) > 0) {
-        enqueue(q, v, color);
-        pred[v] = u;
-      }
-    }
-  }
-
-  if (color[target] == Color::Black) { return pred; }
-
-  return std::nullopt;
-}
+  const std::unordered_map<Edge, std::int32_t>& flow,
+  std::vector<std::size_t>&                     predecessor);
 } // namespace g::algo::ford_fulkerson
 #endif // INCG_G_ALGO_FORD_FULKERSON_BREADTH_FIRST_SEARCH_HPP
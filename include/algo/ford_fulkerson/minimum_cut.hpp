@@ -0,0 +1,151 @@
+#ifndef INCG_G_ALGO_FORD_FULKERSON_MINIMUM_CUT_HPP
+#define INCG_G_ALGO_FORD_FULKERSON_MINIMUM_CUT_HPP
+#include <cstdint>
+
+#include <algorithm>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "algo/ford_fulkerson/algorithm.hpp"
+#include "edge.hpp"
+#include "graph.hpp"
+
+namespace g::algo::ford_fulkerson {
+/*!
+ * \brief A minimum s-t cut.
+ **/
+class MinimumCut {
+public:
+  /*!
+   * \brief Creates a `MinimumCut`.
+   * \param capacity The total capacity of the cut edges.
+   * \param sourceSide The vertices on the source side of the cut.
+   * \param cutEdges The edges leading from the source side to the sink side.
+   **/
+  MinimumCut(
+    std::int64_t                  capacity,
+    std::vector<VertexIdentifier> sourceSide,
+    std::vector<Edge>             cutEdges);
+
+  /*!
+   * \brief Read accessor for the capacity of the cut.
+   * \return The sum of the capacities of the cut edges.
+   **/
+  [[nodiscard]] std::int64_t capacity() const;
+
+  /*!
+   * \brief Read accessor for the source side of the cut.
+   * \return The vertices on the source side in ascending order.
+   **/
+  [[nodiscard]] const std::vector<VertexIdentifier>& sourceSide() const;
+
+  /*!
+   * \brief Read accessor for the cut edges.
+   * \return The edges from the source side to the sink side.
+   **/
+  [[nodiscard]] const std::vector<Edge>& cutEdges() const;
+
+  /*!
+   * \brief Determines whether `vertex` is on the source side of the cut.
+   * \param vertex The vertex to check.
+   * \return true if `vertex` is on the source side; otherwise false.
+   **/
+  [[nodiscard]] bool isOnSourceSide(VertexIdentifier vertex) const;
+
+private:
+  std::int64_t                  m_capacity;
+  std::vector<VertexIdentifier> m_sourceSide;
+  std::vector<Edge>             m_cutEdges;
+};
+
+/*!
+ * \brief Extracts a minimum cut from a maximum flow.
+ * \param graph The graph the maximum flow was computed on.
+ * \param result The maximum flow, as returned by `ford_fulkerson::algorithm`
+ *               or `push_relabel::algorithm`.
+ * \param source The source vertex of the maximum flow.
+ * \return The minimum cut whose source side consists of the vertices that
+ *         are reachable from `source` in the residual network.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename Maps>
+[[nodiscard]] MinimumCut minimumCut(
+  const Graph<
+    TheDirectionality,
+    Implementation,
+    VertexData,
+    std::int32_t,
+    Maps>&
+                   graph,
+  const Result&    result,
+  VertexIdentifier source)
+{
+  const std::unordered_map<Edge, std::int32_t>& flow{result.flow()};
+
+  auto flowOf{[&flow](VertexIdentifier u, VertexIdentifier v) {
+    const auto it{flow.find(Edge{u, v})};
+    return it == flow.end() ? std::int32_t{0} : it->second;
+  }};
+
+  // Vertices that u can send flow back to, by cancelling flow from them.
+  std::unordered_map<VertexIdentifier, std::vector<VertexIdentifier>>
+    cancellable{};
+
+  for (const auto& [edge, amount] : flow) {
+    if (amount < 0) { cancellable[edge.source()].push_back(edge.target()); }
+  }
+
+  std::unordered_set<VertexIdentifier> sourceSide{source};
+  std::queue<VertexIdentifier>         queue{};
+  queue.push(source);
+
+  auto visit{[&sourceSide, &queue](VertexIdentifier v) {
+    if (sourceSide.insert(v).second) { queue.push(v); }
+  }};
+
+  while (!queue.empty()) {
+    const VertexIdentifier u{queue.front()};
+    queue.pop();
+
+    for (const std::vector<VertexIdentifier> targets{
+           graph.directlyReachables(u)};
+         VertexIdentifier v : targets) {
+      if (graph.fetchEdgeData(u, v).value_or(0) - flowOf(u, v) > 0) {
+        visit(v);
+      }
+    }
+
+    if (const auto it{cancellable.find(u)}; it != cancellable.end()) {
+      for (VertexIdentifier v : it->second) { visit(v); }
+    }
+  }
+
+  std::int64_t      capacity{0};
+  std::vector<Edge> cutEdges{};
+
+  for (VertexIdentifier u : sourceSide) {
+    for (const std::vector<VertexIdentifier> targets{
+           graph.directlyReachables(u)};
+         VertexIdentifier v : targets) {
+      if (sourceSide.count(v) == 0) {
+        cutEdges.emplace_back(u, v);
+        capacity += graph.fetchEdgeData(u, v).value_or(0);
+      }
+    }
+  }
+
+  std::vector<VertexIdentifier> sortedSourceSide(
+    sourceSide.begin(), sourceSide.end());
+  std::sort(sortedSourceSide.begin(), sortedSourceSide.end());
+  std::sort(cutEdges.begin(), cutEdges.end());
+
+  return MinimumCut{capacity, std::move(sortedSourceSide), std::move(cutEdges)};
+}
+} // namespace g::algo::ford_fulkerson
+#endif // INCG_G_ALGO_FORD_FULKERSON_MINIMUM_CUT_HPP
@@ -0,0 +1,103 @@
+#ifndef INCG_G_ALGO_GOMORY_HU_TREE_HPP
+#define INCG_G_ALGO_GOMORY_HU_TREE_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <optional>
+#include <vector>
+
+#include "algo/residual_network.hpp"
+#include "algo/vertex_index.hpp"
+#include "graph.hpp"
+
+namespace g::algo {
+/*!
+ * \brief A Gomory-Hu tree of an undirected graph.
+ *
+ * The minimum cut between any two vertices of the graph equals the smallest
+ * weight on the path between them in the tree.
+ **/
+class GomoryHuTree {
+public:
+  /*!
+   * \brief Creates a `GomoryHuTree`.
+   * \param vertexIndex The vertices of the tree.
+   * \param parent The parent of every vertex by dense index. The root is its
+   *               own parent.
+   * \param weight The weight of the edge to the parent by dense index.
+   **/
+  GomoryHuTree(
+    VertexIndex               vertexIndex,
+    std::vector<std::size_t>  parent,
+    std::vector<std::int64_t> weight);
+
+  /*!
+   * \brief Fetches the parent of `vertex` in the tree.
+   * \param vertex The vertex.
+   * \return The parent of `vertex` or nullopt if `vertex` is the root.
+   **/
+  [[nodiscard]] std::optional<VertexIdentifier> parentOf(
+    VertexIdentifier vertex) const;
+
+  /*!
+   * \brief Fetches the weight of the tree edge from `vertex` to its parent.
+   * \param vertex The vertex, which must not be the root.
+   * \return The weight of the edge to the parent of `vertex`.
+   **/
+  [[nodiscard]] std::int64_t weightToParent(VertexIdentifier vertex) const;
+
+  /*!
+   * \brief Determines the value of a minimum cut between `u` and `v`.
+   * \param u The first vertex.
+   * \param v The second vertex, which must differ from `u`.
+   * \return The capacity of a minimum cut separating `u` and `v`.
+   * \note Walks the tree path between `u` and `v`, which takes O(V) time in
+   *       the worst case.
+   **/
+  [[nodiscard]] std::int64_t minimumCut(
+    VertexIdentifier u,
+    VertexIdentifier v) const;
+
+private:
+  VertexIndex               m_vertexIndex;
+  std::vector<std::size_t>  m_parent;
+  std::vector<std::int64_t> m_weight;
+  std::vector<std::size_t>  m_depth;
+};
+
+namespace detail {
+/*!
+ * \brief Builds a Gomory-Hu tree with Gusfield's algorithm.
+ * \param network The network of an undirected graph, every edge of which is
+ *                present in both directions.
+ * \return The tree.
+ **/
+[[nodiscard]] GomoryHuTree gusfield(ResidualNetwork& network);
+} // namespace detail
+
+/*!
+ * \brief Builds a Gomory-Hu tree of an undirected graph.
+ * \param graph The graph whose edges are associated with their capacities.
+ * \return The Gomory-Hu tree.
+ * \note Uses Gusfield's algorithm, which runs V - 1 push-relabel maximum
+ *       flow computations on the original graph. The flows are computed one
+ *       after another, as the endpoints of every flow depend on the cuts
+ *       found before.
+ **/
+template<typename Implementation, typename VertexData, typename Maps>
+[[nodiscard]] GomoryHuTree gomoryHuTree(
+  const Graph<
+    Directionality::Undirected,
+    Implementation,
+    VertexData,
+    std::int32_t,
+    Maps>&
+    graph)
+{
+  G_ASSERT(graph.hasVertices(), "%s", "The graph given had no vertices.");
+
+  ResidualNetwork network{makeResidualNetwork(graph)};
+  return detail::gusfield(network);
+}
+} // namespace g::algo
+#endif // INCG_G_ALGO_GOMORY_HU_TREE_HPP
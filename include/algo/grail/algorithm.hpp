@@ -0,0 +1,175 @@
+#ifndef INCG_G_ALGO_GRAIL_ALGORITHM_HPP
+#define INCG_G_ALGO_GRAIL_ALGORITHM_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "algo/condensation.hpp"
+#include "algo/indexed_adjacency.hpp"
+#include "algo/vertex_index.hpp"
+#include "graph.hpp"
+#include "thread_team.hpp"
+
+namespace g::algo::grail {
+/*!
+ * \brief What a single randomized depth first search over the components
+ *        tells about one component.
+ *
+ * Components are numbered by the search in post order. A component that
+ * reaches another one has a `rank` at least as large and a `low` at most as
+ * large, so a component whose interval [low, rank] does not contain the one
+ * of another component can't reach it. A component whose interval
+ * [first, rank] of the search tree contains the rank of another one does
+ * reach it.
+ **/
+struct Label {
+  std::uint32_t low;   /*!< The smallest rank of all components reached */
+  std::uint32_t first; /*!< The smallest rank in the search tree below */
+  std::uint32_t rank;  /*!< The post order number */
+};
+
+/*!
+ * \brief A reachability index in O(V + E + V * k) space, k being the count of
+ *        labelings.
+ *
+ * Answers most queries from the labels of the two components alone. The
+ * others fall back to a depth first search over the components that skips
+ * every component whose labels rule out reaching the target.
+ **/
+class ReachabilityIndex {
+public:
+  /*!
+   * \brief Creates a `ReachabilityIndex`.
+   * \param vertexIndex The vertices.
+   * \param condensation The components of the graph.
+   * \param labelingCount The count of labelings.
+   * \param labels The labels, the ones of component c beginning at
+   *               c * labelingCount.
+   **/
+  ReachabilityIndex(
+    VertexIndex        vertexIndex,
+    Condensation       condensation,
+    std::size_t        labelingCount,
+    std::vector<Label> labels);
+
+  /*!
+   * \brief Read accessor for the mapping of vertices to dense indices.
+   * \return The vertex index.
+   **/
+  [[nodiscard]] const VertexIndex& vertexIndex() const;
+
+  /*!
+   * \brief Read accessor for the components of the graph.
+   * \return The condensation.
+   **/
+  [[nodiscard]] const Condensation& condensation() const;
+
+  [[nodiscard]] std::size_t labelingCount() const;
+
+  /*!
+   * \brief Fetches the labels of a component.
+   * \param component The component.
+   * \return One label per labeling.
+   **/
+  [[nodiscard]] std::span<const Label> labelsOf(std::size_t component) const;
+
+  /*!
+   * \brief Determines whether there is a path from `source` to `target`.
+   * \param source The vertex to start at.
+   * \param target The vertex to go to.
+   * \return true if `target` is reachable from `source`; otherwise false.
+   * \throws GraphException if either vertex is not part of the graph.
+   * \note Not const, as the fallback search keeps its marks in the index.
+   **/
+  [[nodiscard]] bool reaches(VertexIdentifier source, VertexIdentifier target);
+
+  /*!
+   * \brief Determines whether there is a path between two vertices given by
+   *        their dense indices.
+   * \param source The dense index of the vertex to start at.
+   * \param target The dense index of the vertex to go to.
+   * \return true if `target` is reachable from `source`; otherwise false.
+   **/
+  [[nodiscard]] bool reachesByIndex(std::size_t source, std::size_t target);
+
+private:
+  enum class Verdict { No, Yes, Maybe };
+
+  /*!
+   * \brief Compares the labels of two components.
+   * \param source The component to start at.
+   * \param target The component to go to.
+   * \return Whether the labels prove or rule out that `source` reaches
+   *         `target`.
+   **/
+  [[nodiscard]] Verdict compare(std::size_t source, std::size_t target) const;
+
+  VertexIndex                m_vertexIndex;
+  Condensation               m_condensation;
+  std::size_t                m_labelingCount;
+  std::vector<Label>         m_labels;
+  std::vector<std::uint32_t> m_visited; /*!< Search numbers by component */
+  std::uint32_t              m_search;  /*!< The number of the last search */
+  std::vector<std::size_t>   m_stack;
+};
+
+namespace detail {
+/*!
+ * \brief Labels the components with randomized depth first searches.
+ * \param condensation The components.
+ * \param labelingCount The count of searches.
+ * \param team The threads to run the searches on, one search per thread at
+ *             a time.
+ * \return The labels, the ones of component c beginning at
+ *         c * labelingCount.
+ * \note Every search starts at the components without predecessors in a
+ *       random order and follows the arcs of every component beginning at a
+ *       random one. The i-th search is seeded with i, so the labels don't
+ *       depend on the count of threads.
+ **/
+[[nodiscard]] std::vector<Label> label(
+  const Condensation& condensation,
+  std::size_t         labelingCount,
+  ThreadTeam&         team);
+} // namespace detail
+
+/*!
+ * \brief Builds a GRAIL reachability index of a graph.
+ * \param graph The graph.
+ * \param labelingCount The count of labelings. More labelings answer more
+ *                      queries without a search but take more space.
+ * \param threadCount The count of threads to build the labelings with.
+ * \return The reachability index.
+ * \note Takes O(k * (V + E)) time, where k is `labelingCount`. Suits graphs
+ *       too large for the V^2 bits of a
+ *       `transitive_closure::TransitiveClosure`.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename EdgeData,
+  typename Maps>
+[[nodiscard]] ReachabilityIndex algorithm(
+  const Graph<TheDirectionality, Implementation, VertexData, EdgeData, Maps>&
+              graph,
+  std::size_t labelingCount = 3,
+  std::size_t threadCount   = defaultThreadCount())
+{
+  const IndexedAdjacency adjacency{makeIndexedAdjacency(graph)};
+  Condensation           condensation{adjacency};
+  ThreadTeam             team{threadCount};
+  std::vector<Label>     labels{
+    detail::label(condensation, labelingCount, team)};
+
+  return ReachabilityIndex{
+    adjacency.vertexIndex(),
+    std::move(condensation),
+    labelingCount,
+    std::move(labels)};
+}
+} // namespace g::algo::grail
+#endif // INCG_G_ALGO_GRAIL_ALGORITHM_HPP
@@ -0,0 +1,90 @@
+#ifndef INCG_G_ALGO_HOPCROFT_KARP_ALGORITHM_HPP
+#define INCG_G_ALGO_HOPCROFT_KARP_ALGORITHM_HPP
+#include <vector>
+
+#include "algo/hopcroft_karp/matching.hpp"
+#include "algo/vertex_index.hpp"
+#include "edge.hpp"
+#include "graph.hpp"
+
+namespace g::algo::hopcroft_karp {
+namespace detail {
+/*!
+ * \brief Colours the vertices of a graph with two colours so that no edge
+ *        connects two vertices of the same colour.
+ * \param vertexIndex The vertices.
+ * \param edges The edges, whose direction is ignored.
+ * \return The left vertices, that is the vertices of one colour.
+ * \throws GraphException if the graph is not bipartite.
+ **/
+[[nodiscard]] std::vector<VertexIdentifier> colourBipartite(
+  const VertexIndex&       vertexIndex,
+  const std::vector<Edge>& edges);
+
+/*!
+ * \brief Computes a maximum matching of a bipartite graph.
+ * \param vertexIndex The vertices.
+ * \param leftVertices The vertices on the left side, all others are on the
+ *                     right side.
+ * \param edges The edges, whose direction is ignored.
+ * \return The maximum matching.
+ * \throws GraphException if an edge connects two vertices on the same side
+ *                        or a left vertex is not in `vertexIndex`.
+ * \note Starts from a Karp-Sipser matching and augments along maximal sets
+ *       of vertex disjoint shortest augmenting paths in O(E * sqrt(V)).
+ **/
+[[nodiscard]] Matching maximumMatching(
+  const VertexIndex&                   vertexIndex,
+  const std::vector<VertexIdentifier>& leftVertices,
+  const std::vector<Edge>&             edges);
+} // namespace detail
+
+/*!
+ * \brief Computes a maximum matching of a bipartite graph.
+ * \param graph The graph. Edges are used regardless of their direction.
+ * \param leftVertices The vertices on the left side, all other vertices are
+ *                     on the right side.
+ * \return The maximum matching, whose edges lead from left to right.
+ * \throws GraphException if an edge connects two vertices on the same side.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename EdgeData,
+  typename Maps>
+[[nodiscard]] Matching algorithm(
+  const Graph<TheDirectionality, Implementation, VertexData, EdgeData, Maps>&
+    graph,
+  const std::vector<VertexIdentifier>& leftVertices)
+{
+  return detail::maximumMatching(
+    VertexIndex{graph.vertices()},
+    leftVertices,
+    graph.edgesUndirectedWithReverseEdges());
+}
+
+/*!
+ * \brief Computes a maximum matching of a bipartite graph whose sides are
+ *        determined by two-colouring it.
+ * \param graph The graph. Edges are used regardless of their direction.
+ * \return The maximum matching, whose edges lead from left to right.
+ * \throws GraphException if `graph` is not bipartite.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename EdgeData,
+  typename Maps>
+[[nodiscard]] Matching algorithm(
+  const Graph<TheDirectionality, Implementation, VertexData, EdgeData, Maps>&
+    graph)
+{
+  const VertexIndex       vertexIndex{graph.vertices()};
+  const std::vector<Edge> edges{graph.edgesUndirectedWithReverseEdges()};
+  return detail::maximumMatching(
+    vertexIndex, detail::colourBipartite(vertexIndex, edges), edges);
+}
+} // namespace g::algo::hopcroft_karp
+#endif // INCG_G_ALGO_HOPCROFT_KARP_ALGORITHM_HPP
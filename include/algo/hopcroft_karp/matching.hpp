@@ -0,0 +1,50 @@
+#ifndef INCG_G_ALGO_HOPCROFT_KARP_MATCHING_HPP
+#define INCG_G_ALGO_HOPCROFT_KARP_MATCHING_HPP
+#include <cstddef>
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "edge.hpp"
+#include "vertex_identifier.hpp"
+
+namespace g::algo::hopcroft_karp {
+/*!
+ * \brief A matching of a bipartite graph.
+ **/
+class Matching {
+public:
+  /*!
+   * \brief Creates a `Matching`.
+   * \param edges The matched edges, each from a left vertex to a right
+   *              vertex. No two edges may share a vertex.
+   **/
+  explicit Matching(std::vector<Edge> edges);
+
+  /*!
+   * \brief Returns the count of matched edges.
+   * \return The cardinality of the matching.
+   **/
+  [[nodiscard]] std::size_t size() const;
+
+  /*!
+   * \brief Read accessor for the matched edges.
+   * \return The matched edges, sorted by their left vertex.
+   **/
+  [[nodiscard]] const std::vector<Edge>& edges() const;
+
+  /*!
+   * \brief Fetches the vertex that `vertex` is matched with.
+   * \param vertex The vertex.
+   * \return The mate of `vertex` or nullopt if `vertex` is unmatched.
+   **/
+  [[nodiscard]] std::optional<VertexIdentifier> mateOf(
+    VertexIdentifier vertex) const;
+
+private:
+  std::vector<Edge>                                      m_edges;
+  std::unordered_map<VertexIdentifier, VertexIdentifier> m_mate;
+};
+} // namespace g::algo::hopcroft_karp
+#endif // INCG_G_ALGO_HOPCROFT_KARP_MATCHING_HPP
@@ -0,0 +1,141 @@
+#ifndef INCG_G_ALGO_INCREMENTAL_MAX_FLOW_HPP
+#define INCG_G_ALGO_INCREMENTAL_MAX_FLOW_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <vector>
+
+#include "algo/ford_fulkerson/algorithm.hpp"
+#include "algo/residual_network.hpp"
+#include "directionality.hpp"
+#include "graph.hpp"
+
+namespace g::algo {
+/*!
+ * \brief A maximum flow that is kept up to date while capacities change.
+ *
+ * The maximum flow is computed once by push-relabel. Afterwards every
+ * capacity change repairs the flow starting at the endpoints of the changed
+ * edge: a decrease reroutes the flow that no longer fits around the edge
+ * and cancels what can't be rerouted, an increase augments along paths
+ * through the edge. The searches stop as soon as they find their target, so
+ * that small changes touch only a small part of the network.
+ **/
+class IncrementalMaxFlow {
+public:
+  /*!
+   * \brief Creates an `IncrementalMaxFlow` and computes the maximum flow.
+   * \param network The network, which should carry no flow.
+   * \param source The source vertex.
+   * \param sink The sink vertex.
+   * \param directionality Whether the edges of `network` stem from an
+   *                       undirected graph, in which case the capacities of
+   *                       an edge and its reverse edge are changed together.
+   * \throws GraphException if `source` is `sink`.
+   **/
+  IncrementalMaxFlow(
+    ResidualNetwork  network,
+    VertexIdentifier source,
+    VertexIdentifier sink,
+    Directionality   directionality);
+
+  /*!
+   * \brief Read accessor for the network carrying the flow.
+   * \return The network.
+   **/
+  [[nodiscard]] const ResidualNetwork& network() const;
+
+  /*!
+   * \brief Returns the value of the current maximum flow.
+   * \return The value of the maximum flow.
+   **/
+  [[nodiscard]] std::int64_t maxFlow() const;
+
+  /*!
+   * \brief Creates a `ford_fulkerson::Result` of the current maximum flow.
+   * \return The result. The flow map only contains the edges of the network
+   *         and their reverse edges.
+   **/
+  [[nodiscard]] ford_fulkerson::Result result() const;
+
+  /*!
+   * \brief Changes the capacity of the edge from `source` to `target` and
+   *        restores a maximum flow.
+   * \param source The source vertex of the edge.
+   * \param target The target vertex of the edge.
+   * \param capacity The new capacity.
+   * \throws GraphException if there is no such edge or `capacity` is
+   *                        negative.
+   **/
+  void setCapacity(
+    VertexIdentifier source,
+    VertexIdentifier target,
+    std::int64_t     capacity);
+
+private:
+  enum class Search { FromStart, FromGoal };
+
+  void changeCapacity(std::size_t arc, std::int64_t capacity);
+
+  void increaseCapacity(std::size_t arc);
+
+  void decreaseCapacity(std::size_t arc);
+
+  std::int64_t route(
+    std::size_t  start,
+    std::size_t  goal,
+    std::int64_t limit,
+    Search       search);
+
+  [[nodiscard]] bool findPath(
+    std::size_t               start,
+    std::size_t               goal,
+    Search                    search,
+    std::vector<std::size_t>& path);
+
+  [[nodiscard]] std::int64_t bottleneck(
+    const std::vector<std::size_t>& path) const;
+
+  void push(const std::vector<std::size_t>& path, std::int64_t amount);
+
+  ResidualNetwork            m_network;
+  std::size_t                m_source;
+  std::size_t                m_sink;
+  Directionality             m_directionality;
+  std::vector<std::uint64_t> m_visited; /*!< Search stamp per vertex */
+  std::uint64_t              m_stamp;
+  std::vector<std::size_t>   m_parentArc;
+  std::vector<std::size_t>   m_queue;
+  std::vector<std::size_t>   m_path;
+  std::vector<std::size_t>   m_otherPath;
+};
+
+/*!
+ * \brief Creates an `IncrementalMaxFlow` for a graph whose edges are
+ *        associated with their capacities.
+ * \param graph The graph.
+ * \param source The source vertex.
+ * \param sink The sink vertex.
+ * \return The incremental maximum flow.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename Maps>
+[[nodiscard]] IncrementalMaxFlow makeIncrementalMaxFlow(
+  const Graph<
+    TheDirectionality,
+    Implementation,
+    VertexData,
+    std::int32_t,
+    Maps>&
+                   graph,
+  VertexIdentifier source,
+  VertexIdentifier sink)
+{
+  return IncrementalMaxFlow{
+    makeResidualNetwork(graph), source, sink, TheDirectionality};
+}
+} // namespace g::algo
+#endif // INCG_G_ALGO_INCREMENTAL_MAX_FLOW_HPP
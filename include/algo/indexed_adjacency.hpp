@@ -0,0 +1,139 @@
+#ifndef INCG_G_ALGO_INDEXED_ADJACENCY_HPP
+#define INCG_G_ALGO_INDEXED_ADJACENCY_HPP
+#include <cstddef>
+
+#include <algorithm>
+#include <vector>
+
+#include "algo/vertex_index.hpp"
+#include "directionality.hpp"
+#include "edge.hpp"
+#include "graph.hpp"
+
+namespace g::algo {
+/*!
+ * \brief An immutable adjacency structure in compressed sparse row form in
+ *        which every edge has a dense identifier.
+ *
+ * Every arc leaving a vertex stores its target and the identifier of its
+ * edge. An undirected edge is reachable from both of its endpoints through
+ * two arcs sharing one identifier, so that algorithms can mark edges as
+ * used in a flat array instead of removing them from a `Graph`.
+ **/
+class IndexedAdjacency {
+public:
+  /*!
+   * \brief Creates an `IndexedAdjacency`.
+   * \param vertexIndex The vertices.
+   * \param edges The edges. Each gets the identifier of its position.
+   * \param directionality If `Undirected` every edge also gets an arc from
+   *                       its target back to its source, except for loops.
+   **/
+  IndexedAdjacency(
+    VertexIndex              vertexIndex,
+    const std::vector<Edge>& edges,
+    Directionality           directionality);
+
+  /*!
+   * \brief Read accessor for the mapping of vertices to dense indices.
+   * \return The vertex index.
+   **/
+  [[nodiscard]] const VertexIndex& vertexIndex() const;
+
+  [[nodiscard]] std::size_t vertexCount() const;
+
+  [[nodiscard]] std::size_t edgeCount() const;
+
+  [[nodiscard]] std::size_t arcCount() const;
+
+  /*!
+   * \brief Creates the transpose, in which every arc is reversed.
+   * \return An `IndexedAdjacency` whose arcs leaving a vertex are the arcs
+   *         entering that vertex in this one. Arcs keep their edge
+   *         identifier.
+   * \note The transpose of an undirected adjacency has the same arcs.
+   **/
+  [[nodiscard]] IndexedAdjacency transposed() const;
+
+  /*!
+   * \brief Returns the first arc leaving `vertex`.
+   * \param vertex The dense index of the vertex.
+   * \return The first arc leaving `vertex`.
+   **/
+  [[nodiscard]] std::size_t firstArc(std::size_t vertex) const
+  {
+    return m_firstArc[vertex];
+  }
+
+  /*!
+   * \brief Returns one past the last arc leaving `vertex`.
+   * \param vertex The dense index of the vertex.
+   * \return One past the last arc leaving `vertex`.
+   **/
+  [[nodiscard]] std::size_t lastArc(std::size_t vertex) const
+  {
+    return m_firstArc[vertex + 1];
+  }
+
+  /*!
+   * \brief Returns the vertex that `arc` leads to.
+   * \param arc The arc.
+   * \return The dense index of the target of `arc`.
+   **/
+  [[nodiscard]] std::size_t target(std::size_t arc) const
+  {
+    return m_target[arc];
+  }
+
+  /*!
+   * \brief Returns the identifier of the edge of `arc`.
+   * \param arc The arc.
+   * \return The identifier of the edge, in [0, edgeCount()).
+   **/
+  [[nodiscard]] std::size_t edgeId(std::size_t arc) const
+  {
+    return m_edgeId[arc];
+  }
+
+private:
+  IndexedAdjacency(VertexIndex vertexIndex, std::size_t edgeCount);
+
+  VertexIndex              m_vertexIndex;
+  std::size_t              m_edgeCount;
+  std::vector<std::size_t> m_firstArc; /*!< CSR offsets, one per vertex + 1 */
+  std::vector<std::size_t> m_target;
+  std::vector<std::size_t> m_edgeId;
+};
+
+/*!
+ * \brief Creates an `IndexedAdjacency` from a `Graph`.
+ * \param graph The graph.
+ * \return The indexed adjacency. Every undirected edge of `graph` is a single
+ *         edge.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename EdgeData,
+  typename Maps>
+[[nodiscard]] IndexedAdjacency makeIndexedAdjacency(
+  const Graph<TheDirectionality, Implementation, VertexData, EdgeData, Maps>&
+    graph)
+{
+  std::vector<Edge> edges{graph.edgesUndirectedWithReverseEdges()};
+
+  if constexpr (TheDirectionality == Directionality::Undirected) {
+    edges.erase(
+      std::remove_if(
+        edges.begin(),
+        edges.end(),
+        [](const Edge& edge) { return edge.source() > edge.target(); }),
+      edges.end());
+  }
+
+  return IndexedAdjacency{
+    VertexIndex{graph.vertices()}, edges, TheDirectionality};
+}
+} // namespace g::algo
+#endif // INCG_G_ALGO_INDEXED_ADJACENCY_HPP
@@ -0,0 +1,175 @@
+#ifndef INCG_G_ALGO_MIN_COST_FLOW_ALGORITHM_HPP
+#define INCG_G_ALGO_MIN_COST_FLOW_ALGORITHM_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <iosfwd>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "algo/min_cost_flow/capacity_and_cost.hpp"
+#include "algo/residual_network.hpp"
+#include "assert.hpp"
+#include "edge.hpp"
+#include "graph.hpp"
+
+namespace g::algo::min_cost_flow {
+/*!
+ * \brief The engines available to compute a minimum cost maximum flow.
+ **/
+enum class Engine {
+  SuccessiveShortestPaths, /*!< Dijkstra on reduced costs, for small flows. */
+  CostScaling /*!< Goldberg's cost scaling push-relabel, for large instances */
+};
+
+/*!
+ * \brief Prints an `Engine` enumerator.
+ * \param os The ostream to print to.
+ * \param engine The `Engine` enumerator to print.
+ * \return `os`.
+ **/
+std::ostream& operator<<(std::ostream& os, Engine engine);
+
+/*!
+ * \brief The result of a minimum cost maximum flow computation.
+ **/
+class Result {
+public:
+  /*!
+   * \brief Creates a `Result`.
+   * \param maxFlow The value of the maximum flow.
+   * \param totalCost The total cost of the flow.
+   * \param flow The flow of every edge.
+   **/
+  Result(
+    std::int64_t                                  maxFlow,
+    std::int64_t                                  totalCost,
+    const std::unordered_map<Edge, std::int32_t>& flow);
+
+  [[nodiscard]] std::int64_t maxFlow() const;
+
+  [[nodiscard]] std::int64_t totalCost() const;
+
+  /*!
+   * \brief Read accessor for the flow of every edge.
+   * \return The flow sent along every edge of the graph.
+   **/
+  [[nodiscard]] const std::unordered_map<Edge, std::int32_t>& flow() const;
+
+private:
+  std::int64_t                           m_maxFlow;
+  std::int64_t                           m_totalCost;
+  std::unordered_map<Edge, std::int32_t> m_flow;
+};
+
+namespace detail {
+/*!
+ * \brief Sends a maximum flow of minimum cost from `source` to `sink` along
+ *        successive shortest paths.
+ * \param network The network, which should carry no flow.
+ * \param cost The cost of every arc of `network`; reverse arcs cost the
+ *             negated cost of their forward arc.
+ * \param source The dense index of the source.
+ * \param sink The dense index of the sink.
+ * \throws GraphException if there is a negative cost cycle.
+ * \note Potentials are initialized by Bellman-Ford if there are negative
+ *       costs and maintained with Johnson's reweighting, so that every
+ *       shortest path is found by Dijkstra's algorithm.
+ **/
+void successiveShortestPaths(
+  ResidualNetwork&                 network,
+  const std::vector<std::int64_t>& cost,
+  std::size_t                      source,
+  std::size_t                      sink);
+
+/*!
+ * \brief Sends a maximum flow of minimum cost from `source` to `sink` with
+ *        the cost scaling push-relabel method.
+ * \param network The network, which should carry no flow.
+ * \param cost The cost of every arc of `network`; reverse arcs cost the
+ *             negated cost of their forward arc.
+ * \param source The dense index of the source.
+ * \param sink The dense index of the sink.
+ * \note A maximum flow is computed by push-relabel first and then turned
+ *       into one of minimum cost by successive epsilon refinements. Unlike
+ *       `successiveShortestPaths` negative cost cycles are saturated rather
+ *       than reported.
+ **/
+void costScaling(
+  ResidualNetwork&                 network,
+  const std::vector<std::int64_t>& cost,
+  std::size_t                      source,
+  std::size_t                      sink);
+
+/*!
+ * \brief Creates a `Result` from a network carrying a minimum cost flow.
+ * \param network The network.
+ * \param cost The cost of every arc of `network`.
+ * \param source The dense index of the source.
+ * \return The result.
+ **/
+[[nodiscard]] Result makeResult(
+  const ResidualNetwork&           network,
+  const std::vector<std::int64_t>& cost,
+  std::size_t                      source);
+} // namespace detail
+
+/*!
+ * \brief Computes a maximum flow of minimum total cost.
+ * \param graph The graph whose edges are associated with their capacities
+ *              and costs.
+ * \param source The source vertex.
+ * \param sink The sink vertex.
+ * \param engine The engine to use.
+ * \return The flow of every edge and the total cost.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename Maps>
+[[nodiscard]] Result algorithm(
+  const Graph<
+    TheDirectionality,
+    Implementation,
+    VertexData,
+    CapacityAndCost,
+    Maps>&
+                   graph,
+  VertexIdentifier source,
+  VertexIdentifier sink,
+  Engine           engine = Engine::SuccessiveShortestPaths)
+{
+  ResidualNetwork network{makeResidualNetwork(
+    graph, [](const CapacityAndCost& data) { return data.capacity(); })};
+  std::vector<std::int64_t> cost(network.arcCount(), 0);
+
+  for (std::size_t i{0}; i < network.edgeCount(); ++i) {
+    const Edge&                          edge{network.edgeAt(i)};
+    const std::optional<CapacityAndCost> data{
+      graph.fetchEdgeData(edge.source(), edge.target())};
+    G_ASSERT(
+      data.has_value(),
+      "Couldn't find edge data for edge from %zu to %zu",
+      edge.source(),
+      edge.target());
+    const std::size_t arc{network.arcOfEdge(i)};
+    cost[arc]                   = data->cost();
+    cost[network.reverse(arc)] = -data->cost();
+  }
+
+  const std::size_t sourceIndex{network.vertexIndex().indexOf(source)};
+  const std::size_t sinkIndex{network.vertexIndex().indexOf(sink)};
+
+  if (engine == Engine::SuccessiveShortestPaths) {
+    detail::successiveShortestPaths(network, cost, sourceIndex, sinkIndex);
+  }
+  else {
+    detail::costScaling(network, cost, sourceIndex, sinkIndex);
+  }
+
+  return detail::makeResult(network, cost, sourceIndex);
+}
+} // namespace g::algo::min_cost_flow
+#endif // INCG_G_ALGO_MIN_COST_FLOW_ALGORITHM_HPP
@@ -0,0 +1,41 @@
+#ifndef INCG_G_ALGO_MIN_COST_FLOW_CAPACITY_AND_COST_HPP
+#define INCG_G_ALGO_MIN_COST_FLOW_CAPACITY_AND_COST_HPP
+#include <cstdint>
+
+#include <iosfwd>
+
+namespace g::algo::min_cost_flow {
+/*!
+ * \brief The edge data used for minimum cost flow problems.
+ **/
+class CapacityAndCost {
+public:
+  /*!
+   * \brief Prints a `CapacityAndCost` to an ostream.
+   * \param os The ostream to print to.
+   * \param capacityAndCost The `CapacityAndCost` to print.
+   * \return `os`.
+   **/
+  friend std::ostream& operator<<(
+    std::ostream&          os,
+    const CapacityAndCost& capacityAndCost);
+
+  friend bool operator==(const CapacityAndCost& lhs, const CapacityAndCost& rhs);
+
+  /*!
+   * \brief Creates a `CapacityAndCost`.
+   * \param capacity The capacity of the edge.
+   * \param cost The cost per unit of flow sent along the edge.
+   **/
+  CapacityAndCost(std::int32_t capacity, std::int64_t cost);
+
+  [[nodiscard]] std::int32_t capacity() const;
+
+  [[nodiscard]] std::int64_t cost() const;
+
+private:
+  std::int32_t m_capacity;
+  std::int64_t m_cost;
+};
+} // namespace g::algo::min_cost_flow
+#endif // INCG_G_ALGO_MIN_COST_FLOW_CAPACITY_AND_COST_HPP
@@ -0,0 +1,124 @@
+#ifndef INCG_G_ALGO_MULTI_SOURCE_BFS_ALGORITHM_HPP
+#define INCG_G_ALGO_MULTI_SOURCE_BFS_ALGORITHM_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "algo/indexed_adjacency.hpp"
+#include "algo/vertex_index.hpp"
+#include "graph.hpp"
+
+namespace g::algo::multi_source_bfs {
+/*!
+ * \brief The hop distances from a list of sources to every vertex, one row
+ *        per source.
+ **/
+class DistanceMatrix {
+public:
+  /*!
+   * \brief The distance of vertices that can't be reached.
+   **/
+  static constexpr std::uint32_t unreachable{UINT32_MAX};
+
+  /*!
+   * \brief Creates a `DistanceMatrix`.
+   * \param vertexIndex The vertices.
+   * \param sources The sources, one per row.
+   * \param distances The rows, each holding the distance to every vertex by
+   *                  dense index.
+   **/
+  DistanceMatrix(
+    VertexIndex                   vertexIndex,
+    std::vector<VertexIdentifier> sources,
+    std::vector<std::uint32_t>    distances);
+
+  /*!
+   * \brief Read accessor for the mapping of vertices to dense indices, which
+   *        are the columns.
+   * \return The vertex index.
+   **/
+  [[nodiscard]] const VertexIndex& vertexIndex() const;
+
+  /*!
+   * \brief Read accessor for the sources.
+   * \return The source of every row.
+   **/
+  [[nodiscard]] const std::vector<VertexIdentifier>& sources() const;
+
+  /*!
+   * \brief Fetches the distances of one source.
+   * \param row The row, that is the position of the source in `sources()`.
+   * \return The distance to every vertex by dense index, `unreachable` for
+   *         vertices that can't be reached.
+   **/
+  [[nodiscard]] std::span<const std::uint32_t> row(std::size_t row) const;
+
+  /*!
+   * \brief Fetches the count of edges on a shortest path.
+   * \param row The row, that is the position of the source in `sources()`.
+   * \param target The vertex to go to.
+   * \return The hop distance or nullopt if `target` can't be reached.
+   **/
+  [[nodiscard]] std::optional<std::size_t> distance(
+    std::size_t      row,
+    VertexIdentifier target) const;
+
+private:
+  VertexIndex                   m_vertexIndex;
+  std::vector<VertexIdentifier> m_sources;
+  std::vector<std::uint32_t>    m_distances;
+};
+
+namespace detail {
+/*!
+ * \brief Computes the hop distances from every source in `sources`.
+ * \param adjacency The graph.
+ * \param sources The dense indices of the sources.
+ * \return The distance from every source to every vertex, the row of the
+ *         i-th source beginning at i * adjacency.vertexCount().
+ * \note Runs 64 searches at once, one per bit of a word. Every vertex keeps
+ *       a word of the searches that have seen it and a word of the searches
+ *       for which it is in the frontier, so that scanning its arcs once
+ *       advances all of these searches together.
+ **/
+[[nodiscard]] std::vector<std::uint32_t> hopDistances(
+  const IndexedAdjacency&         adjacency,
+  const std::vector<std::size_t>& sources);
+} // namespace detail
+
+/*!
+ * \brief Computes the hop distances from many sources with a bit parallel
+ *        multi source breadth first search.
+ * \param graph The graph.
+ * \param sources The sources.
+ * \return The distances, a row for every source in the order given.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename EdgeData,
+  typename Maps>
+[[nodiscard]] DistanceMatrix algorithm(
+  const Graph<TheDirectionality, Implementation, VertexData, EdgeData, Maps>&
+                                graph,
+  std::vector<VertexIdentifier> sources)
+{
+  const IndexedAdjacency   adjacency{makeIndexedAdjacency(graph)};
+  std::vector<std::size_t> sourceIndices(sources.size());
+
+  for (std::size_t i{0}; i < sources.size(); ++i) {
+    sourceIndices[i] = adjacency.vertexIndex().indexOf(sources[i]);
+  }
+
+  return DistanceMatrix{
+    adjacency.vertexIndex(),
+    std::move(sources),
+    detail::hopDistances(adjacency, sourceIndices)};
+}
+} // namespace g::algo::multi_source_bfs
+#endif // INCG_G_ALGO_MULTI_SOURCE_BFS_ALGORITHM_HPP
@@ -0,0 +1,98 @@
+#ifndef INCG_G_ALGO_PUSH_RELABEL_ALGORITHM_HPP
+#define INCG_G_ALGO_PUSH_RELABEL_ALGORITHM_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <iosfwd>
+
+#include "algo/ford_fulkerson/algorithm.hpp"
+#include "algo/residual_network.hpp"
+#include "graph.hpp"
+
+namespace g::algo::push_relabel {
+/*!
+ * \brief The rule used to select the next active vertex to discharge.
+ **/
+enum class SelectionRule {
+  HighestLabel, /*!< Discharge an active vertex with the highest label. */
+  Fifo          /*!< Discharge the active vertices in first in first out order. */
+};
+
+/*!
+ * \brief Prints a `SelectionRule` enumerator.
+ * \param os The ostream to print to.
+ * \param rule The `SelectionRule` enumerator to print.
+ * \return `os`.
+ **/
+std::ostream& operator<<(std::ostream& os, SelectionRule rule);
+
+namespace detail {
+/*!
+ * \brief Computes a maximum preflow from `source` to `sink`.
+ * \param network The network to route the preflow through; should carry no
+ *                flow.
+ * \param source The dense index of the source.
+ * \param sink The dense index of the sink.
+ * \param rule The selection rule.
+ * \return The value of the maximum flow, that is the excess of `sink`.
+ * \note Uses the gap heuristic and periodic global relabeling by a reverse
+ *       breadth first search from `sink`.
+ **/
+[[nodiscard]] std::int64_t maximumPreflow(
+  ResidualNetwork& network,
+  std::size_t      source,
+  std::size_t      sink,
+  SelectionRule    rule);
+
+/*!
+ * \brief Turns a preflow into a flow by returning the excess of every vertex
+ *        other than `source` and `sink` back to `source`.
+ * \param network The network carrying a preflow.
+ * \param source The dense index of the source.
+ * \param sink The dense index of the sink.
+ **/
+void convertPreflowToFlow(
+  ResidualNetwork& network,
+  std::size_t      source,
+  std::size_t      sink);
+} // namespace detail
+
+/*!
+ * \brief Computes a maximum flow with the push-relabel method.
+ * \param graph The graph whose edges are associated with their capacities.
+ * \param source The source vertex.
+ * \param sink The sink vertex.
+ * \param rule The rule used to select the next vertex to discharge.
+ * \return The maximum flow. Unlike `ford_fulkerson::algorithm` the flow map
+ *         only contains the edges of `graph` and their reverse edges.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename Maps>
+[[nodiscard]] ford_fulkerson::Result algorithm(
+  const Graph<
+    TheDirectionality,
+    Implementation,
+    VertexData,
+    std::int32_t,
+    Maps>&
+                   graph,
+  VertexIdentifier source,
+  VertexIdentifier sink,
+  SelectionRule    rule = SelectionRule::HighestLabel)
+{
+  ResidualNetwork   network{makeResidualNetwork(graph)};
+  const std::size_t sourceIndex{network.vertexIndex().indexOf(source)};
+  const std::size_t sinkIndex{network.vertexIndex().indexOf(sink)};
+
+  const std::int64_t maxFlow{
+    detail::maximumPreflow(network, sourceIndex, sinkIndex, rule)};
+  detail::convertPreflowToFlow(network, sourceIndex, sinkIndex);
+
+  return ford_fulkerson::Result{
+    static_cast<std::int32_t>(maxFlow), network.flowMap()};
+}
+} // namespace g::algo::push_relabel
+#endif // INCG_G_ALGO_PUSH_RELABEL_ALGORITHM_HPP
@@ -0,0 +1,78 @@
+#ifndef INCG_G_ALGO_PUSH_RELABEL_PARALLEL_ALGORITHM_HPP
+#define INCG_G_ALGO_PUSH_RELABEL_PARALLEL_ALGORITHM_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include "algo/ford_fulkerson/algorithm.hpp"
+#include "algo/push_relabel/algorithm.hpp"
+#include "algo/residual_network.hpp"
+#include "graph.hpp"
+#include "thread_team.hpp"
+
+namespace g::algo::push_relabel {
+namespace detail {
+/*!
+ * \brief Computes a maximum preflow from `source` to `sink` using all
+ *        threads of `team`.
+ * \param network The network to route the preflow through; should carry no
+ *                flow.
+ * \param source The dense index of the source.
+ * \param sink The dense index of the sink.
+ * \param team The threads to use.
+ * \return The value of the maximum flow, that is the excess of `sink`.
+ * \note Works in synchronous rounds. In every round all active vertices push
+ *       concurrently using the labels of the previous round, receiving
+ *       vertices accumulate their excess atomically, and then all vertices
+ *       that still have excess relabel concurrently. The global relabeling
+ *       is a level synchronous parallel breadth first search.
+ **/
+[[nodiscard]] std::int64_t parallelMaximumPreflow(
+  ResidualNetwork& network,
+  std::size_t      source,
+  std::size_t      sink,
+  ThreadTeam&      team);
+} // namespace detail
+
+/*!
+ * \brief Computes a maximum flow with a multi-threaded push-relabel method.
+ * \param graph The graph whose edges are associated with their capacities.
+ * \param source The source vertex.
+ * \param sink The sink vertex.
+ * \param threadCount The count of threads to use.
+ * \return The maximum flow. The flow map only contains the edges of `graph`
+ *         and their reverse edges.
+ * \note Only the maximum preflow is computed in parallel; returning the
+ *       excess of vertices that can't reach the sink to the source is
+ *       sequential.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename Maps>
+[[nodiscard]] ford_fulkerson::Result parallelAlgorithm(
+  const Graph<
+    TheDirectionality,
+    Implementation,
+    VertexData,
+    std::int32_t,
+    Maps>&
+                   graph,
+  VertexIdentifier source,
+  VertexIdentifier sink,
+  std::size_t      threadCount = defaultThreadCount())
+{
+  ResidualNetwork   network{makeResidualNetwork(graph)};
+  const std::size_t sourceIndex{network.vertexIndex().indexOf(source)};
+  const std::size_t sinkIndex{network.vertexIndex().indexOf(sink)};
+  ThreadTeam        team{threadCount};
+
+  const std::int64_t maxFlow{
+    detail::parallelMaximumPreflow(network, sourceIndex, sinkIndex, team)};
+  detail::convertPreflowToFlow(network, sourceIndex, sinkIndex);
+
+  return ford_fulkerson::Result{
+    static_cast<std::int32_t>(maxFlow), network.flowMap()};
+}
+} // namespace g::algo::push_relabel
+#endif // INCG_G_ALGO_PUSH_RELABEL_PARALLEL_ALGORITHM_HPP
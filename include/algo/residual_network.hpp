@@ -0,0 +1,285 @@
+#ifndef INCG_G_ALGO_RESIDUAL_NETWORK_HPP
+#define INCG_G_ALGO_RESIDUAL_NETWORK_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "algo/vertex_index.hpp"
+#include "assert.hpp"
+#include "edge.hpp"
+#include "graph.hpp"
+
+namespace g::algo {
+/*!
+ * \brief A flow network in compressed sparse row form.
+ *
+ * Every edge of the input is turned into a forward arc carrying its capacity
+ * and a reverse arc of capacity 0. The arcs leaving a vertex are stored
+ * contiguously, so that flow algorithms can scan them without hashing.
+ * Vertices are referred to by their dense index as given by `vertexIndex()`.
+ **/
+class ResidualNetwork {
+public:
+  /*!
+   * \brief Creates a `ResidualNetwork` carrying no flow.
+   * \param vertexIndex The vertices of the network.
+   * \param edges The edges of the network.
+   * \param capacities The capacities of `edges`, index by index.
+   **/
+  ResidualNetwork(
+    VertexIndex                      vertexIndex,
+    std::vector<Edge>                edges,
+    const std::vector<std::int64_t>& capacities);
+
+  /*!
+   * \brief Read accessor for the mapping of vertices to dense indices.
+   * \return The vertex index.
+   **/
+  [[nodiscard]] const VertexIndex& vertexIndex() const;
+
+  /*!
+   * \brief Returns the count of vertices.
+   * \return The count of vertices.
+   **/
+  [[nodiscard]] std::size_t vertexCount() const;
+
+  /*!
+   * \brief Returns the count of arcs, reverse arcs included.
+   * \return The count of arcs.
+   **/
+  [[nodiscard]] std::size_t arcCount() const;
+
+  /*!
+   * \brief Returns the count of input edges.
+   * \return The count of edges.
+   **/
+  [[nodiscard]] std::size_t edgeCount() const;
+
+  /*!
+   * \brief Read accessor for the input edge at `edgeIndex`.
+   * \param edgeIndex The index of the edge as passed to the constructor.
+   * \return The edge.
+   **/
+  [[nodiscard]] const Edge& edgeAt(std::size_t edgeIndex) const;
+
+  /*!
+   * \brief Returns the first arc leaving `vertex`.
+   * \param vertex The dense index of the vertex.
+   * \return The first arc leaving `vertex`.
+   **/
+  [[nodiscard]] std::size_t firstArc(std::size_t vertex) const;
+
+  /*!
+   * \brief Returns one past the last arc leaving `vertex`.
+   * \param vertex The dense index of the vertex.
+   * \return One past the last arc leaving `vertex`.
+   **/
+  [[nodiscard]] std::size_t lastArc(std::size_t vertex) const;
+
+  /*!
+   * \brief Returns the forward arc of the input edge at `edgeIndex`.
+   * \param edgeIndex The index of the edge as passed to the constructor.
+   * \return The forward arc.
+   **/
+  [[nodiscard]] std::size_t arcOfEdge(std::size_t edgeIndex) const;
+
+  /*!
+   * \brief Looks up the forward arc from `tail` to `head`.
+   * \param tail The dense index of the tail vertex.
+   * \param head The dense index of the head vertex.
+   * \return The first forward arc from `tail` to `head` or nullopt if there
+   *         is none.
+   **/
+  [[nodiscard]] std::optional<std::size_t> findArc(
+    std::size_t tail,
+    std::size_t head) const;
+
+  /*!
+   * \brief Returns the vertex that `arc` points to.
+   * \param arc The arc.
+   * \return The dense index of the head of `arc`.
+   **/
+  [[nodiscard]] std::size_t head(std::size_t arc) const
+  {
+    return m_head[arc];
+  }
+
+  /*!
+   * \brief Returns the arc paired with `arc`.
+   * \param arc The arc.
+   * \return The reverse arc of `arc`.
+   **/
+  [[nodiscard]] std::size_t reverse(std::size_t arc) const
+  {
+    return m_reverse[arc];
+  }
+
+  /*!
+   * \brief Determines whether `arc` is the forward arc of an input edge.
+   * \param arc The arc.
+   * \return true if `arc` is a forward arc; false if it is a reverse arc.
+   **/
+  [[nodiscard]] bool isForward(std::size_t arc) const
+  {
+    return m_isForward[arc];
+  }
+
+  /*!
+   * \brief Returns the capacity of `arc`.
+   * \param arc The arc.
+   * \return The capacity of `arc`, which is 0 for reverse arcs.
+   **/
+  [[nodiscard]] std::int64_t capacity(std::size_t arc) const
+  {
+    return m_capacity[arc];
+  }
+
+  /*!
+   * \brief Returns the residual capacity of `arc`.
+   * \param arc The arc.
+   * \return The residual capacity of `arc`.
+   **/
+  [[nodiscard]] std::int64_t residual(std::size_t arc) const
+  {
+    return m_residual[arc];
+  }
+
+  /*!
+   * \brief Returns the flow on `arc`.
+   * \param arc The arc.
+   * \return The flow on `arc`, which is negative for reverse arcs that
+   *         cancel flow.
+   **/
+  [[nodiscard]] std::int64_t flow(std::size_t arc) const
+  {
+    return m_capacity[arc] - m_residual[arc];
+  }
+
+  /*!
+   * \brief Sends `amount` units of flow along `arc`.
+   * \param arc The arc.
+   * \param amount The amount of flow, at most `residual(arc)`.
+   **/
+  void push(std::size_t arc, std::int64_t amount)
+  {
+    m_residual[arc] -= amount;
+    m_residual[m_reverse[arc]] += amount;
+  }
+
+  /*!
+   * \brief Changes the capacity of `arc`, keeping its flow.
+   * \param arc The arc.
+   * \param capacity The new capacity.
+   * \note The residual capacity of `arc` becomes negative if the new capacity
+   *       is less than the flow on `arc`; the caller has to repair that.
+   **/
+  void setCapacity(std::size_t arc, std::int64_t capacity);
+
+  /*!
+   * \brief Removes all flow from this network.
+   **/
+  void reset();
+
+  /*!
+   * \brief Determines the vertices that can reach `target` through arcs with
+   *        positive residual capacity.
+   * \param target The dense index of the target vertex.
+   * \return A flag per dense vertex index.
+   **/
+  [[nodiscard]] std::vector<bool> verticesReaching(std::size_t target) const;
+
+  /*!
+   * \brief Determines the vertices reachable from `source` through arcs with
+   *        positive residual capacity.
+   * \param source The dense index of the source vertex.
+   * \return A flag per dense vertex index.
+   **/
+  [[nodiscard]] std::vector<bool> verticesReachableFrom(
+    std::size_t source) const;
+
+  /*!
+   * \brief Creates the skew symmetric flow map of this network in the format
+   *        used by `ford_fulkerson::Result`.
+   * \return The net flow of every edge and its reverse.
+   **/
+  [[nodiscard]] std::unordered_map<Edge, std::int32_t> flowMap() const;
+
+private:
+  VertexIndex               m_vertexIndex;
+  std::vector<Edge>         m_edges;
+  std::vector<std::size_t>  m_firstArc; /*!< CSR offsets, one per vertex + 1 */
+  std::vector<std::size_t>  m_edgeArc;  /*!< Edge index to forward arc */
+  std::vector<std::size_t>  m_head;
+  std::vector<std::size_t>  m_reverse;
+  std::vector<std::int64_t> m_capacity;
+  std::vector<std::int64_t> m_residual;
+  std::vector<bool>         m_isForward;
+};
+
+/*!
+ * \brief Creates a `ResidualNetwork` from a `Graph`.
+ * \param graph The graph. Undirected edges become two arcs.
+ * \param capacityOf Callable that maps the `EdgeData` of an edge to its
+ *                   capacity.
+ * \return The residual network.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename EdgeData,
+  typename CapacityOf,
+  typename Maps>
+[[nodiscard]] ResidualNetwork makeResidualNetwork(
+  const Graph<TheDirectionality, Implementation, VertexData, EdgeData, Maps>&
+    graph,
+  CapacityOf capacityOf)
+{
+  std::vector<Edge> edges{graph.edgesUndirectedWithReverseEdges()};
+  std::vector<std::int64_t> capacities{};
+  capacities.reserve(edges.size());
+
+  for (const Edge& edge : edges) {
+    const std::optional<EdgeData> edgeData{
+      graph.fetchEdgeData(edge.source(), edge.target())};
+    G_ASSERT(
+      edgeData.has_value(),
+      "Couldn't find edge data for edge from %zu to %zu",
+      edge.source(),
+      edge.target());
+    capacities.push_back(static_cast<std::int64_t>(capacityOf(*edgeData)));
+  }
+
+  return ResidualNetwork{
+    VertexIndex{graph.vertices()}, std::move(edges), capacities};
+}
+
+/*!
+ * \brief Creates a `ResidualNetwork` from a `Graph` whose edges are
+ *        associated with their capacities.
+ * \param graph The graph.
+ * \return The residual network.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename Maps>
+[[nodiscard]] ResidualNetwork makeResidualNetwork(
+  const Graph<
+    TheDirectionality,
+    Implementation,
+    VertexData,
+    std::int32_t,
+    Maps>&
+    graph)
+{
+  return makeResidualNetwork(
+    graph, [](std::int32_t capacity) { return capacity; });
+}
+} // namespace g::algo
+#endif // INCG_G_ALGO_RESIDUAL_NETWORK_HPP
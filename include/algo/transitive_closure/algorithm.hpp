@@ -0,0 +1,138 @@
+#ifndef INCG_G_ALGO_TRANSITIVE_CLOSURE_ALGORITHM_HPP
+#define INCG_G_ALGO_TRANSITIVE_CLOSURE_ALGORITHM_HPP
+#include <cstddef>
+
+#include <vector>
+
+#include "algo/condensation.hpp"
+#include "algo/indexed_adjacency.hpp"
+#include "algo/vertex_index.hpp"
+#include "bit_matrix.hpp"
+#include "graph.hpp"
+
+namespace g::algo::transitive_closure {
+/*!
+ * \brief The reachability relation of a graph.
+ *
+ * Vertices of the same strongly connected component reach exactly the same
+ * vertices, so only one row of bits is kept per component. Every vertex
+ * reaches itself.
+ **/
+class TransitiveClosure {
+public:
+  /*!
+   * \brief Creates a `TransitiveClosure`.
+   * \param vertexIndex The vertices.
+   * \param componentOf The strongly connected component of every vertex by
+   *                    dense index.
+   * \param reachability Bit (a, b) is set if component a reaches component b.
+   **/
+  TransitiveClosure(
+    VertexIndex              vertexIndex,
+    std::vector<std::size_t> componentOf,
+    BitMatrix                reachability);
+
+  /*!
+   * \brief Read accessor for the mapping of vertices to dense indices.
+   * \return The vertex index.
+   **/
+  [[nodiscard]] const VertexIndex& vertexIndex() const;
+
+  /*!
+   * \brief Returns the count of strongly connected components.
+   * \return The count of strongly connected components.
+   **/
+  [[nodiscard]] std::size_t componentCount() const;
+
+  /*!
+   * \brief Fetches the strongly connected component of a vertex.
+   * \param vertex The dense index of the vertex.
+   * \return The component. If a component reaches another one, its number is
+   *         greater than or equal to the number of the other one.
+   **/
+  [[nodiscard]] std::size_t componentOf(std::size_t vertex) const
+  {
+    return m_componentOf[vertex];
+  }
+
+  /*!
+   * \brief Determines whether there is a path from `source` to `target`.
+   * \param source The vertex to start at.
+   * \param target The vertex to go to.
+   * \return true if `target` is reachable from `source`; otherwise false.
+   * \throws GraphException if either vertex is not part of the graph.
+   **/
+  [[nodiscard]] bool reaches(VertexIdentifier source, VertexIdentifier target)
+    const;
+
+  /*!
+   * \brief Determines whether there is a path between two vertices given by
+   *        their dense indices.
+   * \param source The dense index of the vertex to start at.
+   * \param target The dense index of the vertex to go to.
+   * \return true if `target` is reachable from `source`; otherwise false.
+   **/
+  [[nodiscard]] bool reachesByIndex(std::size_t source, std::size_t target)
+    const noexcept
+  {
+    return m_reachability.test(m_componentOf[source], m_componentOf[target]);
+  }
+
+  /*!
+   * \brief Read accessor for the reachability of the components.
+   * \return A square matrix, bit (a, b) being set if component a reaches
+   *         component b.
+   **/
+  [[nodiscard]] const BitMatrix& reachability() const;
+
+private:
+  VertexIndex              m_vertexIndex;
+  std::vector<std::size_t> m_componentOf;
+  BitMatrix                m_reachability;
+};
+
+namespace detail {
+/*!
+ * \brief Computes which components reach which.
+ * \param condensation The components of the graph.
+ * \return The reachability matrix of the components.
+ * \note Visits the components in reverse topological order and ORs the
+ *       finished rows of the successors into the row of every predecessor.
+ *       Finished rows are handed out in groups of eight. If a group has many
+ *       incoming arcs a table of the ORs of all 256 subsets of the group is
+ *       built first ("Four Russians"), so that every predecessor needs a
+ *       single row OR per group instead of one per arc.
+ **/
+[[nodiscard]] BitMatrix componentReachability(
+  const Condensation& condensation);
+} // namespace detail
+
+/*!
+ * \brief Computes the transitive closure of a graph.
+ * \param graph The graph.
+ * \return The reachability of all pairs of vertices.
+ * \note Needs C^2 bits of memory, C being the count of strongly connected
+ *       components, and ORs rows of C bits about once per arc between
+ *       components, or once per component and group of eight components on
+ *       dense graphs.
+ **/
+template<
+  Directionality TheDirectionality,
+  typename Implementation,
+  typename VertexData,
+  typename EdgeData,
+  typename Maps>
+[[nodiscard]] TransitiveClosure algorithm(
+  const Graph<TheDirectionality, Implementation, VertexData, EdgeData, Maps>&
+    graph)
+{
+  const IndexedAdjacency adjacency{makeIndexedAdjacency(graph)};
+  const Condensation     condensation{adjacency};
+
+  return TransitiveClosure{
+    adjacency.vertexIndex(),
+    condensation.componentsOf(),
+    detail::componentReachability(condensation)};
+}
+} // namespace g::algo::transitive_closure
+#endif // INCG_G_ALGO_TRANSITIVE_CLOSURE_ALGORITHM_HPP
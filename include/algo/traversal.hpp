@@ -0,0 +1,287 @@
+#ifndef INCG_G_ALGO_TRAVERSAL_HPP
+#define INCG_G_ALGO_TRAVERSAL_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <concepts>
+#include <utility>
+#include <vector>
+
+namespace g::algo {
+/*!
+ * \brief An adjacency structure in compressed sparse row form whose vertices
+ *        and arcs are referred to by dense indices, such as
+ *        `IndexedAdjacency`.
+ **/
+template<typename Adjacency>
+concept ArcAdjacency
+  = requires(const Adjacency& adjacency, std::size_t index) {
+      { adjacency.vertexCount() } -> std::convertible_to<std::size_t>;
+      { adjacency.firstArc(index) } -> std::convertible_to<std::size_t>;
+      { adjacency.lastArc(index) } -> std::convertible_to<std::size_t>;
+      { adjacency.target(index) } -> std::convertible_to<std::size_t>;
+    };
+
+/*!
+ * \brief Tells a traversal whether to go on after a visitor hook.
+ **/
+enum class Step { Continue, Stop };
+
+/*!
+ * \brief A visitor without hooks.
+ **/
+struct NullVisitor {
+};
+
+namespace detail {
+template<typename Visitor>
+[[nodiscard]] Step discoverVertex(Visitor& visitor, std::size_t vertex)
+{
+  if constexpr (requires {
+                  { visitor.discoverVertex(vertex) } -> std::same_as<Step>;
+                }) {
+    return visitor.discoverVertex(vertex);
+  }
+  else {
+    if constexpr (requires { visitor.discoverVertex(vertex); }) {
+      visitor.discoverVertex(vertex);
+    }
+
+    return Step::Continue;
+  }
+}
+
+template<typename Visitor>
+[[nodiscard]] bool examineArc(
+  Visitor&    visitor,
+  std::size_t source,
+  std::size_t arc)
+{
+  if constexpr (requires {
+                  { visitor.examineArc(source, arc) } -> std::same_as<bool>;
+                }) {
+    return visitor.examineArc(source, arc);
+  }
+  else {
+    if constexpr (requires { visitor.examineArc(source, arc); }) {
+      visitor.examineArc(source, arc);
+    }
+
+    return true;
+  }
+}
+
+template<typename Visitor>
+void treeArc(Visitor& visitor, std::size_t source, std::size_t arc)
+{
+  if constexpr (requires { visitor.treeArc(source, arc); }) {
+    visitor.treeArc(source, arc);
+  }
+}
+
+template<typename Visitor>
+[[nodiscard]] Step finishVertex(Visitor& visitor, std::size_t vertex)
+{
+  if constexpr (requires {
+                  { visitor.finishVertex(vertex) } -> std::same_as<Step>;
+                }) {
+    return visitor.finishVertex(vertex);
+  }
+  else {
+    if constexpr (requires { visitor.finishVertex(vertex); }) {
+      visitor.finishVertex(vertex);
+    }
+
+    return Step::Continue;
+  }
+}
+} // namespace detail
+
+/*!
+ * \brief Breadth first and depth first search over an `ArcAdjacency`.
+ *
+ * The visited vertices are kept in a dense bitset and the queue and the stack
+ * are preallocated for every vertex, so that a `Traversal` never allocates
+ * after construction and never recurses. The vertices stay visited across
+ * searches until `reset` is called, which allows to enumerate the components
+ * of a graph by searching from every unvisited vertex.
+ *
+ * A search reports its progress to a visitor, which may implement any of the
+ * following member functions. Hooks that are missing cost nothing.
+ * - `discoverVertex(vertex)`: `vertex` was reached for the first time. May
+ *   return `Step::Stop` to end the search.
+ * - `examineArc(source, arc)`: `arc` leaving `source` is looked at. May
+ *   return false to skip the arc.
+ * - `treeArc(source, arc)`: `arc` leaving `source` reached a new vertex.
+ * - `finishVertex(vertex)`: every arc leaving `vertex` was examined, and in a
+ *   depth first search every vertex reached through them is finished. May
+ *   return `Step::Stop` to end the search.
+ **/
+class Traversal {
+public:
+  /*!
+   * \brief Creates a `Traversal` with no vertex visited.
+   * \param vertexCount The count of vertices of the graphs to search.
+   **/
+  explicit Traversal(std::size_t vertexCount);
+
+  /*!
+   * \brief Returns the count of vertices.
+   * \return The count of vertices.
+   **/
+  [[nodiscard]] std::size_t vertexCount() const;
+
+  /*!
+   * \brief Marks every vertex as not visited.
+   * \note Takes O(V / 64).
+   **/
+  void reset();
+
+  /*!
+   * \brief Determines whether `vertex` was visited since the last `reset`.
+   * \param vertex The dense index of the vertex.
+   * \return true if `vertex` was visited; otherwise false.
+   **/
+  [[nodiscard]] bool isVisited(std::size_t vertex) const
+  {
+    return (m_visited[vertex / 64] >> (vertex % 64)) & 1U;
+  }
+
+  /*!
+   * \brief Searches breadth first from `start`.
+   * \param adjacency The graph. Must have `vertexCount()` vertices.
+   * \param start The dense index of the vertex to begin with. Nothing is
+   *              searched if it is already visited.
+   * \param visitor The visitor.
+   * \return `Step::Stop` if a hook ended the search; otherwise
+   *         `Step::Continue`.
+   **/
+  template<ArcAdjacency Adjacency, typename Visitor = NullVisitor>
+  Step breadthFirst(
+    const Adjacency& adjacency,
+    std::size_t      start,
+    Visitor&&        visitor = Visitor{})
+  {
+    if (!markVisited(start)) { return Step::Continue; }
+
+    if (detail::discoverVertex(visitor, start) == Step::Stop) {
+      return Step::Stop;
+    }
+
+    m_queue.clear();
+    m_queue.push_back(start);
+
+    for (std::size_t head{0}; head < m_queue.size(); ++head) {
+      const std::size_t vertex{m_queue[head]};
+
+      for (std::size_t arc{adjacency.firstArc(vertex)};
+           arc < adjacency.lastArc(vertex);
+           ++arc) {
+        if (!detail::examineArc(visitor, vertex, arc)) { continue; }
+
+        const std::size_t target{adjacency.target(arc)};
+
+        if (markVisited(target)) {
+          detail::treeArc(visitor, vertex, arc);
+
+          if (detail::discoverVertex(visitor, target) == Step::Stop) {
+            return Step::Stop;
+          }
+
+          m_queue.push_back(target);
+        }
+      }
+
+      if (detail::finishVertex(visitor, vertex) == Step::Stop) {
+        return Step::Stop;
+      }
+    }
+
+    return Step::Continue;
+  }
+
+  /*!
+   * \brief Searches depth first from `start`.
+   * \param adjacency The graph. Must have `vertexCount()` vertices.
+   * \param start The dense index of the vertex to begin with. Nothing is
+   *              searched if it is already visited.
+   * \param visitor The visitor.
+   * \return `Step::Stop` if a hook ended the search; otherwise
+   *         `Step::Continue`.
+   * \note Keeps the next arc to examine of every vertex on the stack, so the
+   *       events happen in the same order as in a recursive search.
+   **/
+  template<ArcAdjacency Adjacency, typename Visitor = NullVisitor>
+  Step depthFirst(
+    const Adjacency& adjacency,
+    std::size_t      start,
+    Visitor&&        visitor = Visitor{})
+  {
+    if (!markVisited(start)) { return Step::Continue; }
+
+    if (detail::discoverVertex(visitor, start) == Step::Stop) {
+      return Step::Stop;
+    }
+
+    m_stack.clear();
+    m_stack.emplace_back(start, adjacency.firstArc(start));
+
+    while (!m_stack.empty()) {
+      auto& [vertex, arc]{m_stack.back()};
+
+      if (arc == adjacency.lastArc(vertex)) {
+        const std::size_t finished{vertex};
+        m_stack.pop_back();
+
+        if (detail::finishVertex(visitor, finished) == Step::Stop) {
+          return Step::Stop;
+        }
+
+        continue;
+      }
+
+      const std::size_t source{vertex};
+      const std::size_t current{arc++};
+
+      if (!detail::examineArc(visitor, source, current)) { continue; }
+
+      const std::size_t target{adjacency.target(current)};
+
+      if (markVisited(target)) {
+        detail::treeArc(visitor, source, current);
+
+        if (detail::discoverVertex(visitor, target) == Step::Stop) {
+          return Step::Stop;
+        }
+
+        m_stack.emplace_back(target, adjacency.firstArc(target));
+      }
+    }
+
+    return Step::Continue;
+  }
+
+private:
+  /*!
+   * \brief Marks `vertex` as visited.
+   * \param vertex The dense index of the vertex.
+   * \return true if `vertex` was not visited before; otherwise false.
+   **/
+  bool markVisited(std::size_t vertex)
+  {
+    std::uint64_t&      word{m_visited[vertex / 64]};
+    const std::uint64_t bit{std::uint64_t{1} << (vertex % 64)};
+
+    if ((word & bit) != 0) { return false; }
+
+    word |= bit;
+    return true;
+  }
+
+  std::size_t                                      m_vertexCount;
+  std::vector<std::uint64_t>                       m_visited;
+  std::vector<std::size_t>                         m_queue;
+  std::vector<std::pair<std::size_t, std::size_t>> m_stack;
+};
+} // namespace g::algo
+#endif // INCG_G_ALGO_TRAVERSAL_HPP
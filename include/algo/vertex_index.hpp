@@ -0,0 +1,64 @@
+#ifndef INCG_G_ALGO_VERTEX_INDEX_HPP
+#define INCG_G_ALGO_VERTEX_INDEX_HPP
+#include <cstddef>
+
+#include <unordered_map>
+#include <vector>
+
+#include "vertex_identifier.hpp"
+
+namespace g::algo {
+/*!
+ * \brief Maps the vertices of a `Graph` to the dense indices
+ *        [0, vertexCount) so that algorithms can keep their per-vertex state
+ *        in plain arrays.
+ **/
+class VertexIndex {
+public:
+  /*!
+   * \brief Creates a `VertexIndex`.
+   * \param vertices The vertices to index. The indices are assigned in
+   *                 ascending order of the vertices.
+   **/
+  explicit VertexIndex(std::vector<VertexIdentifier> vertices);
+
+  /*!
+   * \brief Returns the count of vertices indexed.
+   * \return The count of vertices indexed.
+   **/
+  [[nodiscard]] std::size_t size() const;
+
+  /*!
+   * \brief Determines whether `vertex` is indexed.
+   * \param vertex The vertex to look for.
+   * \return true if `vertex` is indexed; otherwise false.
+   **/
+  [[nodiscard]] bool contains(VertexIdentifier vertex) const;
+
+  /*!
+   * \brief Fetches the dense index of `vertex`.
+   * \param vertex The vertex to get the index of.
+   * \return The index of `vertex`.
+   * \throws GraphException if `vertex` is not indexed.
+   **/
+  [[nodiscard]] std::size_t indexOf(VertexIdentifier vertex) const;
+
+  /*!
+   * \brief Fetches the vertex with the dense index `index`.
+   * \param index The index.
+   * \return The vertex.
+   **/
+  [[nodiscard]] VertexIdentifier vertexAt(std::size_t index) const;
+
+  /*!
+   * \brief Read accessor for the indexed vertices, ordered by their index.
+   * \return The indexed vertices.
+   **/
+  [[nodiscard]] const std::vector<VertexIdentifier>& vertices() const;
+
+private:
+  std::vector<VertexIdentifier>                     m_vertices;
+  std::unordered_map<VertexIdentifier, std::size_t> m_indices;
+};
+} // namespace g::algo
+#endif // INCG_G_ALGO_VERTEX_INDEX_HPP
@@ -0,0 +1,141 @@
+#ifndef INCG_G_BIDIRECTIONAL_ADJACENCY_LIST_HPP
+#define INCG_G_BIDIRECTIONAL_ADJACENCY_LIST_HPP
+#include <cstddef>
+
+#include <iosfwd>
+#include <vector>
+
+#include "vertex_identifier.hpp"
+
+namespace g {
+/*!
+ * \brief An adjacency list implementation type for use with the `Graph` type
+ *        that also keeps the vertices that every vertex is directly
+ *        reachable from.
+ *
+ * Keeping the incoming adjacency in sync costs a second list update for
+ * every added or removed edge. In exchange `Graph` can answer `incoming` and
+ * `inDegree` queries and remove a vertex by only visiting its neighbors
+ * instead of every vertex and every edge.
+ **/
+class BidirectionalAdjacencyList {
+public:
+  using this_type = BidirectionalAdjacencyList;
+
+  /*!
+   * \brief Prints a `BidirectionalAdjacencyList` to `os`.
+   * \param os The ostream to print to.
+   * \param l The `BidirectionalAdjacencyList` to print.
+   * \return `os`.
+   **/
+  friend std::ostream& operator<<(std::ostream& os, const this_type& l);
+
+  /*!
+   * \brief Creates an empty bidirectional adjacency list.
+   **/
+  BidirectionalAdjacencyList();
+
+  /*!
+   * \brief Determines whether `target` is directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   * \return true if `target` is directly reachable from `source`; otherwise
+   *         false.
+   **/
+  bool isDirectlyReachable(VertexIdentifier source, VertexIdentifier target)
+    const;
+
+  /*!
+   * \brief Sets `target` to be directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   **/
+  void addTo(VertexIdentifier source, VertexIdentifier target);
+
+  /*!
+   * \brief Fetches all vertices that are directly reachable from `source`.
+   * \param source The source vertex.
+   * \return All vertices that are directly reachable from `source`.
+   **/
+  std::vector<VertexIdentifier> directlyReachables(
+    VertexIdentifier source) const;
+
+  /*!
+   * \brief Fetches all vertices that `target` is directly reachable from.
+   * \param target The target vertex.
+   * \return All vertices that `target` is directly reachable from.
+   **/
+  std::vector<VertexIdentifier> incoming(VertexIdentifier target) const;
+
+  /*!
+   * \brief Returns the count of vertices that `target` is directly reachable
+   *        from.
+   * \param target The target vertex.
+   * \return The in-degree of `target`.
+   **/
+  std::size_t inDegree(VertexIdentifier target) const;
+
+  /*!
+   * \brief Sets `target` to not be directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   **/
+  void removeAdjacentFrom(VertexIdentifier source, VertexIdentifier target);
+
+  /*!
+   * \brief Removes the vertex `toRemove`.
+   * \param toRemove The vertex to remove.
+   * \note Only visits the lists of the neighbors of `toRemove`.
+   **/
+  void removeVertex(VertexIdentifier toRemove);
+
+  /*!
+   * \brief Clears this adjacency list, making it empty.
+   **/
+  void clear();
+
+  /*!
+   * \brief Swaps this `BidirectionalAdjacencyList` with `other`.
+   * \param other The other `BidirectionalAdjacencyList` to swap with.
+   **/
+  void swap(this_type& other) noexcept;
+
+private:
+  /*!
+   * \brief Fetches a pointer to the list of `vertex` in `lists`.
+   * \param lists The lists to look in.
+   * \param vertex The vertex to get the list of.
+   * \return A pointer to the list of `vertex`, or nullptr if `lists` has no
+   *         list for `vertex`.
+   **/
+  static const std::vector<VertexIdentifier>* listOf(
+    const std::vector<std::vector<VertexIdentifier>>& lists,
+    VertexIdentifier                                  vertex);
+
+  /*!
+   * \brief Removes `value` from the list of `vertex` in `lists`, if present.
+   * \param lists The lists to remove from.
+   * \param vertex The vertex whose list to remove from.
+   * \param value The element to remove.
+   **/
+  static void eraseFrom(
+    std::vector<std::vector<VertexIdentifier>>& lists,
+    VertexIdentifier                            vertex,
+    VertexIdentifier                            value);
+
+  std::vector<std::vector<VertexIdentifier>>
+    m_outgoing; /*!< The targets of every vertex */
+  std::vector<std::vector<VertexIdentifier>>
+    m_incoming; /*!< The sources of every vertex */
+};
+
+/*!
+ * \brief Swaps two bidirectional adjacency lists.
+ * \param lhs The left hand side operand.
+ * \param rhs The right hand side operand.
+ **/
+void swap(
+  BidirectionalAdjacencyList& lhs,
+  BidirectionalAdjacencyList& rhs) noexcept;
+} // namespace g
+#endif // INCG_G_BIDIRECTIONAL_ADJACENCY_LIST_HPP
@@ -0,0 +1,278 @@
+#ifndef INCG_G_BIT_MATRIX_HPP
+#define INCG_G_BIT_MATRIX_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <bit>
+#include <iosfwd>
+#include <new>
+#include <span>
+#include <vector>
+
+namespace g {
+namespace detail {
+/*!
+ * \brief An allocator that aligns its allocations to `Alignment` bytes.
+ **/
+template<typename Type, std::size_t Alignment>
+class AlignedAllocator {
+public:
+  using value_type = Type;
+
+  template<typename Other>
+  struct rebind {
+    using other = AlignedAllocator<Other, Alignment>;
+  };
+
+  AlignedAllocator() noexcept = default;
+
+  template<typename Other>
+  AlignedAllocator(const AlignedAllocator<Other, Alignment>&) noexcept
+  {
+  }
+
+  Type* allocate(std::size_t count)
+  {
+    return static_cast<Type*>(
+      ::operator new(count * sizeof(Type), std::align_val_t{Alignment}));
+  }
+
+  void deallocate(Type* pointer, std::size_t) noexcept
+  {
+    ::operator delete(pointer, std::align_val_t{Alignment});
+  }
+
+  template<typename Other>
+  bool operator==(const AlignedAllocator<Other, Alignment>&) const noexcept
+  {
+    return true;
+  }
+};
+} // namespace detail
+
+/*!
+ * \brief A dense matrix of bits stored in one contiguous allocation.
+ *
+ * The storage is aligned to a cache line and every row is padded to a
+ * multiple of four 64 bit words, so that every row starts on a 32 byte
+ * boundary and can be processed with 256 bit vector instructions without a
+ * scalar tail. Bits beyond `columnCount()` are always zero, which lets row
+ * operations work on whole words.
+ **/
+class BitMatrix {
+public:
+  using this_type = BitMatrix;
+  using word_type = std::uint64_t;
+
+  /*!
+   * \brief The count of bits per word.
+   **/
+  static constexpr std::size_t bitsPerWord{64};
+
+  /*!
+   * \brief Rows are padded to a multiple of this many words.
+   **/
+  static constexpr std::size_t wordsPerBlock{4};
+
+  /*!
+   * \brief Prints a `BitMatrix` to `os`, one row per line.
+   * \param os The ostream to print to.
+   * \param m The `BitMatrix` to print.
+   * \return `os`.
+   **/
+  friend std::ostream& operator<<(std::ostream& os, const this_type& m);
+
+  /*!
+   * \brief Creates an empty bit matrix.
+   **/
+  BitMatrix();
+
+  /*!
+   * \brief Creates a bit matrix with all bits cleared.
+   * \param rowCount The count of rows.
+   * \param columnCount The count of columns.
+   **/
+  BitMatrix(std::size_t rowCount, std::size_t columnCount);
+
+  /*!
+   * \brief Returns the count of rows.
+   * \return The count of rows.
+   **/
+  [[nodiscard]] std::size_t rowCount() const noexcept;
+
+  /*!
+   * \brief Returns the count of columns.
+   * \return The count of columns.
+   **/
+  [[nodiscard]] std::size_t columnCount() const noexcept;
+
+  /*!
+   * \brief Returns the count of words that every row occupies.
+   * \return The count of words per row. A multiple of `wordsPerBlock`.
+   **/
+  [[nodiscard]] std::size_t wordsPerRow() const noexcept;
+
+  /*!
+   * \brief Returns the bit at `row` and `column`.
+   * \param row The row. Must be less than `rowCount()`.
+   * \param column The column. Must be less than `columnCount()`.
+   * \return The bit.
+   **/
+  [[nodiscard]] bool test(std::size_t row, std::size_t column) const noexcept
+  {
+    return ((m_words[row * m_wordsPerRow + column / bitsPerWord]
+             >> (column % bitsPerWord))
+            & 1U)
+           != 0;
+  }
+
+  /*!
+   * \brief Sets the bit at `row` and `column`.
+   * \param row The row. Must be less than `rowCount()`.
+   * \param column The column. Must be less than `columnCount()`.
+   **/
+  void set(std::size_t row, std::size_t column) noexcept
+  {
+    m_words[row * m_wordsPerRow + column / bitsPerWord]
+      |= word_type{1} << (column % bitsPerWord);
+  }
+
+  /*!
+   * \brief Clears the bit at `row` and `column`.
+   * \param row The row. Must be less than `rowCount()`.
+   * \param column The column. Must be less than `columnCount()`.
+   **/
+  void reset(std::size_t row, std::size_t column) noexcept
+  {
+    m_words[row * m_wordsPerRow + column / bitsPerWord]
+      &= ~(word_type{1} << (column % bitsPerWord));
+  }
+
+  /*!
+   * \brief Views the words of `row`.
+   * \param row The row. Must be less than `rowCount()`.
+   * \return The `wordsPerRow()` words of `row`.
+   **/
+  [[nodiscard]] std::span<const word_type> row(std::size_t row) const noexcept
+  {
+    return {m_words.data() + row * m_wordsPerRow, m_wordsPerRow};
+  }
+
+  /*!
+   * \brief Views the words of `row` for modification.
+   * \param row The row. Must be less than `rowCount()`.
+   * \return The `wordsPerRow()` words of `row`.
+   * \warning Bits beyond `columnCount()` must stay zero.
+   **/
+  [[nodiscard]] std::span<word_type> mutableRow(std::size_t row) noexcept
+  {
+    return {m_words.data() + row * m_wordsPerRow, m_wordsPerRow};
+  }
+
+  /*!
+   * \brief Calls `callback` with the column of every set bit of `row`, in
+   *        ascending order.
+   * \param row The row. Must be less than `rowCount()`.
+   * \param callback The callback to call with every column.
+   **/
+  template<typename Callback>
+  void forEachInRow(std::size_t row, Callback callback) const
+  {
+    const std::span<const word_type> words{this->row(row)};
+
+    for (std::size_t i{0}; i < words.size(); ++i) {
+      for (word_type word{words[i]}; word != 0; word &= word - 1) {
+        callback(
+          i * bitsPerWord + static_cast<std::size_t>(std::countr_zero(word)));
+      }
+    }
+  }
+
+  /*!
+   * \brief Resizes this matrix, keeping the bits that are still in range.
+   *        New bits are cleared.
+   * \param rowCount The new count of rows.
+   * \param columnCount The new count of columns.
+   * \note Rows are only moved if `columnCount` needs more words per row than
+   *       are available. In that case the row length is at least doubled, so
+   *       that growing one column at a time moves the rows O(log n) times.
+   **/
+  void resize(std::size_t rowCount, std::size_t columnCount);
+
+  /*!
+   * \brief Clears this matrix, making it empty.
+   **/
+  void clear();
+
+  /*!
+   * \brief Swaps this `BitMatrix` with `other`.
+   * \param other The other `BitMatrix` to swap with.
+   **/
+  void swap(this_type& other) noexcept;
+
+private:
+  /*!
+   * \brief Computes the count of words per row that `columnCount` columns
+   *        need.
+   * \param columnCount The count of columns.
+   * \return The padded count of words per row.
+   **/
+  static std::size_t wordsPerRowFor(std::size_t columnCount) noexcept;
+
+  std::size_t m_rowCount;    /*!< The count of rows */
+  std::size_t m_columnCount; /*!< The count of columns */
+  std::size_t m_wordsPerRow; /*!< The row stride in words */
+  std::vector<word_type, detail::AlignedAllocator<word_type, 64>>
+    m_words; /*!< The rows, one after another */
+};
+
+/*!
+ * \brief Swaps two bit matrices.
+ * \param lhs The left hand side operand.
+ * \param rhs The right hand side operand.
+ **/
+void swap(BitMatrix& lhs, BitMatrix& rhs) noexcept;
+
+/*!
+ * \brief Sets every bit of `destination` that is set in `source`.
+ * \param destination The words to modify.
+ * \param source The words to OR into `destination`. Must be as long as
+ *               `destination`.
+ * \note Uses 256 bit vector instructions if compiled with AVX2 enabled.
+ **/
+void orInto(
+  std::span<BitMatrix::word_type>       destination,
+  std::span<const BitMatrix::word_type> source);
+
+/*!
+ * \brief Clears every bit of `destination` that is not set in `source`.
+ * \param destination The words to modify.
+ * \param source The words to AND into `destination`. Must be as long as
+ *               `destination`.
+ * \note Uses 256 bit vector instructions if compiled with AVX2 enabled.
+ **/
+void andInto(
+  std::span<BitMatrix::word_type>       destination,
+  std::span<const BitMatrix::word_type> source);
+
+/*!
+ * \brief Counts the set bits of `words`.
+ * \param words The words to count the set bits of.
+ * \return The count of set bits.
+ * \note Uses 256 bit vector instructions if compiled with AVX2 enabled.
+ **/
+[[nodiscard]] std::size_t countOnes(
+  std::span<const BitMatrix::word_type> words);
+
+/*!
+ * \brief Counts the bits that are set in both `lhs` and `rhs`.
+ * \param lhs The first words.
+ * \param rhs The second words. Must be as long as `lhs`.
+ * \return The count of bits set in both.
+ * \note Uses 256 bit vector instructions if compiled with AVX2 enabled.
+ **/
+[[nodiscard]] std::size_t countCommonOnes(
+  std::span<const BitMatrix::word_type> lhs,
+  std::span<const BitMatrix::word_type> rhs);
+} // namespace g
+#endif // INCG_G_BIT_MATRIX_HPP
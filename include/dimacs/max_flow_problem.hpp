@@ -0,0 +1,58 @@
+#ifndef INCG_G_DIMACS_MAX_FLOW_PROBLEM_HPP
+#define INCG_G_DIMACS_MAX_FLOW_PROBLEM_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <iosfwd>
+
+#include "adjacency_list.hpp"
+#include "graph.hpp"
+#include "vertex_identifier.hpp"
+
+namespace g::dimacs {
+using max_flow_graph_type = Graph<
+  Directionality::Directed,
+  AdjacencyList,
+  std::nullptr_t,
+  std::int32_t>;
+
+/*!
+ * \brief A maximum flow problem instance.
+ **/
+class MaxFlowProblem {
+public:
+  /*!
+   * \brief Creates a `MaxFlowProblem`.
+   * \param graph The network whose edges are associated with their
+   *              capacities.
+   * \param source The source vertex.
+   * \param sink The sink vertex.
+   **/
+  MaxFlowProblem(
+    max_flow_graph_type graph,
+    VertexIdentifier    source,
+    VertexIdentifier    sink);
+
+  [[nodiscard]] const max_flow_graph_type& graph() const;
+
+  [[nodiscard]] VertexIdentifier source() const;
+
+  [[nodiscard]] VertexIdentifier sink() const;
+
+private:
+  max_flow_graph_type m_graph;
+  VertexIdentifier    m_source;
+  VertexIdentifier    m_sink;
+};
+
+/*!
+ * \brief Reads a maximum flow problem in the DIMACS format.
+ * \param is The istream to read from.
+ * \return The problem read.
+ * \throws GraphException if the input is malformed.
+ * \note Vertices keep their 1-based DIMACS numbers as identifiers. Parallel
+ *       arcs are merged into a single edge carrying their total capacity.
+ **/
+[[nodiscard]] MaxFlowProblem readMaxFlowProblem(std::istream& is);
+} // namespace g::dimacs
+#endif // INCG_G_DIMACS_MAX_FLOW_PROBLEM_HPP
@@ -1,10 +1,13 @@
 #ifndef INCG_G_EDGE_HPP
 #define INCG_G_EDGE_HPP
+#include <cstdint>
+
 #include <algorithm>
 #include <functional>
 #include <iosfwd>
 #include <tuple>
 
+#include "hash_mix.hpp"
 #include "vertex_identifier.hpp"
 
 namespace g {
@@ -80,15 +83,15 @@ template<>
 struct hash<::g::Edge> {
   size_t operator()(const ::g::Edge& edge) const noexcept
   {
-    const hash<::g::VertexIdentifier> hasher{};
-    size_t                            hashVal{};
-    constexpr auto                    goldenRatio{0x9E3779B9};
-    hashVal
-      ^= hasher(edge.source()) + goldenRatio + (hashVal << 6) + (hashVal >> 2);
-    hashVal
-      ^= hasher(edge.target()) + goldenRatio + (hashVal << 6) + (hashVal >> 2);
+    const std::uint64_t source{edge.m_source};
+    const std::uint64_t target{edge.m_target};
+
+    // Identifiers of up to 32 bits are packed into a single word.
+    if (((source | target) >> 32) == 0) {
+      return static_cast<size_t>(::g::mixBits((source << 32) | target));
+    }
 
-    return hashVal;
+    return static_cast<size_t>(::g::mixBits(::g::mixBits(source) ^ target));
   }
 };
 } // namespace std
@@ -0,0 +1,619 @@
+#ifndef INCG_G_FLAT_HASH_MAP_HPP
+#define INCG_G_FLAT_HASH_MAP_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#include "hash_mix.hpp"
+
+namespace g {
+namespace detail {
+/*!
+ * \brief The control byte of a slot of a `FlatHashMap`. Full slots hold the
+ *        low 7 bits of the hash of their key, the other states are negative.
+ **/
+using control_type = std::int8_t;
+
+inline constexpr control_type emptyControl{-128};
+inline constexpr control_type deletedControl{-2};
+
+/*!
+ * \brief The control bytes of the slots that a `FlatHashMap` probes at once.
+ **/
+class ControlGroup {
+public:
+  /*!
+   * \brief The count of slots in a group.
+   **/
+  static constexpr std::size_t width{16};
+
+  /*!
+   * \brief Loads the group beginning at `controls`.
+   * \param controls The first of `width` control bytes.
+   **/
+  explicit ControlGroup(const control_type* controls) noexcept
+#if defined(__SSE2__) || defined(_M_X64)
+    : m_controls{
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(controls))}
+  {
+  }
+#else
+    : m_controls{controls}
+  {
+  }
+#endif
+
+  /*!
+   * \brief Finds the slots whose control byte is `control`.
+   * \param control The control byte to look for.
+   * \return A bit per slot of the group.
+   **/
+  [[nodiscard]] std::uint32_t match(control_type control) const noexcept
+  {
+#if defined(__SSE2__) || defined(_M_X64)
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(
+      _mm_cmpeq_epi8(m_controls, _mm_set1_epi8(control))));
+#else
+    std::uint32_t result{0};
+
+    for (std::size_t i{0}; i < width; ++i) {
+      if (m_controls[i] == control) { result |= std::uint32_t{1} << i; }
+    }
+
+    return result;
+#endif
+  }
+
+  /*!
+   * \brief Finds the slots that are empty or deleted.
+   * \return A bit per slot of the group.
+   **/
+  [[nodiscard]] std::uint32_t matchFree() const noexcept
+  {
+#if defined(__SSE2__) || defined(_M_X64)
+    // Only full slots have a clear sign bit.
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(m_controls));
+#else
+    std::uint32_t result{0};
+
+    for (std::size_t i{0}; i < width; ++i) {
+      if (m_controls[i] < 0) { result |= std::uint32_t{1} << i; }
+    }
+
+    return result;
+#endif
+  }
+
+private:
+#if defined(__SSE2__) || defined(_M_X64)
+  __m128i m_controls;
+#else
+  const control_type* m_controls;
+#endif
+};
+} // namespace detail
+
+/*!
+ * \brief A hash map with open addressing in the style of Abseil's
+ *        SwissTable.
+ * \tparam Key The key type.
+ * \tparam Value The mapped type.
+ * \tparam Hash The hash function of `Key`. Its result is scrambled with
+ *              `mixBits`, so an identity hash is fine.
+ * \tparam KeyEqual The equality comparison of `Key`.
+ *
+ * The elements live in one array of slots instead of one heap node each.
+ * Every slot has a control byte holding 7 bits of the hash of its key, so a
+ * lookup compares the bytes of 16 slots at once with SSE2 and only compares
+ * the keys of the slots whose byte matches. The map grows once more than
+ * 7/8 of the slots are in use.
+ * \warning Unlike `std::unordered_map`, inserting invalidates all iterators
+ *          and references. Erasing only invalidates those to the erased
+ *          element.
+ **/
+template<
+  typename Key,
+  typename Value,
+  typename Hash     = std::hash<Key>,
+  typename KeyEqual = std::equal_to<Key>>
+class FlatHashMap {
+public:
+  using this_type       = FlatHashMap;
+  using key_type        = Key;
+  using mapped_type     = Value;
+  using value_type      = std::pair<const Key, Value>;
+  using size_type       = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher          = Hash;
+  using key_equal       = KeyEqual;
+  using reference       = value_type&;
+  using const_reference = const value_type&;
+
+private:
+  /*!
+   * \brief Storage for an element that is only constructed while the slot
+   *        is full.
+   **/
+  struct Slot {
+    Slot() noexcept {}
+
+    ~Slot() {}
+
+    union {
+      value_type value;
+    };
+  };
+
+  template<bool IsConst>
+  class Iterator {
+  public:
+    friend FlatHashMap;
+    friend Iterator<!IsConst>;
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = typename FlatHashMap::value_type;
+    using difference_type   = std::ptrdiff_t;
+    using pointer
+      = std::conditional_t<IsConst, const value_type*, value_type*>;
+    using reference
+      = std::conditional_t<IsConst, const value_type&, value_type&>;
+    using map_pointer
+      = std::conditional_t<IsConst, const FlatHashMap*, FlatHashMap*>;
+
+    Iterator() noexcept : m_map{nullptr}, m_index{0} {}
+
+    /*!
+     * \brief Converts an iterator to a const iterator.
+     **/
+    template<bool WasConst>
+      requires(IsConst && !WasConst)
+    Iterator(const Iterator<WasConst>& other) noexcept
+      : m_map{other.m_map}, m_index{other.m_index}
+    {
+    }
+
+    reference operator*() const noexcept
+    {
+      return m_map->m_slots[m_index].value;
+    }
+
+    pointer operator->() const noexcept
+    {
+      return &m_map->m_slots[m_index].value;
+    }
+
+    Iterator& operator++() noexcept
+    {
+      m_index = m_map->nextFull(m_index + 1);
+      return *this;
+    }
+
+    Iterator operator++(int) noexcept
+    {
+      Iterator result{*this};
+      ++*this;
+      return result;
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+    {
+      return lhs.m_index == rhs.m_index;
+    }
+
+  private:
+    Iterator(map_pointer map, std::size_t index) noexcept
+      : m_map{map}, m_index{index}
+    {
+    }
+
+    map_pointer m_map;
+    std::size_t m_index; /*!< The slot, or the capacity for the end */
+  };
+
+public:
+  using iterator       = Iterator<false>;
+  using const_iterator = Iterator<true>;
+
+  /*!
+   * \brief Creates an empty map that owns no memory.
+   **/
+  FlatHashMap() noexcept
+    : m_controls{}, m_slots{}, m_size{0}, m_growthLeft{0}, m_hash{}, m_equal{}
+  {
+  }
+
+  FlatHashMap(const FlatHashMap& other)
+    : m_controls{}
+    , m_slots{}
+    , m_size{0}
+    , m_growthLeft{0}
+    , m_hash{other.m_hash}
+    , m_equal{other.m_equal}
+  {
+    reserve(other.size());
+
+    for (const value_type& value : other) {
+      insertUnique(value.first, value.second);
+    }
+  }
+
+  FlatHashMap(FlatHashMap&& other) noexcept : FlatHashMap{} { swap(other); }
+
+  FlatHashMap& operator=(FlatHashMap other) noexcept
+  {
+    swap(other);
+    return *this;
+  }
+
+  ~FlatHashMap() { destroyAll(); }
+
+  /*!
+   * \brief Compares two maps element wise, ignoring the order.
+   **/
+  friend bool operator==(const this_type& lhs, const this_type& rhs)
+  {
+    if (lhs.size() != rhs.size()) { return false; }
+
+    for (const value_type& value : lhs) {
+      const const_iterator it{rhs.find(value.first)};
+
+      if (it == rhs.end() || !(it->second == value.second)) { return false; }
+    }
+
+    return true;
+  }
+
+  [[nodiscard]] iterator begin() noexcept { return {this, nextFull(0)}; }
+
+  [[nodiscard]] const_iterator begin() const noexcept
+  {
+    return {this, nextFull(0)};
+  }
+
+  [[nodiscard]] iterator end() noexcept { return {this, capacity()}; }
+
+  [[nodiscard]] const_iterator end() const noexcept
+  {
+    return {this, capacity()};
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+  [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+
+  /*!
+   * \brief Returns the count of slots.
+   * \return The count of slots, 0 or a power of two of at least
+   *         `ControlGroup::width`.
+   **/
+  [[nodiscard]] std::size_t capacity() const noexcept
+  {
+    return m_controls.size();
+  }
+
+  /*!
+   * \brief Makes room for `count` elements, so that inserting them doesn't
+   *        rehash.
+   * \param count The count of elements to make room for.
+   **/
+  void reserve(std::size_t count)
+  {
+    if (count <= m_size + m_growthLeft) { return; }
+
+    std::size_t capacity{detail::ControlGroup::width};
+
+    while (maxSizeFor(capacity) < count) { capacity *= 2; }
+
+    rehash(capacity);
+  }
+
+  /*!
+   * \brief Inserts an element if there is none with the key given.
+   * \param key The key.
+   * \param args The arguments to construct the value to map `key` to from.
+   * \return The element with the key and whether it was inserted.
+   **/
+  template<typename... Args>
+  std::pair<iterator, bool> emplace(const Key& key, Args&&... args)
+  {
+    const std::uint64_t hash{hashOf(key)};
+
+    if (const std::size_t index{findIndex(key, hash)}; index != capacity()) {
+      return {iterator{this, index}, false};
+    }
+
+    return {
+      iterator{this, insertAt(hash, key, std::forward<Args>(args)...)}, true};
+  }
+
+  /*!
+   * \brief Finds the element with the key given.
+   * \param key The key to look for.
+   * \return The element or `end()`.
+   **/
+  [[nodiscard]] iterator find(const Key& key)
+  {
+    return {this, findIndex(key, hashOf(key))};
+  }
+
+  [[nodiscard]] const_iterator find(const Key& key) const
+  {
+    return {this, findIndex(key, hashOf(key))};
+  }
+
+  [[nodiscard]] bool contains(const Key& key) const
+  {
+    return find(key) != end();
+  }
+
+  /*!
+   * \brief Erases the element at `position`.
+   * \param position The element to erase. Must not be `end()`.
+   * \return The element after the erased one.
+   **/
+  iterator erase(const_iterator position)
+  {
+    const std::size_t index{position.m_index};
+    std::destroy_at(&m_slots[index].value);
+    --m_size;
+
+    // A group that has never been full ended every probe that reached it,
+    // so its slots can become empty again. Otherwise later groups may hold
+    // keys that probed past this slot, which must not end at it.
+    const std::size_t groupStart{
+      index & ~(detail::ControlGroup::width - 1)};
+    const detail::ControlGroup group{&m_controls[groupStart]};
+
+    if (group.match(detail::emptyControl) != 0) {
+      m_controls[index] = detail::emptyControl;
+      ++m_growthLeft;
+    }
+    else {
+      m_controls[index] = detail::deletedControl;
+    }
+
+    return {this, nextFull(index + 1)};
+  }
+
+  iterator erase(iterator position)
+  {
+    return erase(const_iterator{position});
+  }
+
+  /*!
+   * \brief Erases the element with the key given, if any.
+   * \param key The key of the element to erase.
+   * \return The count of elements erased.
+   **/
+  std::size_t erase(const Key& key)
+  {
+    const const_iterator it{find(key)};
+
+    if (it == end()) { return 0; }
+
+    erase(it);
+    return 1;
+  }
+
+  /*!
+   * \brief Erases all elements, keeping the slots.
+   **/
+  void clear() noexcept
+  {
+    destroyAll();
+    std::fill(m_controls.begin(), m_controls.end(), detail::emptyControl);
+    m_size       = 0;
+    m_growthLeft = maxSizeFor(capacity());
+  }
+
+  /*!
+   * \brief Swaps this `FlatHashMap` with `other`.
+   * \param other The other `FlatHashMap` to swap with.
+   **/
+  void swap(this_type& other) noexcept
+  {
+    m_controls.swap(other.m_controls);
+    m_slots.swap(other.m_slots);
+    std::swap(m_size, other.m_size);
+    std::swap(m_growthLeft, other.m_growthLeft);
+    std::swap(m_hash, other.m_hash);
+    std::swap(m_equal, other.m_equal);
+  }
+
+private:
+  /*!
+   * \brief Returns the count of elements that `capacity` slots may hold.
+   **/
+  static std::size_t maxSizeFor(std::size_t capacity) noexcept
+  {
+    return capacity - capacity / 8;
+  }
+
+  std::uint64_t hashOf(const Key& key) const
+  {
+    return mixBits(static_cast<std::uint64_t>(m_hash(key)));
+  }
+
+  /*!
+   * \brief Returns the control byte of a full slot for `hash`.
+   **/
+  static detail::control_type controlOf(std::uint64_t hash) noexcept
+  {
+    return static_cast<detail::control_type>(hash & 0x7F);
+  }
+
+  /*!
+   * \brief Returns the first slot at or after `index` that is full.
+   * \return The slot or `capacity()` if there is none.
+   **/
+  std::size_t nextFull(std::size_t index) const noexcept
+  {
+    while (index < capacity() && m_controls[index] < 0) { ++index; }
+
+    return index;
+  }
+
+  /*!
+   * \brief Calls `callback` with the first slot of every group in the probe
+   *        sequence of `hash` until it returns true.
+   **/
+  template<typename Callback>
+  void probe(std::uint64_t hash, Callback callback) const
+  {
+    const std::size_t mask{capacity() / detail::ControlGroup::width - 1};
+    std::size_t       group{static_cast<std::size_t>(hash >> 7) & mask};
+
+    // Triangular steps visit every group as the group count is a power of
+    // two.
+    for (std::size_t step{1};; ++step) {
+      if (callback(group * detail::ControlGroup::width)) { return; }
+
+      group = (group + step) & mask;
+    }
+  }
+
+  std::size_t findIndex(const Key& key, std::uint64_t hash) const
+  {
+    if (m_size == 0) { return capacity(); }
+
+    const detail::control_type control{controlOf(hash)};
+    std::size_t                result{capacity()};
+
+    probe(hash, [&](std::size_t groupStart) {
+      const detail::ControlGroup group{&m_controls[groupStart]};
+
+      for (std::uint32_t bits{group.match(control)}; bits != 0;
+           bits &= bits - 1) {
+        const std::size_t index{
+          groupStart + static_cast<std::size_t>(std::countr_zero(bits))};
+
+        if (m_equal(m_slots[index].value.first, key)) {
+          result = index;
+          return true;
+        }
+      }
+
+      return group.match(detail::emptyControl) != 0;
+    });
+
+    return result;
+  }
+
+  /*!
+   * \brief Inserts a key known to be missing.
+   * \return The slot of the new element.
+   **/
+  template<typename... Args>
+  std::size_t insertAt(std::uint64_t hash, const Key& key, Args&&... args)
+  {
+    if (m_growthLeft == 0) {
+      // Only grows if the deleted slots don't make up for enough room.
+      rehash(
+        m_size + 1 > maxSizeFor(capacity()) / 2
+          ? std::max(2 * capacity(), detail::ControlGroup::width)
+          : capacity());
+    }
+
+    std::size_t index{0};
+
+    probe(hash, [&](std::size_t groupStart) {
+      const std::uint32_t free{
+        detail::ControlGroup{&m_controls[groupStart]}.matchFree()};
+
+      if (free == 0) { return false; }
+
+      index = groupStart + static_cast<std::size_t>(std::countr_zero(free));
+      return true;
+    });
+
+    if (m_controls[index] == detail::emptyControl) { --m_growthLeft; }
+
+    std::construct_at(
+      &m_slots[index].value,
+      std::piecewise_construct,
+      std::forward_as_tuple(key),
+      std::forward_as_tuple(std::forward<Args>(args)...));
+    m_controls[index] = controlOf(hash);
+    ++m_size;
+    return index;
+  }
+
+  void insertUnique(const Key& key, const Value& value)
+  {
+    (void)insertAt(hashOf(key), key, value);
+  }
+
+  /*!
+   * \brief Moves all elements into `capacity` new slots, dropping the
+   *        deleted ones.
+   **/
+  void rehash(std::size_t capacity)
+  {
+    this_type result{};
+    result.m_controls.assign(capacity, detail::emptyControl);
+    result.m_slots      = std::vector<Slot>(capacity);
+    result.m_growthLeft = maxSizeFor(capacity);
+    result.m_hash       = m_hash;
+    result.m_equal      = m_equal;
+
+    for (std::size_t index{nextFull(0)}; index < this->capacity();
+         index = nextFull(index + 1)) {
+      value_type& value{m_slots[index].value};
+      (void)result.insertAt(
+        hashOf(value.first), value.first, std::move(value.second));
+    }
+
+    swap(result);
+  }
+
+  void destroyAll() noexcept
+  {
+    for (std::size_t index{nextFull(0)}; index < capacity();
+         index = nextFull(index + 1)) {
+      std::destroy_at(&m_slots[index].value);
+    }
+  }
+
+  std::vector<detail::control_type> m_controls; /*!< A byte per slot */
+  std::vector<Slot>                 m_slots;
+  std::size_t                       m_size;
+  std::size_t m_growthLeft; /*!< Empty slots that may still be filled */
+  Hash        m_hash;
+  KeyEqual    m_equal;
+};
+
+/*!
+ * \brief Swaps two flat hash maps.
+ * \param lhs The left hand side operand.
+ * \param rhs The right hand side operand.
+ **/
+template<typename Key, typename Value, typename Hash, typename KeyEqual>
+void swap(
+  FlatHashMap<Key, Value, Hash, KeyEqual>& lhs,
+  FlatHashMap<Key, Value, Hash, KeyEqual>& rhs) noexcept
+{
+  lhs.swap(rhs);
+}
+
+/*!
+ * \brief Selects `FlatHashMap` for the vertex and edge maps of a `Graph`.
+ **/
+struct FlatHashMaps {
+  template<typename Key, typename Value>
+  using map_type = FlatHashMap<Key, Value>;
+};
+} // namespace g
+#endif // INCG_G_FLAT_HASH_MAP_HPP
@@ -0,0 +1,84 @@
+#ifndef INCG_G_FLOW_CHECK_IS_VALID_FLOW_HPP
+#define INCG_G_FLOW_CHECK_IS_VALID_FLOW_HPP
+#include <cstdint>
+
+#include <unordered_map>
+
+#include "edge.hpp"
+#include "vertex_identifier.hpp"
+
+namespace g::flow_check {
+namespace detail {
+/*!
+ * \brief Fetches the capacity from the data of an edge.
+ **/
+template<typename EdgeData>
+std::int64_t capacityOf(const EdgeData& data)
+{
+  if constexpr (requires { data.capacity(); }) { return data.capacity(); }
+  else {
+    return data;
+  }
+}
+} // namespace detail
+
+/*!
+ * \brief Checks that the flow of a max flow result is a valid flow of value
+ *        `result.maxFlow()` from `source` to `sink`.
+ * \param graph The network. Its edge data is either the capacity or has a
+ *              `capacity()` member function.
+ * \param result The result, whose `flow()` maps edges to their flow.
+ * \param source The source vertex.
+ * \param sink The sink vertex.
+ * \return true if every positive flow lies on an edge of `graph` within its
+ *         capacity, every negative flow is the mirror image of the flow of
+ *         the reverse edge and the flow is conserved at every vertex but
+ *         `source` and `sink`; otherwise false.
+ **/
+template<typename Graph, typename Result>
+bool isValidFlow(
+  const Graph&     graph,
+  const Result&    result,
+  VertexIdentifier source,
+  VertexIdentifier sink)
+{
+  std::unordered_map<VertexIdentifier, std::int64_t> netOutflow{};
+
+  for (const auto& [edge, flow] : result.flow()) {
+    if (flow < 0) {
+      const auto reverseIt{
+        result.flow().find(Edge{edge.target(), edge.source()})};
+
+      if (reverseIt == result.flow().end() || reverseIt->second != -flow) {
+        return false;
+      }
+
+      continue;
+    }
+
+    if (flow == 0) { continue; }
+
+    const auto data{graph.fetchEdgeData(edge.source(), edge.target())};
+
+    if (!data.has_value() || flow > detail::capacityOf(*data)) {
+      return false;
+    }
+
+    netOutflow[edge.source()] += flow;
+    netOutflow[edge.target()] -= flow;
+  }
+
+  if (
+    netOutflow[source] != result.maxFlow()
+    || netOutflow[sink] != -result.maxFlow()) {
+    return false;
+  }
+
+  for (const auto& [vertex, outflow] : netOutflow) {
+    if (vertex != source && vertex != sink && outflow != 0) { return false; }
+  }
+
+  return true;
+}
+} // namespace g::flow_check
+#endif // INCG_G_FLOW_CHECK_IS_VALID_FLOW_HPP
@@ -3,17 +3,88 @@
 #include <cstddef>
 
 #include <algorithm>
+#include <concepts>
 #include <iterator>
 #include <optional>
 #include <ostream>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "assert.hpp"
+#include "bit_matrix.hpp"
 #include "directionality.hpp"
 #include "edge.hpp"
 #include "vertex_identifier.hpp"
 
 namespace g {
+/*!
+ * \brief An implementation type that also keeps the vertices that every
+ *        vertex is directly reachable from.
+ **/
+template<typename Implementation>
+concept InAdjacency = requires(
+  const Implementation& implementation,
+  VertexIdentifier      vertex) {
+  {
+    implementation.incoming(vertex)
+  } -> std::same_as<std::vector<VertexIdentifier>>;
+  { implementation.inDegree(vertex) } -> std::convertible_to<std::size_t>;
+};
+
+/*!
+ * \brief An implementation type that can make several vertices directly
+ *        reachable from one vertex at once, through
+ *        `addAllTo(source, targets)`.
+ **/
+template<typename Implementation>
+concept BatchInsertable = requires(
+  Implementation&               implementation,
+  VertexIdentifier              vertex,
+  std::vector<VertexIdentifier> targets) {
+  implementation.addAllTo(vertex, std::move(targets));
+};
+
+/*!
+ * \brief An implementation type that keeps its adjacency in a `BitMatrix`
+ *        indexed by the vertex identifiers.
+ **/
+template<typename Implementation>
+concept MatrixAdjacency = requires(const Implementation& implementation) {
+  { implementation.adjacency() } -> std::same_as<const BitMatrix&>;
+};
+
+/*!
+ * \brief An implementation type that stores the data of the edges itself,
+ *        instead of leaving it to the edge map of `Graph`.
+ *
+ * `edgeData` returns nullptr for a missing edge and `arcCount` counts the
+ * stored (source, target) pairs. Such implementations also have to provide
+ * `forEachOutEdge(source, callback)`, which calls `callback(target, data)`
+ * for every edge leaving `source`.
+ **/
+template<typename Implementation, typename EdgeData>
+concept EdgeStorage = requires(
+  Implementation&       implementation,
+  const Implementation& constImplementation,
+  VertexIdentifier      vertex,
+  const EdgeData&       data) {
+  implementation.addTo(vertex, vertex, data);
+  {
+    constImplementation.edgeData(vertex, vertex)
+  } -> std::same_as<const EdgeData*>;
+  { constImplementation.arcCount() } -> std::convertible_to<std::size_t>;
+};
+
+/*!
+ * \brief Selects `std::unordered_map` for the vertex and edge maps of a
+ *        `Graph`.
+ **/
+struct StdHashMaps {
+  template<typename Key, typename Value>
+  using map_type = std::unordered_map<Key, Value>;
+};
+
 /*!
  * \brief The graph data structure.
  * \tparam TheDirectionality The directionality of the edges in the graph.
@@ -22,22 +93,33 @@ namespace g {
  *                    with.
  * \tparam EdgeData The type of the data that the edges are associated
  *                  with.
+ * \tparam Maps Selects the type of the vertex and edge maps through its
+ *              member alias template `map_type<Key, Value>`, for instance
+ *              `StdHashMaps` or `FlatHashMaps`.
+ * \note If `Implementation` satisfies `EdgeStorage` the edge map stays empty
+ *       and the iterator based edge accessors are unavailable.
+ * \note The edge map of an undirected graph holds every edge once, keyed by
+ *       the edge from its lower to its higher vertex.
  **/
 template<
   Directionality TheDirectionality,
   typename Implementation,
   typename VertexData,
-  typename EdgeData>
+  typename EdgeData,
+  typename Maps = StdHashMaps>
 class Graph {
 public:
   using this_type           = Graph;
-  using edge_map            = std::unordered_map<Edge, EdgeData>;
+  using edge_map            = typename Maps::template map_type<Edge, EdgeData>;
   using edge_iterator       = typename edge_map::iterator;
   using const_edge_iterator = typename edge_map::const_iterator;
-  using vertex_map          = std::unordered_map<VertexIdentifier, VertexData>;
+  using vertex_map
+    = typename Maps::template map_type<VertexIdentifier, VertexData>;
   using vertex_iterator     = typename vertex_map::iterator;
   using const_vertex_iterator = typename vertex_map::const_iterator;
   static constexpr inline Directionality directionality{TheDirectionality};
+  static constexpr inline bool           storesEdgeData{
+    EdgeStorage<Implementation, EdgeData>};
 
   /*!
    * \brief Prints a `Graph` to an ostream.
@@ -71,8 +153,10 @@ public:
    **/
   Graph() : m_vertexMap{}, m_edgeMap{}, m_implementation{}
   {
-    m_vertexMap.max_load_factor(0.7F);
-    m_edgeMap.max_load_factor(0.7F);
+    if constexpr (requires { m_vertexMap.max_load_factor(0.7F); }) {
+      m_vertexMap.max_load_factor(0.7F);
+      m_edgeMap.max_load_factor(0.7F);
+    }
   }
 
   /*!
@@ -89,25 +173,90 @@ public:
   {
     if (!hasVertex(source) || !hasVertex(target)) { return false; }
 
+    if constexpr (storesEdgeData) {
+      if (m_implementation.isDirectlyReachable(source, target)) {
+        return false;
+      }
+
+      m_implementation.addTo(source, target, data);
+
+      if constexpr (directionality == Directionality::Undirected) {
+        if (source != target) { m_implementation.addTo(target, source, data); }
+      }
+
+      return true;
+    }
+
     const auto [it, wasInserted]
-      = m_edgeMap.emplace(Edge{source, target}, data);
+      = m_edgeMap.emplace(edgeKey(source, target), data);
     (void)it;
+
+    if (!wasInserted) { return false; }
+
     m_implementation.addTo(source, target);
 
     if constexpr (directionality == Directionality::Undirected) {
-      if (!wasInserted) { return false; }
+      if (source != target) { m_implementation.addTo(target, source); }
+    }
+
+    return true;
+  }
+
+  /*!
+   * \brief Adds edges that all leave the same vertex to this `Graph`.
+   * \param source The source vertex.
+   * \param edges A range of (target, data) pairs.
+   * \return The count of edges inserted. Like `addEdge` this skips an edge
+   *         if its target is missing or if it is already present.
+   * \note If `Implementation` satisfies `BatchInsertable` the new targets
+   *       are handed to it all at once.
+   **/
+  template<typename Range>
+  [[nodiscard]] std::size_t addEdges(
+    VertexIdentifier source,
+    const Range&     edges)
+  {
+    if (!hasVertex(source)) { return 0; }
 
-      // cyclic edge
-      if (source == target) { return wasInserted; }
+    if constexpr (storesEdgeData) {
+      std::size_t count{0};
 
-      const auto [iter, wasItInserted]
-        = m_edgeMap.emplace(Edge{target, source}, data);
-      m_implementation.addTo(target, source);
+      for (const auto& [target, data] : edges) {
+        if (addEdge(source, target, data)) { ++count; }
+      }
 
-      return wasItInserted;
+      return count;
     }
+    else {
+      std::vector<VertexIdentifier> targets{};
+
+      for (const auto& [target, data] : edges) {
+        if (
+          hasVertex(target)
+          && m_edgeMap.emplace(edgeKey(source, target), data).second) {
+          targets.push_back(target);
+        }
+      }
 
-    return wasInserted;
+      const std::size_t count{targets.size()};
+
+      if constexpr (directionality == Directionality::Undirected) {
+        for (const VertexIdentifier target : targets) {
+          if (target != source) { m_implementation.addTo(target, source); }
+        }
+      }
+
+      if constexpr (BatchInsertable<Implementation>) {
+        m_implementation.addAllTo(source, std::move(targets));
+      }
+      else {
+        for (const VertexIdentifier target : targets) {
+          m_implementation.addTo(source, target);
+        }
+      }
+
+      return count;
+    }
   }
 
   /*!
@@ -143,74 +292,122 @@ public:
     return m_implementation.directlyReachables(vertex);
   }
 
+  /*!
+   * \brief Fetches all the vertices that `vertex` is directly reachable from.
+   * \param vertex The vertex to get the predecessors of.
+   * \return The vertices that `vertex` is directly reachable from.
+   * \note Only available if the implementation keeps the incoming adjacency.
+   **/
+  [[nodiscard]] std::vector<VertexIdentifier> incoming(
+    VertexIdentifier vertex) const
+    requires InAdjacency<Implementation>
+  {
+    return m_implementation.incoming(vertex);
+  }
+
+  /*!
+   * \brief Returns the count of vertices that `vertex` is directly reachable
+   *        from.
+   * \param vertex The vertex.
+   * \return The in-degree of `vertex`.
+   * \note Only available if the implementation keeps the incoming adjacency.
+   **/
+  [[nodiscard]] std::size_t inDegree(VertexIdentifier vertex) const
+    requires InAdjacency<Implementation>
+  {
+    return m_implementation.inDegree(vertex);
+  }
+
+  /*!
+   * \brief Returns the bit matrix of the implementation.
+   * \return The bit matrix, where the bit at row i and column j is set if
+   *         vertex j is directly reachable from vertex i.
+   * \note Only available if the implementation keeps a `BitMatrix`.
+   **/
+  [[nodiscard]] const BitMatrix& adjacency() const
+    requires MatrixAdjacency<Implementation>
+  {
+    return m_implementation.adjacency();
+  }
+
   /*!
    * \brief Determines the count of edges in this `Graph`.
    * \return The count of edges.
+   * \note Takes time proportional to the count of vertices for undirected
+   *       graphs whose implementation stores the edge data, as the loops
+   *       have to be counted; otherwise constant time.
    **/
   [[nodiscard]] std::size_t edgeCount() const
   {
-    if constexpr (directionality == Directionality::Directed) {
-      return m_edgeMap.size();
+    if constexpr (!storesEdgeData) { return m_edgeMap.size(); }
+    else if constexpr (directionality == Directionality::Directed) {
+      return m_implementation.arcCount();
     }
+    else {
+      // Every edge is stored as two arcs, except for loops.
+      std::size_t loopCount{0};
 
-    G_ASSERT(
-      m_edgeMap.size() % 2 == 0, "m_edgeMap.size() was: %z", m_edgeMap.size());
+      for (const auto& [vertex, data] : m_vertexMap) {
+        (void)data;
 
-    return m_edgeMap.size() / 2;
+        if (m_implementation.edgeData(vertex, vertex) != nullptr) {
+          ++loopCount;
+        }
+      }
+
+      return (m_implementation.arcCount() + loopCount) / 2;
+    }
   }
 
   /*!
    * \brief Returns all the edges of this `Graph`.
-   * \return All edges of this `Graph`.
+   * \return All edges of this `Graph`. The edges of undirected graphs lead
+   *         from the lower to the higher vertex.
    **/
   [[nodiscard]] std::vector<Edge> edges() const
   {
-    if constexpr (directionality == Directionality::Directed) {
-      return makeEdgeVector();
+    std::vector<Edge> result{makeEdgeVector()};
+
+    if constexpr (
+      storesEdgeData && directionality == Directionality::Undirected) {
+      result.erase(
+        std::remove_if(
+          result.begin(),
+          result.end(),
+          [](const Edge& edge) { return edge.source() > edge.target(); }),
+        result.end());
     }
 
-    std::vector<Edge> result{};
-    G_ASSERT(
-      (m_edgeMap.size() % 2) == 0, "m_edgeMap.size(): %zu", m_edgeMap.size());
-
-    auto contains{[&result](const Edge& edge) {
-      const auto it{std::find(result.begin(), result.end(), edge)};
-
-      return it != result.end();
-    }};
+    return result;
+  }
 
-    for (const std::pair<const Edge, EdgeData>& pair : m_edgeMap) {
-      const Edge edge{pair.first};
+  /*!
+   * \brief Returns all the edges of this `Graph`, undirected ones in both
+   *        directions.
+   * \return The edges of directed graphs. Every edge of undirected graphs
+   *         twice, once per direction, except for loops.
+   **/
+  [[nodiscard]] std::vector<Edge> edgesUndirectedWithReverseEdges() const
+  {
+    if constexpr (
+      !storesEdgeData && directionality == Directionality::Undirected) {
+      std::vector<Edge> result{};
+      result.reserve(2 * m_edgeMap.size());
 
-      g::VertexIdentifier lower{0xDEADC0DE};
-      g::VertexIdentifier higher{0xDEADC0DE};
+      for (const auto& [edge, data] : m_edgeMap) {
+        (void)data;
+        result.push_back(edge);
 
-      if (edge.source() <= edge.target()) {
-        lower  = edge.source();
-        higher = edge.target();
-      }
-      else {
-        lower  = edge.target();
-        higher = edge.source();
+        if (edge.source() != edge.target()) {
+          result.emplace_back(edge.target(), edge.source());
+        }
       }
 
-      if (const Edge normalizedEdge{lower, higher}; !contains(normalizedEdge)) {
-        result.push_back(normalizedEdge);
-      }
+      return result;
+    }
+    else {
+      return makeEdgeVector();
     }
-
-    G_ASSERT(
-      result.size() == m_edgeMap.size() / 2,
-      "result.size(): %zu, m_edgeMap.size(): %zu",
-      result.size(),
-      m_edgeMap.size());
-
-    return result;
-  }
-
-  [[nodiscard]] std::vector<Edge> edgesUndirectedWithReverseEdges() const
-  {
-    return makeEdgeVector();
   }
 
   /*!
@@ -224,15 +421,49 @@ public:
     VertexIdentifier source,
     VertexIdentifier target) const
   {
-    if (const const_edge_iterator edgeIterator{
-          fetchEdgeIterator(source, target)};
-        isEdgeIteratorValid(edgeIterator)) {
-      return edgeIterator->second;
+    if constexpr (storesEdgeData) {
+      if (const EdgeData* data{m_implementation.edgeData(source, target)};
+          data != nullptr) {
+        return *data;
+      }
+    }
+    else {
+      if (const const_edge_iterator edgeIterator{
+            fetchEdgeIterator(source, target)};
+          isEdgeIteratorValid(edgeIterator)) {
+        return edgeIterator->second;
+      }
     }
 
     return std::nullopt;
   }
 
+  /*!
+   * \brief Calls `callback(target, data)` for every edge that leaves
+   *        `vertex`.
+   * \param vertex The source vertex.
+   * \param callback The callback to call with the target vertex and the
+   *                 `EdgeData` of every edge.
+   * \note Reads the edge data straight from the implementation if it stores
+   *       the edge data; otherwise looks up every edge in the edge map.
+   **/
+  template<typename Callback>
+  void forEachOutEdge(VertexIdentifier vertex, Callback callback) const
+  {
+    if constexpr (storesEdgeData) {
+      m_implementation.forEachOutEdge(vertex, callback);
+    }
+    else {
+      for (VertexIdentifier target :
+           m_implementation.directlyReachables(vertex)) {
+        const const_edge_iterator it{fetchEdgeIterator(vertex, target)};
+        G_ASSERT(
+          isEdgeIteratorValid(it), "vertex: %zu, target: %zu", vertex, target);
+        callback(target, it->second);
+      }
+    }
+  }
+
   /*!
    * \brief Fetches the edge iterator for the edge given.
    * \param source The source vertex.
@@ -245,16 +476,9 @@ public:
   [[nodiscard]] edge_iterator fetchEdgeIterator(
     VertexIdentifier source,
     VertexIdentifier target)
+    requires(!storesEdgeData)
   {
-    const edge_iterator it{m_edgeMap.find(Edge{source, target})};
-
-    if constexpr (directionality == Directionality::Undirected) {
-      if (!isEdgeIteratorValid(it)) {
-        return m_edgeMap.find(Edge{target, source});
-      }
-    }
-
-    return it;
+    return m_edgeMap.find(edgeKey(source, target));
   }
 
   /*!
@@ -269,6 +493,7 @@ public:
   [[nodiscard]] const_edge_iterator fetchEdgeIterator(
     VertexIdentifier source,
     VertexIdentifier target) const
+    requires(!storesEdgeData)
   {
     return const_cast<this_type*>(this)->fetchEdgeIterator(source, target);
   }
@@ -326,14 +551,25 @@ public:
   [[nodiscard]] bool hasEdge(VertexIdentifier source, VertexIdentifier target)
     const
   {
-    return isEdgeIteratorValid(fetchEdgeIterator(source, target));
+    if constexpr (storesEdgeData) {
+      return m_implementation.edgeData(source, target) != nullptr;
+    }
+    else {
+      return isEdgeIteratorValid(fetchEdgeIterator(source, target));
+    }
   }
 
   /*!
    * \brief Determines if this `Graph` has any edges.
    * \return true if this `Graph` has at least one edge; otherwise false.
    **/
-  [[nodiscard]] bool hasEdges() const { return !m_edgeMap.empty(); }
+  [[nodiscard]] bool hasEdges() const
+  {
+    if constexpr (storesEdgeData) { return m_implementation.arcCount() != 0; }
+    else {
+      return !m_edgeMap.empty();
+    }
+  }
 
   /*!
    * \brief Determines whether this `Graph` has the given vertex.
@@ -371,6 +607,7 @@ public:
    * \return true if `edgeIterator` is valid; otherwise false.
    **/
   [[nodiscard]] bool isEdgeIteratorValid(const_edge_iterator edgeIterator) const
+    requires(!storesEdgeData)
   {
     return edgeIterator != m_edgeMap.end();
   }
@@ -396,38 +633,34 @@ public:
     VertexIdentifier source,
     VertexIdentifier target)
   {
-    const edge_iterator it{fetchEdgeIterator(source, target)};
-    m_implementation.removeAdjacentFrom(source, target);
+    if constexpr (storesEdgeData) {
+      if (!m_implementation.isDirectlyReachable(source, target)) {
+        return false;
+      }
 
-    if constexpr (directionality == Directionality::Directed) {
-      if (!isEdgeIteratorValid(it)) { return false; }
+      m_implementation.removeAdjacentFrom(source, target);
 
-      m_edgeMap.erase(it);
+      if constexpr (directionality == Directionality::Undirected) {
+        m_implementation.removeAdjacentFrom(target, source);
+      }
 
       return true;
     }
-    else { // Undirected
-      m_implementation.removeAdjacentFrom(target, source);
+    else {
+      const edge_iterator it{fetchEdgeIterator(source, target)};
 
-      if (isEdgeIteratorValid(it)) {
-        m_edgeMap.erase(it);
+      if (!isEdgeIteratorValid(it)) { return false; }
 
-        if (const edge_iterator reverseIt{fetchEdgeIterator(target, source)};
-            isEdgeIteratorValid(reverseIt)) {
-          m_edgeMap.erase(reverseIt);
-        }
+      m_edgeMap.erase(it);
+      m_implementation.removeAdjacentFrom(source, target);
 
-        return true;
+      if constexpr (directionality == Directionality::Undirected) {
+        if (source != target) {
+          m_implementation.removeAdjacentFrom(target, source);
+        }
       }
-      else {
-        const edge_iterator otherIt{fetchEdgeIterator(target, source)};
 
-        if (!isEdgeIteratorValid(otherIt)) { return false; }
-
-        m_edgeMap.erase(otherIt);
-
-        return true;
-      }
+      return true;
     }
   }
 
@@ -435,6 +668,9 @@ public:
    * \brief Removes a vertex from the graph.
    * \param vertex The vertex to remove.
    * \return true if the vertex could be remove; otherwise false.
+   * \note Takes time proportional to the degree of `vertex` if the
+   *       implementation keeps the incoming adjacency; otherwise it scans
+   *       every edge.
    **/
   [[nodiscard]] bool removeVertex(VertexIdentifier vertex)
   {
@@ -443,12 +679,30 @@ public:
     if (!isVertexIteratorValid(it)) { return false; }
 
     m_vertexMap.erase(it);
-    m_implementation.removeVertex(vertex);
-    mapEraseIf(
-      m_edgeMap, [vertex](const std::pair<const Edge, EdgeData>& pair) {
-        const Edge& key{pair.first};
-        return key.source() == vertex || key.target() == vertex;
-      });
+
+    if constexpr (storesEdgeData) { m_implementation.removeVertex(vertex); }
+    else if constexpr (InAdjacency<Implementation>) {
+      // Only the edges of the neighbors have to be looked at.
+      for (VertexIdentifier target :
+           m_implementation.directlyReachables(vertex)) {
+        m_edgeMap.erase(edgeKey(vertex, target));
+      }
+
+      for (VertexIdentifier source : m_implementation.incoming(vertex)) {
+        m_edgeMap.erase(edgeKey(source, vertex));
+      }
+
+      m_implementation.removeVertex(vertex);
+    }
+    else {
+      m_implementation.removeVertex(vertex);
+      mapEraseIf(
+        m_edgeMap, [vertex](const std::pair<const Edge, EdgeData>& pair) {
+          const Edge& key{pair.first};
+          return key.source() == vertex || key.target() == vertex;
+        });
+    }
+
     return true;
   }
 
@@ -492,19 +746,15 @@ public:
   /* Should be private */
 public:
   /*!
-   * \brief Erases all elements from an unordered_map that satisfy the
-   *        predicate given.
-   * \tparam Key The key type of the unordered_map.
-   * \tparam Value The value type of the unordered_map.
+   * \brief Erases all elements from a map that satisfy the predicate given.
+   * \tparam Map The type of the map.
    * \tparam UnaryPredicate The type of the predicate.
-   * \param map The unordered_map to erase from.
+   * \param map The map to erase from.
    * \param unaryPredicate The predicate which indicates whether an element
    *                       should be erased.
    **/
-  template<typename Key, typename Value, typename UnaryPredicate>
-  static void mapEraseIf(
-    std::unordered_map<Key, Value>& map,
-    UnaryPredicate                  unaryPredicate)
+  template<typename Map, typename UnaryPredicate>
+  static void mapEraseIf(Map& map, UnaryPredicate unaryPredicate)
   {
     const auto end{map.end()};
 
@@ -516,9 +766,42 @@ public:
     }
   }
 
+  /*!
+   * \brief Returns the key of an edge in the edge map.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   * \return The edge for directed graphs. The edge from the lower to the
+   *         higher vertex for undirected graphs, which store every edge once.
+   **/
+  [[nodiscard]] static Edge edgeKey(
+    VertexIdentifier source,
+    VertexIdentifier target)
+  {
+    if constexpr (directionality == Directionality::Undirected) {
+      if (target < source) { return Edge{target, source}; }
+    }
+
+    return Edge{source, target};
+  }
+
   [[nodiscard]] std::vector<Edge> makeEdgeVector() const
   {
     std::vector<Edge> result{};
+
+    if constexpr (storesEdgeData) {
+      result.reserve(m_implementation.arcCount());
+
+      for (const auto& [vertex, data] : m_vertexMap) {
+        (void)data;
+        m_implementation.forEachOutEdge(
+          vertex, [&result, vertex](VertexIdentifier target, const EdgeData&) {
+            result.emplace_back(vertex, target);
+          });
+      }
+
+      return result;
+    }
+
     std::transform(
       m_edgeMap.begin(),
       m_edgeMap.end(),
@@ -546,6 +829,7 @@ public:
  *                    with.
  * \tparam EdgeData The data that the edges in the graphs are associated
  *                  with.
+ * \tparam Maps The selection of the map types of the graphs.
  * \param lhs The left hand side operand.
  * \param rhs The right hand side operand.
  **/
@@ -553,10 +837,12 @@ template<
   Directionality TheDirectionality,
   typename Implementation,
   typename VertexData,
-  typename EdgeData>
+  typename EdgeData,
+  typename Maps>
 void swap(
-  Graph<TheDirectionality, Implementation, VertexData, EdgeData>& lhs,
-  Graph<TheDirectionality, Implementation, VertexData, EdgeData>& rhs) noexcept
+  Graph<TheDirectionality, Implementation, VertexData, EdgeData, Maps>& lhs,
+  Graph<TheDirectionality, Implementation, VertexData, EdgeData, Maps>& rhs)
+  noexcept
 {
   lhs.swap(rhs);
 }
@@ -0,0 +1,25 @@
+#ifndef INCG_G_HASH_MIX_HPP
+#define INCG_G_HASH_MIX_HPP
+#include <cstdint>
+
+namespace g {
+/*!
+ * \brief Scrambles the bits of `value` so that every input bit affects every
+ *        output bit.
+ * \param value The value to scramble.
+ * \return The scrambled value.
+ * \note The finalizer of the SplitMix64 generator. `std::hash` of an integer
+ *       is the identity on common standard libraries, which leaves the low
+ *       bits of consecutive vertex identifiers correlated.
+ **/
+[[nodiscard]] constexpr std::uint64_t mixBits(std::uint64_t value) noexcept
+{
+  value ^= value >> 30;
+  value *= 0xBF58476D1CE4E5B9ULL;
+  value ^= value >> 27;
+  value *= 0x94D049BB133111EBULL;
+  value ^= value >> 31;
+  return value;
+}
+} // namespace g
+#endif // INCG_G_HASH_MIX_HPP
@@ -0,0 +1,138 @@
+#ifndef INCG_G_RANDOM_GRAPH_CREATE_GRAPH_HPP
+#define INCG_G_RANDOM_GRAPH_CREATE_GRAPH_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <random>
+
+#include "assert.hpp"
+#include "graph.hpp"
+
+namespace g::random_graph {
+/*!
+ * \brief The direction of the edges added by `addRandomEdges`.
+ **/
+enum class Orientation {
+  Any,       /*!< From either end to the other */
+  Ascending, /*!< From the lower to the higher vertex */
+  Descending /*!< From the higher to the lower vertex */
+};
+
+/*!
+ * \brief Adds the vertices [0, vertexCount) to `graph`.
+ * \param graph The graph, whose vertex data has to be default constructible.
+ * \param vertexCount The count of vertices.
+ **/
+template<typename Graph>
+void addVertices(Graph& graph, VertexIdentifier vertexCount)
+{
+  for (VertexIdentifier v{0}; v < vertexCount; ++v) {
+    G_ASSERT(graph.addVertex(v, {}), "Couldn't add %zu to graph.", v);
+  }
+}
+
+/*!
+ * \brief Adds every edge between two different vertices of [0, vertexCount)
+ *        with the same probability, which gives an Erdos-Renyi G(n, p)
+ *        graph.
+ * \param graph The graph.
+ * \param engine The random engine.
+ * \param vertexCount The count of vertices, which have to be in `graph`.
+ * \param probability The probability of an edge.
+ * \param makeEdgeData Creates the data of an edge from `engine`.
+ * \note An undirected graph gets every pair of vertices once.
+ **/
+template<typename Graph, typename MakeEdgeData>
+void addEdgesWithProbability(
+  Graph&           graph,
+  std::mt19937&    engine,
+  VertexIdentifier vertexCount,
+  double           probability,
+  MakeEdgeData     makeEdgeData)
+{
+  constexpr bool isDirected{
+    Graph::directionality == Directionality::Directed};
+  std::bernoulli_distribution hasEdge{probability};
+
+  for (VertexIdentifier u{0}; u < vertexCount; ++u) {
+    for (VertexIdentifier v{isDirected ? VertexIdentifier{0} : u + 1};
+         v < vertexCount;
+         ++v) {
+      if (u != v && hasEdge(engine)) {
+        G_ASSERT(
+          graph.addEdge(u, v, makeEdgeData(engine)),
+          "Couldn't add edge from %zu to %zu to graph.",
+          u,
+          v);
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Adds `edgeCount` edges between vertices drawn uniformly from
+ *        [0, vertexCount), which gives an Erdos-Renyi G(n, m) graph.
+ * \param graph The graph, whose edge data has to be default constructible.
+ * \param engine The random engine.
+ * \param vertexCount The count of vertices, which have to be in `graph`.
+ * \param edgeCount The count of edges to draw. Loops and edges that are
+ *                  already present are dropped.
+ * \param orientation The direction of the edges.
+ **/
+template<typename Graph>
+void addRandomEdges(
+  Graph&           graph,
+  std::mt19937&    engine,
+  VertexIdentifier vertexCount,
+  std::size_t      edgeCount,
+  Orientation      orientation = Orientation::Any)
+{
+  std::uniform_int_distribution<VertexIdentifier> vertex{0, vertexCount - 1};
+
+  for (std::size_t i{0}; i < edgeCount; ++i) {
+    VertexIdentifier source{vertex(engine)};
+    VertexIdentifier target{vertex(engine)};
+
+    if (
+      (orientation == Orientation::Ascending && source > target)
+      || (orientation == Orientation::Descending && source < target)) {
+      std::swap(source, target);
+    }
+
+    if (source != target) { (void)graph.addEdge(source, target, {}); }
+  }
+}
+
+/*!
+ * \brief Creates a random flow network.
+ * \tparam TheDirectionality The directionality of the network.
+ * \tparam Implementation The implementation of the network.
+ * \param engine The random engine.
+ * \param vertexCount The count of vertices, numbered from 0.
+ * \param probability The probability of an edge, see
+ *                    `addEdgesWithProbability`.
+ * \param maxCapacity The capacities are drawn from [1, maxCapacity].
+ * \return The network.
+ **/
+template<Directionality TheDirectionality, typename Implementation>
+Graph<TheDirectionality, Implementation, std::nullptr_t, std::int32_t>
+createFlowNetwork(
+  std::mt19937&    engine,
+  VertexIdentifier vertexCount,
+  double           probability = 0.3,
+  std::int32_t     maxCapacity = 20)
+{
+  Graph<TheDirectionality, Implementation, std::nullptr_t, std::int32_t>
+                                              graph{};
+  std::uniform_int_distribution<std::int32_t> capacity{1, maxCapacity};
+
+  addVertices(graph, vertexCount);
+  addEdgesWithProbability(
+    graph, engine, vertexCount, probability, [&capacity](std::mt19937& e) {
+      return capacity(e);
+    });
+  return graph;
+}
+} // namespace g::random_graph
+#endif // INCG_G_RANDOM_GRAPH_CREATE_GRAPH_HPP
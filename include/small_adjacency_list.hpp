@@ -0,0 +1,192 @@
+#ifndef INCG_G_SMALL_ADJACENCY_LIST_HPP
+#define INCG_G_SMALL_ADJACENCY_LIST_HPP
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <iosfwd>
+#include <span>
+#include <vector>
+
+#include "vertex_identifier.hpp"
+
+namespace g {
+/*!
+ * \brief An adjacency list implementation type for use with the `Graph` type
+ *        that stores the targets of low degree vertices inline.
+ *
+ * Every vertex owns a fixed size row that holds up to `inlineCapacity`
+ * targets without any heap allocation. Larger rows spill into blocks of a
+ * single slab that is shared by all vertices. Blocks have power of two
+ * capacities and blocks that are no longer used are recycled, so a graph is
+ * built with O(log V) reallocations of the row table and the slab instead of
+ * one allocation per vertex.
+ **/
+class SmallAdjacencyList {
+public:
+  using this_type = SmallAdjacencyList;
+
+  /*!
+   * \brief The count of targets that a vertex can have before spilling into
+   *        the slab.
+   **/
+  static constexpr std::size_t inlineCapacity{4};
+
+  /*!
+   * \brief Prints a `SmallAdjacencyList` to `os`.
+   * \param os The ostream to print to.
+   * \param l The `SmallAdjacencyList` to print.
+   * \return `os`.
+   **/
+  friend std::ostream& operator<<(std::ostream& os, const this_type& l);
+
+  /*!
+   * \brief Creates an empty small adjacency list.
+   **/
+  SmallAdjacencyList();
+
+  /*!
+   * \brief Determines whether `target` is directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   * \return true if `target` is directly reachable from `source`; otherwise
+   *         false.
+   **/
+  bool isDirectlyReachable(VertexIdentifier source, VertexIdentifier target)
+    const;
+
+  /*!
+   * \brief Sets `target` to be directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   **/
+  void addTo(VertexIdentifier source, VertexIdentifier target);
+
+  /*!
+   * \brief Fetches all vertices that are directly reachable from `source`.
+   * \param source The source vertex.
+   * \return All vertices that are directly reachable from `source`.
+   **/
+  std::vector<VertexIdentifier> directlyReachables(
+    VertexIdentifier source) const;
+
+  /*!
+   * \brief Views all vertices that are directly reachable from `source`
+   *        without copying them.
+   * \param source The source vertex.
+   * \return The targets of `source`. Invalidated by any modification.
+   **/
+  std::span<const VertexIdentifier> neighbors(VertexIdentifier source) const;
+
+  /*!
+   * \brief Sets `target` to not be directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   **/
+  void removeAdjacentFrom(VertexIdentifier source, VertexIdentifier target);
+
+  /*!
+   * \brief Removes the vertex `toRemove`.
+   * \param toRemove The vertex to remove.
+   * \note Returns the block of `toRemove` to the slab if it had spilled.
+   **/
+  void removeVertex(VertexIdentifier toRemove);
+
+  /*!
+   * \brief Clears this adjacency list, making it empty.
+   **/
+  void clear();
+
+  /*!
+   * \brief Swaps this `SmallAdjacencyList` with `other`.
+   * \param other The other `SmallAdjacencyList` to swap with.
+   **/
+  void swap(this_type& other) noexcept;
+
+  /*!
+   * \brief Returns the count of slab elements in use or free for reuse.
+   * \return The size of the slab.
+   **/
+  std::size_t slabSize() const noexcept;
+
+private:
+  /*!
+   * \brief The targets of a single vertex.
+   **/
+  struct Row {
+    std::uint32_t size;     /*!< The count of targets */
+    std::uint32_t capacity; /*!< inlineCapacity unless spilled */
+
+    union {
+      /*!
+       * \brief The targets while not spilled.
+       **/
+      std::array<VertexIdentifier, inlineCapacity> local;
+
+      /*!
+       * \brief The offset of the block in the slab once spilled.
+       **/
+      std::size_t offset;
+    };
+  };
+
+  /*!
+   * \brief Determines whether `row` has spilled into the slab.
+   * \param row The row to check.
+   * \return true if the targets of `row` live in the slab; otherwise false.
+   **/
+  static bool isSpilled(const Row& row) noexcept;
+
+  /*!
+   * \brief Maps a block capacity to the index of its free list.
+   * \param capacity The capacity of the block, a power of two larger than
+   *                 `inlineCapacity`.
+   * \return The index into `m_freeBlocks`.
+   **/
+  static std::size_t sizeClassOf(std::size_t capacity) noexcept;
+
+  /*!
+   * \brief Fetches the first target of `row`.
+   * \param row The row to get the targets of.
+   * \return A pointer to `row.capacity` elements, the first `row.size` of
+   *         which are the targets of `row`.
+   **/
+  VertexIdentifier*       dataOf(Row& row);
+  const VertexIdentifier* dataOf(const Row& row) const;
+
+  /*!
+   * \brief Fetches a free block from the slab.
+   * \param capacity The capacity of the block.
+   * \return The offset of the block.
+   **/
+  std::size_t allocate(std::size_t capacity);
+
+  /*!
+   * \brief Returns the block of `row` to the slab, making `row` empty and
+   *        not spilled.
+   * \param row The row whose block to release.
+   **/
+  void release(Row& row);
+
+  /*!
+   * \brief Doubles the capacity of `row`, moving its targets to a larger
+   *        block of the slab.
+   * \param row The row to grow.
+   **/
+  void grow(Row& row);
+
+  std::vector<Row> m_rows; /*!< The row of every vertex */
+  std::vector<VertexIdentifier>
+    m_slab; /*!< The storage of all spilled rows */
+  std::vector<std::vector<std::size_t>>
+    m_freeBlocks; /*!< The offsets of free blocks by size class */
+};
+
+/*!
+ * \brief Swaps two small adjacency lists.
+ * \param lhs The left hand side operand.
+ * \param rhs The right hand side operand.
+ **/
+void swap(SmallAdjacencyList& lhs, SmallAdjacencyList& rhs) noexcept;
+} // namespace g
+#endif // INCG_G_SMALL_ADJACENCY_LIST_HPP
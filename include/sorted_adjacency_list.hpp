@@ -0,0 +1,152 @@
+#ifndef INCG_G_SORTED_ADJACENCY_LIST_HPP
+#define INCG_G_SORTED_ADJACENCY_LIST_HPP
+#include <cstddef>
+
+#include <iosfwd>
+#include <span>
+#include <vector>
+
+#include "vertex_identifier.hpp"
+
+namespace g {
+/*!
+ * \brief An adjacency list implementation type for use with the `Graph` type
+ *        that keeps the targets of every vertex sorted in ascending order.
+ *
+ * Membership tests use binary search and take O(log d) for a vertex of
+ * degree d. Single insertions still shift the elements behind the insertion
+ * point, so many targets of one vertex should be inserted at once with
+ * `addAllTo`, which merges them in O(d + k log k) for k new targets.
+ * `Graph::addEdges` hands its batches to `addAllTo`.
+ **/
+class SortedAdjacencyList {
+public:
+  using this_type = SortedAdjacencyList;
+
+  /*!
+   * \brief Prints a `SortedAdjacencyList` to `os`.
+   * \param os The ostream to print to.
+   * \param l The `SortedAdjacencyList` to print.
+   * \return `os`.
+   **/
+  friend std::ostream& operator<<(std::ostream& os, const this_type& l);
+
+  /*!
+   * \brief Creates an empty sorted adjacency list.
+   **/
+  SortedAdjacencyList();
+
+  /*!
+   * \brief Determines whether `target` is directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   * \return true if `target` is directly reachable from `source`; otherwise
+   *         false.
+   **/
+  bool isDirectlyReachable(VertexIdentifier source, VertexIdentifier target)
+    const;
+
+  /*!
+   * \brief Sets `target` to be directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   **/
+  void addTo(VertexIdentifier source, VertexIdentifier target);
+
+  /*!
+   * \brief Sets every vertex in `targets` to be directly reachable from
+   *        `source`.
+   * \param source The source vertex.
+   * \param targets The target vertices, in any order. May contain duplicates
+   *                and vertices that are already directly reachable.
+   **/
+  void addAllTo(VertexIdentifier source, std::vector<VertexIdentifier> targets);
+
+  /*!
+   * \brief Fetches all vertices that are directly reachable from `source`.
+   * \param source The source vertex.
+   * \return All vertices that are directly reachable from `source`, sorted.
+   **/
+  std::vector<VertexIdentifier> directlyReachables(
+    VertexIdentifier source) const;
+
+  /*!
+   * \brief Views all vertices that are directly reachable from `source`
+   *        without copying them.
+   * \param source The source vertex.
+   * \return The sorted targets of `source`. Invalidated by any modification.
+   **/
+  std::span<const VertexIdentifier> neighbors(VertexIdentifier source) const;
+
+  /*!
+   * \brief Sets `target` to not be directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   **/
+  void removeAdjacentFrom(VertexIdentifier source, VertexIdentifier target);
+
+  /*!
+   * \brief Removes the vertex `toRemove`.
+   * \param toRemove The vertex to remove.
+   **/
+  void removeVertex(VertexIdentifier toRemove);
+
+  /*!
+   * \brief Clears this adjacency list, making it empty.
+   **/
+  void clear();
+
+  /*!
+   * \brief Swaps this `SortedAdjacencyList` with `other`.
+   * \param other The other `SortedAdjacencyList` to swap with.
+   **/
+  void swap(this_type& other) noexcept;
+
+private:
+  /*!
+   * \brief Fetches the list of `source`, creating it if necessary.
+   * \param source The vertex to get the list of.
+   * \return The list of `source`.
+   **/
+  std::vector<VertexIdentifier>& fetchList(VertexIdentifier source);
+
+  /*!
+   * \brief The sorted targets of every vertex.
+   **/
+  std::vector<std::vector<VertexIdentifier>> m_data;
+};
+
+/*!
+ * \brief Swaps two sorted adjacency lists.
+ * \param lhs The left hand side operand.
+ * \param rhs The right hand side operand.
+ **/
+void swap(SortedAdjacencyList& lhs, SortedAdjacencyList& rhs) noexcept;
+
+/*!
+ * \brief Computes the elements that two sorted ranges have in common.
+ * \param lhs The first range, sorted and free of duplicates.
+ * \param rhs The second range, sorted and free of duplicates.
+ * \return The common elements, sorted.
+ * \note Merges linearly if the ranges have similar lengths. Otherwise every
+ *       element of the shorter range is looked up in the longer one by
+ *       galloping, that is by doubling the step until it is overshot and
+ *       then searching binarily, which takes O(s log(l / s)) for lengths
+ *       s <= l.
+ **/
+[[nodiscard]] std::vector<VertexIdentifier> intersect(
+  std::span<const VertexIdentifier> lhs,
+  std::span<const VertexIdentifier> rhs);
+
+/*!
+ * \brief Counts the elements that two sorted ranges have in common.
+ * \param lhs The first range, sorted and free of duplicates.
+ * \param rhs The second range, sorted and free of duplicates.
+ * \return The count of common elements.
+ * \note Same strategy as `intersect`, without storing the elements.
+ **/
+[[nodiscard]] std::size_t intersectionSize(
+  std::span<const VertexIdentifier> lhs,
+  std::span<const VertexIdentifier> rhs);
+} // namespace g
+#endif // INCG_G_SORTED_ADJACENCY_LIST_HPP
@@ -0,0 +1,81 @@
+#ifndef INCG_G_THREAD_TEAM_HPP
+#define INCG_G_THREAD_TEAM_HPP
+#include <cstddef>
+
+#include <atomic>
+#include <barrier>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace g {
+/*!
+ * \brief A fixed team of threads for fork-join style data parallel loops.
+ *
+ * The threads are started once and reused by every call to `parallelFor`,
+ * which makes the team suitable for algorithms that run many short parallel
+ * phases, such as the rounds of a synchronous graph algorithm.
+ **/
+class ThreadTeam {
+public:
+  /*!
+   * \brief The type of the loop body. Called with a half open range of loop
+   *        indices and the index of the calling thread in [0, threadCount).
+   **/
+  using body_type = std::function<
+    void(std::size_t begin, std::size_t end, std::size_t thread)>;
+
+  /*!
+   * \brief Creates a `ThreadTeam`.
+   * \param threadCount The count of threads including the calling thread.
+   *                    0 is treated as 1.
+   **/
+  explicit ThreadTeam(std::size_t threadCount);
+
+  ThreadTeam(const ThreadTeam&) = delete;
+
+  ThreadTeam& operator=(const ThreadTeam&) = delete;
+
+  /*!
+   * \brief Stops and joins the threads.
+   **/
+  ~ThreadTeam();
+
+  /*!
+   * \brief Returns the count of threads including the calling thread.
+   * \return The count of threads.
+   **/
+  [[nodiscard]] std::size_t threadCount() const;
+
+  /*!
+   * \brief Runs `body` over [0, count) on all threads of the team and waits
+   *        until every index has been processed.
+   * \param count The count of loop indices.
+   * \param body The loop body.
+   **/
+  void parallelFor(std::size_t count, const body_type& body);
+
+private:
+  void work(std::size_t thread);
+
+  void runChunks(std::size_t thread);
+
+  std::size_t              m_threadCount;
+  std::barrier<>           m_start;
+  std::barrier<>           m_finish;
+  const body_type*         m_body;
+  std::size_t              m_count;
+  std::size_t              m_grain;
+  std::atomic<std::size_t> m_next;
+  bool                     m_stop;
+  std::vector<std::thread> m_threads;
+};
+
+/*!
+ * \brief Returns the default count of threads to use for parallel
+ *        algorithms.
+ * \return The count of hardware threads, at least 1.
+ **/
+[[nodiscard]] std::size_t defaultThreadCount();
+} // namespace g
+#endif // INCG_G_THREAD_TEAM_HPP
@@ -0,0 +1,182 @@
+#ifndef INCG_G_VERTEX_INTERNER_HPP
+#define INCG_G_VERTEX_INTERNER_HPP
+#include <cstddef>
+
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "graph_exception.hpp"
+#include "throw.hpp"
+#include "vertex_identifier.hpp"
+
+namespace g {
+/*!
+ * \brief Maps arbitrary keys to the dense vertex identifiers [0, size()).
+ * \tparam Key The type of the external keys, for instance 64 bit integers
+ *             or city names.
+ * \tparam Hash The hash function of `Key`.
+ * \tparam KeyEqual The equality comparison of `Key`.
+ *
+ * The implementation types use vertex identifiers as indices, so a graph
+ * with a vertex 10^9 allocates storage for 10^9 vertices. Interning the keys
+ * first and adding the identifiers to the `Graph` sizes all storage by the
+ * count of vertices instead. Identifiers are handed out in the order in
+ * which the keys are first seen and never change, so they stay valid after
+ * their vertex has been removed from the graph.
+ **/
+template<
+  typename Key,
+  typename Hash     = std::hash<Key>,
+  typename KeyEqual = std::equal_to<Key>>
+class VertexInterner {
+public:
+  using this_type = VertexInterner;
+  using key_type  = Key;
+
+  /*!
+   * \brief Creates an empty interner.
+   **/
+  VertexInterner() : m_keys{}, m_identifiers{} {}
+
+  /*!
+   * \brief Returns the count of keys interned.
+   * \return The count of keys interned, which is one more than the largest
+   *         identifier.
+   **/
+  [[nodiscard]] std::size_t size() const noexcept { return m_keys.size(); }
+
+  /*!
+   * \brief Makes room for `count` keys.
+   * \param count The count of keys to make room for.
+   **/
+  void reserve(std::size_t count)
+  {
+    m_keys.reserve(count);
+    m_identifiers.reserve(count);
+  }
+
+  /*!
+   * \brief Fetches the identifier of `key`, assigning the next one if `key`
+   *        hasn't been seen before.
+   * \param key The key to intern.
+   * \return The identifier of `key`.
+   **/
+  VertexIdentifier intern(const Key& key)
+  {
+    const auto [it, isNew]{m_identifiers.try_emplace(key, m_keys.size())};
+
+    if (isNew) { m_keys.push_back(key); }
+
+    return it->second;
+  }
+
+  /*!
+   * \brief Determines whether `key` has been interned.
+   * \param key The key to look for.
+   * \return true if `key` has been interned; otherwise false.
+   **/
+  [[nodiscard]] bool contains(const Key& key) const
+  {
+    return m_identifiers.find(key) != m_identifiers.end();
+  }
+
+  /*!
+   * \brief Looks up the identifier of `key` without interning it.
+   * \param key The key to look for.
+   * \return The identifier or nullopt if `key` hasn't been interned.
+   **/
+  [[nodiscard]] std::optional<VertexIdentifier> find(const Key& key) const
+  {
+    if (const auto it{m_identifiers.find(key)}; it != m_identifiers.end()) {
+      return it->second;
+    }
+
+    return std::nullopt;
+  }
+
+  /*!
+   * \brief Fetches the identifier of `key`.
+   * \param key The key to look for.
+   * \return The identifier of `key`.
+   * \throws GraphException if `key` hasn't been interned.
+   **/
+  [[nodiscard]] VertexIdentifier identifierOf(const Key& key) const
+  {
+    const std::optional<VertexIdentifier> identifier{find(key)};
+
+    if (!identifier.has_value()) {
+      G_THROW(GraphException, "Key not interned, size: %zu.", size());
+    }
+
+    return *identifier;
+  }
+
+  /*!
+   * \brief Fetches the key of `identifier`.
+   * \param identifier The identifier.
+   * \return The key that `identifier` was assigned to.
+   * \throws GraphException if `identifier` wasn't handed out.
+   **/
+  [[nodiscard]] const Key& keyOf(VertexIdentifier identifier) const
+  {
+    if (identifier >= size()) {
+      G_THROW(
+        GraphException,
+        "Identifier %zu not handed out, size: %zu.",
+        identifier,
+        size());
+    }
+
+    return m_keys[identifier];
+  }
+
+  /*!
+   * \brief Read accessor for the interned keys.
+   * \return The key of every identifier, ordered by identifier.
+   **/
+  [[nodiscard]] const std::vector<Key>& keys() const noexcept
+  {
+    return m_keys;
+  }
+
+  /*!
+   * \brief Clears this interner, making it empty.
+   **/
+  void clear()
+  {
+    m_keys.clear();
+    m_identifiers.clear();
+  }
+
+  /*!
+   * \brief Swaps this `VertexInterner` with `other`.
+   * \param other The other `VertexInterner` to swap with.
+   **/
+  void swap(this_type& other) noexcept
+  {
+    m_keys.swap(other.m_keys);
+    m_identifiers.swap(other.m_identifiers);
+  }
+
+private:
+  std::vector<Key> m_keys; /*!< The reverse table */
+  std::unordered_map<Key, VertexIdentifier, Hash, KeyEqual> m_identifiers;
+};
+
+/*!
+ * \brief Swaps two vertex interners.
+ * \param lhs The left hand side operand.
+ * \param rhs The right hand side operand.
+ **/
+template<typename Key, typename Hash, typename KeyEqual>
+void swap(
+  VertexInterner<Key, Hash, KeyEqual>& lhs,
+  VertexInterner<Key, Hash, KeyEqual>& rhs) noexcept
+{
+  lhs.swap(rhs);
+}
+} // namespace g
+#endif // INCG_G_VERTEX_INTERNER_HPP
@@ -0,0 +1,288 @@
+#ifndef INCG_G_WEIGHTED_ADJACENCY_LIST_HPP
+#define INCG_G_WEIGHTED_ADJACENCY_LIST_HPP
+#include <cstddef>
+
+#include <algorithm>
+#include <iterator>
+#include <ostream>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "vertex_identifier.hpp"
+
+namespace g {
+/*!
+ * \brief An adjacency list implementation type for use with the `Graph` type
+ *        that also stores the data of every edge.
+ * \tparam EdgeData The type of the data that the edges are associated with.
+ *
+ * Every vertex has a row of targets and a parallel row of edge data, the
+ * data of the edge to `targetRow(v)[i]` being `edgeDataRow(v)[i]`. `Graph`
+ * leaves its edge map empty for this implementation, so visiting the out
+ * edges of a vertex is one scan over two arrays instead of a hash lookup
+ * per edge. Unlike a `WeightedAdjacencyMatrix` it takes space proportional
+ * to the count of edges.
+ **/
+template<typename EdgeData>
+class WeightedAdjacencyList {
+public:
+  static_assert(
+    !std::is_same_v<EdgeData, bool>,
+    "std::vector<bool> can not be viewed as a contiguous array.");
+
+  using this_type      = WeightedAdjacencyList;
+  using edge_data_type = EdgeData;
+
+  /*!
+   * \brief Prints a `WeightedAdjacencyList` to `os`.
+   * \param os The ostream to print to.
+   * \param l The `WeightedAdjacencyList` to print.
+   * \return `os`.
+   **/
+  friend std::ostream& operator<<(std::ostream& os, const this_type& l)
+  {
+    os << "WeightedAdjacencyList:\n";
+
+    for (std::size_t source{0}; source < l.m_rows.size(); ++source) {
+      os << source << ": ";
+      l.forEachOutEdge(
+        VertexIdentifier{source},
+        [&os](VertexIdentifier target, const EdgeData& data) {
+          os << target << " (" << data << ") ";
+        });
+      os << '\n';
+    }
+
+    return os;
+  }
+
+  /*!
+   * \brief Creates an empty weighted adjacency list.
+   **/
+  WeightedAdjacencyList() : m_rows{}, m_arcCount{0} {}
+
+  /*!
+   * \brief Determines whether `target` is directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   * \return true if `target` is directly reachable from `source`; otherwise
+   *         false.
+   **/
+  bool isDirectlyReachable(VertexIdentifier source, VertexIdentifier target)
+    const
+  {
+    return find(source, target) != notFound;
+  }
+
+  /*!
+   * \brief Sets `target` to be directly reachable from `source` with
+   *        default constructed edge data.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   **/
+  void addTo(VertexIdentifier source, VertexIdentifier target)
+  {
+    addTo(source, target, EdgeData{});
+  }
+
+  /*!
+   * \brief Sets `target` to be directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   * \param data The data of the edge. Replaces the data of an existing edge.
+   **/
+  void addTo(
+    VertexIdentifier source,
+    VertexIdentifier target,
+    const EdgeData&  data)
+  {
+    if (source >= m_rows.size()) { m_rows.resize(source + 1); }
+
+    if (const std::size_t index{find(source, target)}; index != notFound) {
+      m_rows[source].data[index] = data;
+      return;
+    }
+
+    m_rows[source].targets.push_back(target);
+    m_rows[source].data.push_back(data);
+    ++m_arcCount;
+  }
+
+  /*!
+   * \brief Fetches all vertices that are directly reachable from `source`.
+   * \param source The source vertex.
+   * \return All vertices that are directly reachable from `source`.
+   **/
+  std::vector<VertexIdentifier> directlyReachables(
+    VertexIdentifier source) const
+  {
+    const std::span<const VertexIdentifier> targets{targetRow(source)};
+    return std::vector<VertexIdentifier>(targets.begin(), targets.end());
+  }
+
+  /*!
+   * \brief Fetches the data of the edge from `source` to `target`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   * \return A pointer to the data of the edge, or nullptr if there is no
+   *         such edge. Invalidated by adding edges leaving `source`.
+   **/
+  const EdgeData* edgeData(VertexIdentifier source, VertexIdentifier target)
+    const
+  {
+    const std::size_t index{find(source, target)};
+
+    if (index == notFound) { return nullptr; }
+
+    return &m_rows[source].data[index];
+  }
+
+  /*!
+   * \brief Calls `callback(target, data)` for every edge leaving `source`,
+   *        in the order in which the edges were added.
+   * \param source The source vertex.
+   * \param callback The callback to call.
+   **/
+  template<typename Callback>
+  void forEachOutEdge(VertexIdentifier source, Callback callback) const
+  {
+    const std::span<const VertexIdentifier> targets{targetRow(source)};
+    const std::span<const EdgeData>         data{edgeDataRow(source)};
+
+    for (std::size_t i{0}; i < targets.size(); ++i) {
+      callback(targets[i], data[i]);
+    }
+  }
+
+  /*!
+   * \brief Sets `target` to not be directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   **/
+  void removeAdjacentFrom(VertexIdentifier source, VertexIdentifier target)
+  {
+    const std::size_t index{find(source, target)};
+
+    if (index == notFound) { return; }
+
+    Row& row{m_rows[source]};
+    row.targets.erase(
+      row.targets.begin() + static_cast<std::ptrdiff_t>(index));
+    row.data.erase(row.data.begin() + static_cast<std::ptrdiff_t>(index));
+    --m_arcCount;
+  }
+
+  /*!
+   * \brief Removes the vertex `toRemove`.
+   * \param toRemove The vertex to remove.
+   **/
+  void removeVertex(VertexIdentifier toRemove)
+  {
+    if (toRemove < m_rows.size()) {
+      m_arcCount -= m_rows[toRemove].targets.size();
+      m_rows[toRemove] = Row{};
+    }
+
+    for (std::size_t source{0}; source < m_rows.size(); ++source) {
+      removeAdjacentFrom(VertexIdentifier{source}, toRemove);
+    }
+  }
+
+  /*!
+   * \brief Clears this adjacency list, making it empty.
+   **/
+  void clear()
+  {
+    m_rows.clear();
+    m_arcCount = 0;
+  }
+
+  /*!
+   * \brief Swaps this `WeightedAdjacencyList` with `other`.
+   * \param other The other `WeightedAdjacencyList` to swap with.
+   **/
+  void swap(this_type& other) noexcept
+  {
+    m_rows.swap(other.m_rows);
+    std::swap(m_arcCount, other.m_arcCount);
+  }
+
+  /*!
+   * \brief Returns the count of stored (source, target) pairs.
+   * \return The count of stored (source, target) pairs.
+   **/
+  std::size_t arcCount() const noexcept { return m_arcCount; }
+
+  /*!
+   * \brief Views the targets of the edges leaving `source`.
+   * \param source The source vertex.
+   * \return The targets, in the order in which the edges were added.
+   *         Invalidated by adding or removing edges.
+   **/
+  std::span<const VertexIdentifier> targetRow(VertexIdentifier source) const
+  {
+    if (source >= m_rows.size()) { return {}; }
+
+    return m_rows[source].targets;
+  }
+
+  /*!
+   * \brief Views the edge data of the edges leaving `source`.
+   * \param source The source vertex.
+   * \return The edge data, element i belonging to the edge to
+   *         `targetRow(source)[i]`. Invalidated by adding or removing
+   *         edges.
+   **/
+  std::span<const EdgeData> edgeDataRow(VertexIdentifier source) const
+  {
+    if (source >= m_rows.size()) { return {}; }
+
+    return m_rows[source].data;
+  }
+
+private:
+  /*!
+   * \brief The edges leaving a vertex, stored as a structure of arrays.
+   **/
+  struct Row {
+    std::vector<VertexIdentifier> targets;
+    std::vector<EdgeData>         data;
+  };
+
+  static constexpr std::size_t notFound{static_cast<std::size_t>(-1)};
+
+  /*!
+   * \brief Finds the position of the edge from `source` to `target` in the
+   *        row of `source`.
+   * \return The position or `notFound`.
+   **/
+  std::size_t find(VertexIdentifier source, VertexIdentifier target) const
+  {
+    const std::span<const VertexIdentifier> targets{targetRow(source)};
+    const auto it{std::find(targets.begin(), targets.end(), target)};
+
+    if (it == targets.end()) { return notFound; }
+
+    return static_cast<std::size_t>(std::distance(targets.begin(), it));
+  }
+
+  std::vector<Row> m_rows;     /*!< Indexed by the source vertex */
+  std::size_t      m_arcCount; /*!< The count of stored edges */
+};
+
+/*!
+ * \brief Swaps two weighted adjacency lists.
+ * \param lhs The left hand side operand.
+ * \param rhs The right hand side operand.
+ **/
+template<typename EdgeData>
+void swap(
+  WeightedAdjacencyList<EdgeData>& lhs,
+  WeightedAdjacencyList<EdgeData>& rhs) noexcept
+{
+  lhs.swap(rhs);
+}
+} // namespace g
+#endif // INCG_G_WEIGHTED_ADJACENCY_LIST_HPP
@@ -0,0 +1,310 @@
+#ifndef INCG_G_WEIGHTED_ADJACENCY_MATRIX_HPP
+#define INCG_G_WEIGHTED_ADJACENCY_MATRIX_HPP
+#include <cstddef>
+
+#include <algorithm>
+#include <ostream>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "bit_matrix.hpp"
+#include "vertex_identifier.hpp"
+
+namespace g {
+/*!
+ * \brief An adjacency matrix implementation type for use with the `Graph`
+ *        type that also stores the data of every edge.
+ * \tparam EdgeData The type of the data that the edges are associated with.
+ *                  Must be default constructible.
+ *
+ * The edge data is kept in one contiguous square array next to a `BitMatrix`
+ * that marks which cells hold an edge, so that no value of `EdgeData` has to
+ * be reserved as a sentinel. `Graph` leaves its edge map empty for this
+ * implementation and fetching the data of an edge is a single indexed load.
+ * Dense algorithms can run over the rows returned by `edgeDataRow` directly.
+ **/
+template<typename EdgeData>
+class WeightedAdjacencyMatrix {
+public:
+  static_assert(
+    !std::is_same_v<EdgeData, bool>,
+    "std::vector<bool> can not be viewed as a contiguous array.");
+
+  using this_type      = WeightedAdjacencyMatrix;
+  using edge_data_type = EdgeData;
+
+  /*!
+   * \brief Prints a `WeightedAdjacencyMatrix` to `os`, printing '-' for
+   *        missing edges.
+   * \param os The ostream to print to.
+   * \param m The `WeightedAdjacencyMatrix` to print.
+   * \return `os`.
+   **/
+  friend std::ostream& operator<<(std::ostream& os, const this_type& m)
+  {
+    os << "WeightedAdjacencyMatrix:\n";
+
+    for (std::size_t row{0}; row < m.dimension(); ++row) {
+      for (std::size_t col{0}; col < m.dimension(); ++col) {
+        if (m.m_presence.test(row, col)) { os << m.cell(row, col) << ' '; }
+        else {
+          os << "- ";
+        }
+      }
+
+      os << '\n';
+    }
+
+    return os;
+  }
+
+  /*!
+   * \brief Creates an empty weighted adjacency matrix.
+   **/
+  WeightedAdjacencyMatrix()
+    : m_presence{}, m_data{}, m_stride{0}, m_arcCount{0}
+  {
+  }
+
+  /*!
+   * \brief Determines whether `target` is directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   * \return true if `target` is directly reachable from `source`; otherwise
+   *         false.
+   **/
+  bool isDirectlyReachable(VertexIdentifier source, VertexIdentifier target)
+    const
+  {
+    return source < dimension() && target < dimension()
+           && m_presence.test(source, target);
+  }
+
+  /*!
+   * \brief Sets `target` to be directly reachable from `source` with
+   *        default constructed edge data.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   **/
+  void addTo(VertexIdentifier source, VertexIdentifier target)
+  {
+    addTo(source, target, EdgeData{});
+  }
+
+  /*!
+   * \brief Sets `target` to be directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   * \param data The data of the edge. Replaces the data of an existing edge.
+   **/
+  void addTo(
+    VertexIdentifier source,
+    VertexIdentifier target,
+    const EdgeData&  data)
+  {
+    if (const std::size_t dimension{std::max(source, target) + 1};
+        dimension > this->dimension()) {
+      reserve(dimension);
+      m_presence.resize(dimension, dimension);
+    }
+
+    if (!m_presence.test(source, target)) {
+      m_presence.set(source, target);
+      ++m_arcCount;
+    }
+
+    cell(source, target) = data;
+  }
+
+  /*!
+   * \brief Fetches all vertices that are directly reachable from `source`.
+   * \param source The source vertex.
+   * \return All vertices that are directly reachable from `source`.
+   **/
+  std::vector<VertexIdentifier> directlyReachables(
+    VertexIdentifier source) const
+  {
+    std::vector<VertexIdentifier> result{};
+
+    if (source >= dimension()) { return result; }
+
+    m_presence.forEachInRow(source, [&result](std::size_t column) {
+      result.push_back(VertexIdentifier{column});
+    });
+    return result;
+  }
+
+  /*!
+   * \brief Fetches the data of the edge from `source` to `target`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   * \return A pointer to the data of the edge, or nullptr if there is no
+   *         such edge. Invalidated by adding vertices.
+   **/
+  const EdgeData* edgeData(VertexIdentifier source, VertexIdentifier target)
+    const
+  {
+    if (!isDirectlyReachable(source, target)) { return nullptr; }
+
+    return &cell(source, target);
+  }
+
+  /*!
+   * \brief Calls `callback(target, data)` for every edge leaving `source`,
+   *        in ascending order of the target.
+   * \param source The source vertex.
+   * \param callback The callback to call.
+   **/
+  template<typename Callback>
+  void forEachOutEdge(VertexIdentifier source, Callback callback) const
+  {
+    if (source >= dimension()) { return; }
+
+    m_presence.forEachInRow(source, [this, source, &callback](std::size_t t) {
+      callback(VertexIdentifier{t}, cell(source, t));
+    });
+  }
+
+  /*!
+   * \brief Sets `target` to not be directly reachable from `source`.
+   * \param source The source vertex.
+   * \param target The target vertex.
+   **/
+  void removeAdjacentFrom(VertexIdentifier source, VertexIdentifier target)
+  {
+    if (!isDirectlyReachable(source, target)) { return; }
+
+    m_presence.reset(source, target);
+    cell(source, target) = EdgeData{};
+    --m_arcCount;
+  }
+
+  /*!
+   * \brief Removes the vertex `toRemove`.
+   * \param toRemove The vertex to remove.
+   **/
+  void removeVertex(VertexIdentifier toRemove)
+  {
+    if (toRemove >= dimension()) { return; }
+
+    for (VertexIdentifier target : directlyReachables(toRemove)) {
+      removeAdjacentFrom(toRemove, target);
+    }
+
+    for (std::size_t row{0}; row < dimension(); ++row) {
+      removeAdjacentFrom(VertexIdentifier{row}, toRemove);
+    }
+  }
+
+  /*!
+   * \brief Clears this adjacency matrix, making it empty.
+   **/
+  void clear()
+  {
+    m_presence.clear();
+    m_data.clear();
+    m_stride   = 0;
+    m_arcCount = 0;
+  }
+
+  /*!
+   * \brief Swaps this `WeightedAdjacencyMatrix` with `other`.
+   * \param other The other `WeightedAdjacencyMatrix` to swap with.
+   **/
+  void swap(this_type& other) noexcept
+  {
+    m_presence.swap(other.m_presence);
+    m_data.swap(other.m_data);
+    std::swap(m_stride, other.m_stride);
+    std::swap(m_arcCount, other.m_arcCount);
+  }
+
+  /*!
+   * \brief Returns the count of stored (source, target) pairs.
+   * \return The count of stored (source, target) pairs.
+   **/
+  std::size_t arcCount() const noexcept { return m_arcCount; }
+
+  /*!
+   * \brief Returns the count of rows and columns.
+   * \return One more than the greatest vertex seen so far.
+   **/
+  std::size_t dimension() const noexcept { return m_presence.rowCount(); }
+
+  /*!
+   * \brief Makes room for `dimension` rows and columns without moving the
+   *        edge data again.
+   * \param dimension The count of rows and columns to make room for.
+   **/
+  void reserve(std::size_t dimension)
+  {
+    if (dimension <= m_stride) { return; }
+
+    // Grows by half at least, as every move copies the whole array.
+    const std::size_t     stride{std::max(dimension, m_stride + m_stride / 2)};
+    std::vector<EdgeData> data(stride * stride);
+
+    for (std::size_t row{0}; row < this->dimension(); ++row) {
+      const auto first{
+        m_data.begin() + static_cast<std::ptrdiff_t>(row * m_stride)};
+      std::move(
+        first,
+        first + static_cast<std::ptrdiff_t>(this->dimension()),
+        data.begin() + static_cast<std::ptrdiff_t>(row * stride));
+    }
+
+    m_data.swap(data);
+    m_stride = stride;
+  }
+
+  /*!
+   * \brief Returns the matrix that marks which cells hold an edge.
+   * \return The adjacency bits.
+   **/
+  const BitMatrix& adjacency() const noexcept { return m_presence; }
+
+  /*!
+   * \brief Views the edge data of the edges leaving `source`.
+   * \param source The source vertex. Must be less than `dimension()`.
+   * \return `dimension()` cells, where cell i holds the data of the edge to
+   *         vertex i if `adjacency()` has that bit set; otherwise a default
+   *         constructed `EdgeData`.
+   **/
+  std::span<const EdgeData> edgeDataRow(VertexIdentifier source) const
+  {
+    return {m_data.data() + source * m_stride, dimension()};
+  }
+
+private:
+  EdgeData& cell(std::size_t row, std::size_t column)
+  {
+    return m_data[row * m_stride + column];
+  }
+
+  const EdgeData& cell(std::size_t row, std::size_t column) const
+  {
+    return m_data[row * m_stride + column];
+  }
+
+  BitMatrix             m_presence; /*!< Marks the cells that hold an edge */
+  std::vector<EdgeData> m_data;     /*!< The cells, row after row */
+  std::size_t           m_stride;   /*!< The capacity of a row in cells */
+  std::size_t           m_arcCount; /*!< The count of cells with an edge */
+};
+
+/*!
+ * \brief Swaps two weighted adjacency matrices.
+ * \param lhs The left hand side operand.
+ * \param rhs The right hand side operand.
+ **/
+template<typename EdgeData>
+void swap(
+  WeightedAdjacencyMatrix<EdgeData>& lhs,
+  WeightedAdjacencyMatrix<EdgeData>& rhs) noexcept
+{
+  lhs.swap(rhs);
+}
+} // namespace g
+#endif // INCG_G_WEIGHTED_ADJACENCY_MATRIX_HPP
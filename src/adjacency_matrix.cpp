@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <ostream>
 #include <utility>
 
@@ -7,14 +8,7 @@
 namespace g {
 std::ostream& operator<<(std::ostream& os, const AdjacencyMatrix& m)
 {
-  for (std::size_t row{0}; row < m.rowCount(); ++row) {
-    for (std::size_t col{0}; col < m.columnCount(); ++col) {
-      os << m.m_data[row][col] << ' ';
-    }
-    os << '\n';
-  }
-
-  return os;
+  return os << m.m_data;
 }
 
 AdjacencyMatrix::AdjacencyMatrix() : m_data{} {}
@@ -23,22 +17,22 @@ bool AdjacencyMatrix::isDirectlyReachable(
   VertexIdentifier source,
   VertexIdentifier target) const
 {
-  if (const std::optional<const_reference> optional{fetch(source, target)};
-      optional.has_value()) {
-    return *optional;
-  }
+  if (source >= rowCount() || target >= columnCount()) { return false; }
 
-  return false;
+  return m_data.test(source, target);
 }
 
 void AdjacencyMatrix::addTo(VertexIdentifier source, VertexIdentifier target)
 {
   resizeToFitIfNecessary(source, target);
-  std::optional<reference> optional{fetch(source, target)};
 
-  G_ASSERT(optional.has_value(), "source: %zu, target: %zu", source, target);
+  G_ASSERT(
+    source < rowCount() && target < columnCount(),
+    "source: %zu, target: %zu",
+    source,
+    target);
 
-  *optional = true;
+  m_data.set(source, target);
 }
 
 std::vector<VertexIdentifier> AdjacencyMatrix::directlyReachables(
@@ -46,34 +40,45 @@ std::vector<VertexIdentifier> AdjacencyMatrix::directlyReachables(
 {
   std::vector<VertexIdentifier> result{};
 
-  for (std::size_t column{0}; column < columnCount(); ++column) {
-    if (isDirectlyReachable(source, VertexIdentifier{column})) {
-      result.push_back(VertexIdentifier{column});
-    }
-  }
+  if (source >= rowCount()) { return result; }
 
+  result.reserve(countOnes(m_data.row(source)));
+  m_data.forEachInRow(source, [&result](std::size_t column) {
+    result.push_back(VertexIdentifier{column});
+  });
   return result;
 }
 
+std::span<const BitMatrix::word_type> AdjacencyMatrix::row(
+  VertexIdentifier source) const
+{
+  if (source >= rowCount()) { return {}; }
+
+  return m_data.row(source);
+}
+
+const BitMatrix& AdjacencyMatrix::adjacency() const noexcept { return m_data; }
+
 void AdjacencyMatrix::removeAdjacentFrom(
   VertexIdentifier source,
   VertexIdentifier target)
 {
-  std::optional<reference> optional{fetch(source, target)};
-
-  if (!optional.has_value()) { return; }
+  if (source >= rowCount() || target >= columnCount()) { return; }
 
-  *optional = false;
+  m_data.reset(source, target);
 }
 
 void AdjacencyMatrix::removeVertex(VertexIdentifier toRemove)
 {
-  for (std::size_t column{0}; column < columnCount(); ++column) {
-    removeAdjacentFrom(toRemove, VertexIdentifier{column});
+  if (toRemove < rowCount()) {
+    const std::span<BitMatrix::word_type> row{m_data.mutableRow(toRemove)};
+    std::fill(row.begin(), row.end(), BitMatrix::word_type{0});
   }
 
-  for (std::size_t row{0}; row < rowCount(); ++row) {
-    removeAdjacentFrom(VertexIdentifier{row}, toRemove);
+  if (toRemove < columnCount()) {
+    for (std::size_t row{0}; row < rowCount(); ++row) {
+      m_data.reset(row, toRemove);
+    }
   }
 }
 
@@ -84,65 +89,29 @@ void AdjacencyMatrix::swap(this_type& other) noexcept
   m_data.swap(other.m_data);
 }
 
-std::size_t AdjacencyMatrix::rowCount() const { return m_data.size(); }
+std::size_t AdjacencyMatrix::rowCount() const { return m_data.rowCount(); }
 
 std::size_t AdjacencyMatrix::columnCount() const
 {
-  if (m_data.empty()) { return 0; }
-
-  return m_data.front().size();
-}
-
-std::optional<AdjacencyMatrix::reference> AdjacencyMatrix::fetch(
-  std::size_t row,
-  std::size_t column)
-{
-  if (row >= rowCount()) { return std::nullopt; }
-
-  if (column >= columnCount()) { return std::nullopt; }
-
-  return m_data[row][column];
-}
-
-std::optional<AdjacencyMatrix::const_reference> AdjacencyMatrix::fetch(
-  std::size_t row,
-  std::size_t column) const
-{
-  const std::optional<reference> optional{
-    const_cast<this_type*>(this)->fetch(row, column)};
-
-  if (!optional.has_value()) { return std::nullopt; }
-
-  return *optional;
+  return m_data.columnCount();
 }
 
 void AdjacencyMatrix::resizeToFitIfNecessary(
   VertexIdentifier source,
   VertexIdentifier target)
 {
-  const std::size_t newRowCount{source + 1};
-  const std::size_t newColumnCount{target + 1};
+  const std::size_t newRowCount{std::max(rowCount(), source + 1)};
+  const std::size_t newColumnCount{std::max(columnCount(), target + 1)};
 
-  if (newRowCount > rowCount()) {
-    const std::vector<bool> defaultValue(columnCount());
-    m_data.resize(newRowCount, defaultValue);
+  if (newRowCount != rowCount() || newColumnCount != columnCount()) {
+    m_data.resize(newRowCount, newColumnCount);
   }
+
   G_ASSERT(
     newRowCount <= rowCount(),
     "newRowCount: %zu, rowCount(): %zu",
     newRowCount,
     rowCount());
-
-  if (newColumnCount > columnCount()) {
-    for (std::vector<bool>& row : m_data) {
-      if (row.size() < newColumnCount) { row.resize(newColumnCount); }
-      G_ASSERT(
-        row.size() >= newColumnCount,
-        "row.size(): %zu, newColumnCount: %zu",
-        row.size(),
-        newColumnCount);
-    }
-  }
   G_ASSERT(
     newColumnCount <= columnCount(),
     "newColumnCount: %zu, columnCount(): %zu",
@@ -0,0 +1,411 @@
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <ostream>
+#include <queue>
+#include <utility>
+
+#include "algo/boykov_kolmogorov/algorithm.hpp"
+#include "assert.hpp"
+
+namespace g::algo::boykov_kolmogorov {
+namespace {
+enum class Tree : std::uint8_t { Free, Source, Sink };
+
+constexpr std::size_t   none{std::numeric_limits<std::size_t>::max()};
+constexpr std::uint8_t  noParent{255};
+constexpr std::uint8_t  terminalParent{254};
+constexpr std::uint8_t  orphanParent{253};
+constexpr std::uint32_t infiniteDistance{
+  std::numeric_limits<std::uint32_t>::max()};
+
+/*!
+ * \brief The state of the Boykov-Kolmogorov algorithm on a `GridGraph`.
+ *
+ * The parent of a pixel is stored as the slot of the neighbor it is attached
+ * to. Timestamps and distances to the terminal let the adoption stage
+ * verify the origin of a candidate parent without walking the whole path
+ * every time.
+ **/
+class BoykovKolmogorov {
+public:
+  explicit BoykovKolmogorov(GridGraph& graph)
+    : m_graph{graph}
+    , m_residuals{graph.residuals()}
+    , m_terminals{graph.terminals()}
+    , m_slotCount{graph.slotCount()}
+    , m_tree(graph.paddedPixelCount(), Tree::Free)
+    , m_parent(graph.paddedPixelCount(), noParent)
+    , m_timestamp(graph.paddedPixelCount(), 0)
+    , m_distance(graph.paddedPixelCount(), 0)
+    , m_isActive(graph.paddedPixelCount(), false)
+    , m_active{}
+    , m_orphans{}
+    , m_time{0}
+    , m_flow{graph.constantFlow()}
+  {
+  }
+
+  std::int64_t run()
+  {
+    for (std::size_t pixel{0}; pixel < m_terminals.size(); ++pixel) {
+      if (m_terminals[pixel] != 0) {
+        m_tree[pixel]     = m_terminals[pixel] > 0 ? Tree::Source : Tree::Sink;
+        m_parent[pixel]   = terminalParent;
+        m_distance[pixel] = 1;
+        activate(pixel);
+      }
+    }
+
+    std::size_t current{none};
+
+    for (;;) {
+      if (current == none || m_tree[current] == Tree::Free) {
+        current = nextActive();
+
+        if (current == none) { break; }
+      }
+
+      const std::pair<std::size_t, std::size_t> bridge{grow(current)};
+
+      if (bridge.first == none) {
+        current = none;
+        continue;
+      }
+
+      ++m_time;
+      augment(bridge.first, bridge.second);
+      adoptOrphans();
+    }
+
+    return m_flow;
+  }
+
+  [[nodiscard]] bool isInSourceTree(std::size_t pixel) const
+  {
+    return m_tree[pixel] == Tree::Source;
+  }
+
+private:
+  [[nodiscard]] std::size_t neighbor(std::size_t pixel, std::size_t slot) const
+  {
+    return static_cast<std::size_t>(
+      static_cast<std::ptrdiff_t>(pixel) + m_graph.slotOffset(slot));
+  }
+
+  [[nodiscard]] std::int32_t& residual(std::size_t pixel, std::size_t slot)
+  {
+    return m_residuals[pixel * m_slotCount + slot];
+  }
+
+  /*!
+   * \brief Returns the residual capacity of the edge between `pixel` and its
+   *        neighbor in `slot`, in the direction that flow takes through the
+   *        tree of `pixel`.
+   **/
+  [[nodiscard]] std::int32_t& treeResidual(
+    Tree        tree,
+    std::size_t pixel,
+    std::size_t slot)
+  {
+    return tree == Tree::Source
+             ? residual(pixel, slot)
+             : residual(neighbor(pixel, slot), m_graph.reverseSlot(slot));
+  }
+
+  void activate(std::size_t pixel)
+  {
+    if (!m_isActive[pixel]) {
+      m_isActive[pixel] = true;
+      m_active.push(pixel);
+    }
+  }
+
+  [[nodiscard]] std::size_t nextActive()
+  {
+    while (!m_active.empty()) {
+      const std::size_t pixel{m_active.front()};
+      m_active.pop();
+      m_isActive[pixel] = false;
+
+      if (m_tree[pixel] != Tree::Free) { return pixel; }
+    }
+
+    return none;
+  }
+
+  void attach(std::size_t pixel, std::size_t slot, std::size_t parent)
+  {
+    m_parent[pixel]    = static_cast<std::uint8_t>(slot);
+    m_timestamp[pixel] = m_timestamp[parent];
+    m_distance[pixel]  = m_distance[parent] + 1;
+  }
+
+  /*!
+   * \brief Grows the tree of `pixel` into its free neighbors.
+   * \return The pixel in the source tree and the slot of the edge that
+   *         connects both trees, or `none` if `pixel` has no neighbor in
+   *         the other tree.
+   **/
+  [[nodiscard]] std::pair<std::size_t, std::size_t> grow(std::size_t pixel)
+  {
+    const Tree tree{m_tree[pixel]};
+
+    for (std::size_t slot{0}; slot < m_slotCount; ++slot) {
+      if (treeResidual(tree, pixel, slot) <= 0) { continue; }
+
+      const std::size_t other{neighbor(pixel, slot)};
+      const std::size_t reverse{m_graph.reverseSlot(slot)};
+
+      if (m_tree[other] == Tree::Free) {
+        m_tree[other] = tree;
+        attach(other, reverse, pixel);
+        activate(other);
+      }
+      else if (m_tree[other] != tree) {
+        return tree == Tree::Source ? std::make_pair(pixel, slot)
+                                    : std::make_pair(other, reverse);
+      }
+      else if (
+        m_timestamp[other] <= m_timestamp[pixel]
+        && m_distance[other] > m_distance[pixel]) {
+        attach(other, reverse, pixel);
+      }
+    }
+
+    return {none, none};
+  }
+
+  void makeOrphan(std::size_t pixel)
+  {
+    m_parent[pixel] = orphanParent;
+    m_orphans.push_back(pixel);
+  }
+
+  void augment(std::size_t tail, std::size_t slot)
+  {
+    const std::size_t head{neighbor(tail, slot)};
+    std::int64_t      amount{residual(tail, slot)};
+    std::size_t       pixel{tail};
+
+    for (; m_parent[pixel] != terminalParent;
+         pixel = neighbor(pixel, m_parent[pixel])) {
+      amount = std::min<std::int64_t>(
+        amount, treeResidual(Tree::Sink, pixel, m_parent[pixel]));
+    }
+
+    amount = std::min(amount, m_terminals[pixel]);
+
+    for (pixel = head; m_parent[pixel] != terminalParent;
+         pixel = neighbor(pixel, m_parent[pixel])) {
+      amount = std::min<std::int64_t>(
+        amount, treeResidual(Tree::Source, pixel, m_parent[pixel]));
+    }
+
+    amount = std::min(amount, -m_terminals[pixel]);
+    const auto edgeAmount{static_cast<std::int32_t>(amount)};
+
+    residual(tail, slot) -= edgeAmount;
+    residual(head, m_graph.reverseSlot(slot)) += edgeAmount;
+    pushThroughTree(Tree::Source, tail, edgeAmount);
+    pushThroughTree(Tree::Sink, head, edgeAmount);
+    m_flow += amount;
+  }
+
+  /*!
+   * \brief Sends `amount` along the path from `pixel` to the root of its
+   *        tree and turns the pixels whose parent edge saturates into
+   *        orphans.
+   **/
+  void pushThroughTree(Tree tree, std::size_t pixel, std::int32_t amount)
+  {
+    while (m_parent[pixel] != terminalParent) {
+      const std::size_t slot{m_parent[pixel]};
+      const std::size_t parent{neighbor(pixel, slot)};
+      const std::size_t reverse{m_graph.reverseSlot(slot)};
+      // Flow runs from the parent to the pixel in the source tree and from
+      // the pixel to the parent in the sink tree.
+      std::int32_t& forward{
+        tree == Tree::Source ? residual(parent, reverse)
+                             : residual(pixel, slot)};
+      std::int32_t& backward{
+        tree == Tree::Source ? residual(pixel, slot)
+                             : residual(parent, reverse)};
+      forward -= amount;
+      backward += amount;
+
+      if (forward == 0) { makeOrphan(pixel); }
+
+      pixel = parent;
+    }
+
+    m_terminals[pixel] += tree == Tree::Source ? -amount : amount;
+
+    if (m_terminals[pixel] == 0) { makeOrphan(pixel); }
+  }
+
+  void adoptOrphans()
+  {
+    while (!m_orphans.empty()) {
+      const std::size_t orphan{m_orphans.front()};
+      m_orphans.pop_front();
+      adopt(orphan);
+    }
+  }
+
+  /*!
+   * \brief Determines the distance from `pixel` to the terminal of its tree.
+   * \return The distance or `infiniteDistance` if the path leads to an
+   *         orphan.
+   **/
+  [[nodiscard]] std::uint32_t originDistance(std::size_t pixel)
+  {
+    std::uint32_t distance{0};
+
+    for (std::size_t current{pixel};;
+         current = neighbor(current, m_parent[current])) {
+      if (m_timestamp[current] == m_time) {
+        distance += m_distance[current];
+        break;
+      }
+
+      ++distance;
+
+      if (m_parent[current] == terminalParent) {
+        m_timestamp[current] = m_time;
+        m_distance[current]  = 1;
+        break;
+      }
+
+      if (m_parent[current] == orphanParent) { return infiniteDistance; }
+    }
+
+    // Cache the distances along the path for the following searches.
+    std::uint32_t pathDistance{distance};
+
+    for (std::size_t current{pixel}; m_timestamp[current] != m_time;
+         current = neighbor(current, m_parent[current])) {
+      m_timestamp[current] = m_time;
+      m_distance[current]  = pathDistance--;
+    }
+
+    return distance;
+  }
+
+  void adopt(std::size_t orphan)
+  {
+    const Tree    tree{m_tree[orphan]};
+    std::size_t   bestSlot{none};
+    std::uint32_t bestDistance{infiniteDistance};
+
+    for (std::size_t slot{0}; slot < m_slotCount; ++slot) {
+      const std::size_t other{neighbor(orphan, slot)};
+
+      if (
+        m_tree[other] != tree
+        || treeResidual(tree, other, m_graph.reverseSlot(slot)) <= 0) {
+        continue;
+      }
+
+      const std::uint32_t distance{originDistance(other)};
+
+      if (distance < bestDistance) {
+        bestSlot     = slot;
+        bestDistance = distance;
+      }
+    }
+
+    if (bestSlot != none) {
+      m_parent[orphan]    = static_cast<std::uint8_t>(bestSlot);
+      m_timestamp[orphan] = m_time;
+      m_distance[orphan]  = bestDistance + 1;
+      return;
+    }
+
+    for (std::size_t slot{0}; slot < m_slotCount; ++slot) {
+      const std::size_t other{neighbor(orphan, slot)};
+
+      if (m_tree[other] != tree) { continue; }
+
+      if (treeResidual(tree, other, m_graph.reverseSlot(slot)) > 0) {
+        activate(other);
+      }
+
+      const std::uint8_t parent{m_parent[other]};
+
+      if (parent < m_slotCount && neighbor(other, parent) == orphan) {
+        makeOrphan(other);
+      }
+    }
+
+    m_tree[orphan]   = Tree::Free;
+    m_parent[orphan] = noParent;
+  }
+
+  GridGraph&                 m_graph;
+  std::vector<std::int32_t>& m_residuals;
+  std::vector<std::int64_t>& m_terminals;
+  std::size_t                m_slotCount;
+  std::vector<Tree>          m_tree;
+  std::vector<std::uint8_t>  m_parent;
+  std::vector<std::uint32_t> m_timestamp;
+  std::vector<std::uint32_t> m_distance;
+  std::vector<bool>          m_isActive;
+  std::queue<std::size_t>    m_active;
+  std::deque<std::size_t>    m_orphans;
+  std::uint32_t              m_time;
+  std::int64_t               m_flow;
+};
+} // anonymous namespace
+
+std::ostream& operator<<(std::ostream& os, Segment segment)
+{
+  switch (segment) {
+  case Segment::Source: os << "Source"; break;
+  case Segment::Sink: os << "Sink"; break;
+  }
+
+  return os;
+}
+
+Result::Result(
+  std::int64_t         maxFlow,
+  std::size_t          width,
+  std::vector<Segment> segments)
+  : m_maxFlow{maxFlow}, m_width{width}, m_segments{std::move(segments)}
+{
+}
+
+std::int64_t Result::maxFlow() const { return m_maxFlow; }
+
+Segment Result::segmentOf(std::size_t x, std::size_t y) const
+{
+  const std::size_t index{y * m_width + x};
+  G_ASSERT(
+    x < m_width && index < m_segments.size(),
+    "Pixel (%zu, %zu) is outside of the image!",
+    x,
+    y);
+  return m_segments[index];
+}
+
+const std::vector<Segment>& Result::segments() const { return m_segments; }
+
+Result algorithm(GridGraph graph)
+{
+  BoykovKolmogorov   boykovKolmogorov{graph};
+  const std::int64_t maxFlow{boykovKolmogorov.run()};
+  std::vector<Segment> segments{};
+  segments.reserve(graph.width() * graph.height());
+
+  for (std::size_t y{0}; y < graph.height(); ++y) {
+    for (std::size_t x{0}; x < graph.width(); ++x) {
+      segments.push_back(
+        boykovKolmogorov.isInSourceTree(graph.pixelAt(x, y)) ? Segment::Source
+                                                             : Segment::Sink);
+    }
+  }
+
+  return Result{maxFlow, graph.width(), std::move(segments)};
+}
+} // namespace g::algo::boykov_kolmogorov
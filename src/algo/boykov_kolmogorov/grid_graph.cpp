@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <array>
+#include <ostream>
+
+#include "algo/boykov_kolmogorov/grid_graph.hpp"
+#include "graph_exception.hpp"
+#include "throw.hpp"
+
+namespace g::algo::boykov_kolmogorov {
+namespace {
+constexpr std::array<std::ptrdiff_t, 8> dx{1, 1, 0, -1, -1, -1, 0, 1};
+constexpr std::array<std::ptrdiff_t, 8> dy{0, 1, 1, 1, 0, -1, -1, -1};
+} // anonymous namespace
+
+std::ostream& operator<<(std::ostream& os, Connectivity connectivity)
+{
+  switch (connectivity) {
+  case Connectivity::Four: os << "Four"; break;
+  case Connectivity::Eight: os << "Eight"; break;
+  }
+
+  return os;
+}
+
+std::ostream& operator<<(std::ostream& os, Neighbor neighbor)
+{
+  switch (neighbor) {
+  case Neighbor::East: os << "East"; break;
+  case Neighbor::SouthEast: os << "SouthEast"; break;
+  case Neighbor::South: os << "South"; break;
+  case Neighbor::SouthWest: os << "SouthWest"; break;
+  case Neighbor::West: os << "West"; break;
+  case Neighbor::NorthWest: os << "NorthWest"; break;
+  case Neighbor::North: os << "North"; break;
+  case Neighbor::NorthEast: os << "NorthEast"; break;
+  }
+
+  return os;
+}
+
+GridGraph::GridGraph(
+  std::size_t  width,
+  std::size_t  height,
+  Connectivity connectivity)
+  : m_width{width}
+  , m_height{height}
+  , m_connectivity{connectivity}
+  , m_slotCount{connectivity == Connectivity::Four ? 4U : 8U}
+  , m_slotOffset(m_slotCount)
+  , m_residuals((width + 2) * (height + 2) * m_slotCount, 0)
+  , m_terminals((width + 2) * (height + 2), 0)
+  , m_constantFlow{0}
+{
+  const std::size_t step{8 / m_slotCount};
+  const auto        stride{static_cast<std::ptrdiff_t>(width + 2)};
+
+  for (std::size_t slot{0}; slot < m_slotCount; ++slot) {
+    m_slotOffset[slot] = dy[slot * step] * stride + dx[slot * step];
+  }
+}
+
+std::size_t GridGraph::width() const { return m_width; }
+
+std::size_t GridGraph::height() const { return m_height; }
+
+Connectivity GridGraph::connectivity() const { return m_connectivity; }
+
+void GridGraph::setEdgeCapacity(
+  std::size_t  x,
+  std::size_t  y,
+  Neighbor     neighbor,
+  std::int32_t capacity)
+{
+  checkPixel(x, y);
+  const std::size_t    slot{slotOf(neighbor)};
+  const auto           value{static_cast<std::size_t>(neighbor)};
+  const std::ptrdiff_t neighborX{static_cast<std::ptrdiff_t>(x) + dx[value]};
+  const std::ptrdiff_t neighborY{static_cast<std::ptrdiff_t>(y) + dy[value]};
+
+  if (
+    neighborX < 0 || neighborY < 0
+    || neighborX >= static_cast<std::ptrdiff_t>(m_width)
+    || neighborY >= static_cast<std::ptrdiff_t>(m_height)) {
+    G_THROW(
+      GraphException,
+      "The neighbor of pixel (%zu, %zu) is outside of the image!",
+      x,
+      y);
+  }
+
+  if (capacity < 0) {
+    G_THROW(
+      GraphException,
+      "Negative capacity %d for pixel (%zu, %zu)!",
+      capacity,
+      x,
+      y);
+  }
+
+  m_residuals[pixelAt(x, y) * m_slotCount + slot] = capacity;
+}
+
+void GridGraph::addTerminalCapacities(
+  std::size_t  x,
+  std::size_t  y,
+  std::int64_t source,
+  std::int64_t sink)
+{
+  checkPixel(x, y);
+
+  if (source < 0 || sink < 0) {
+    G_THROW(
+      GraphException,
+      "Negative terminal capacity for pixel (%zu, %zu)!",
+      x,
+      y);
+  }
+
+  // The residual already stored is capacity of one terminal edge, which can
+  // pair up with capacity added to the other one.
+  std::int64_t& terminal{m_terminals[pixelAt(x, y)]};
+
+  if (terminal > 0) { source += terminal; }
+  else { sink -= terminal; }
+
+  m_constantFlow += std::min(source, sink);
+  terminal = source - sink;
+}
+
+std::size_t GridGraph::slotCount() const { return m_slotCount; }
+
+std::size_t GridGraph::pixelAt(std::size_t x, std::size_t y) const
+{
+  return (y + 1) * (m_width + 2) + (x + 1);
+}
+
+std::size_t GridGraph::paddedPixelCount() const { return m_terminals.size(); }
+
+std::vector<std::int32_t>& GridGraph::residuals() { return m_residuals; }
+
+std::vector<std::int64_t>& GridGraph::terminals() { return m_terminals; }
+
+std::int64_t GridGraph::constantFlow() const { return m_constantFlow; }
+
+std::size_t GridGraph::slotOf(Neighbor neighbor) const
+{
+  const auto value{static_cast<std::size_t>(neighbor)};
+
+  if (m_connectivity == Connectivity::Eight) { return value; }
+
+  if ((value % 2) != 0) {
+    G_THROW(
+      GraphException,
+      "Diagonal neighbor %zu used with 4-connectivity!",
+      value);
+  }
+
+  return value / 2;
+}
+
+void GridGraph::checkPixel(std::size_t x, std::size_t y) const
+{
+  if (x >= m_width || y >= m_height) {
+    G_THROW(
+      GraphException,
+      "Pixel (%zu, %zu) is outside of the %zux%zu image!",
+      x,
+      y,
+      m_width,
+      m_height);
+  }
+}
+} // namespace g::algo::boykov_kolmogorov
@@ -0,0 +1,148 @@
+#include <cstdint>
+
+#include <algorithm>
+#include <numeric>
+
+#include "algo/condensation.hpp"
+
+namespace g::algo {
+namespace {
+constexpr std::size_t unvisited{SIZE_MAX};
+
+/*!
+ * \brief Finds the strongly connected components with Tarjan's algorithm.
+ * \param adjacency The graph.
+ * \param componentCount Set to the count of components found.
+ * \return The component of every vertex by dense index, numbered in the
+ *         order in which the components are completed.
+ **/
+std::vector<std::size_t> stronglyConnectedComponents(
+  const IndexedAdjacency& adjacency,
+  std::size_t&            componentCount)
+{
+  struct Frame {
+    std::size_t vertex;
+    std::size_t arc; /*!< The next arc to look at */
+  };
+
+  const std::size_t        vertexCount{adjacency.vertexCount()};
+  std::vector<std::size_t> order(vertexCount, unvisited);
+  std::vector<std::size_t> lowLink(vertexCount, 0);
+  std::vector<std::size_t> componentOf(vertexCount, unvisited);
+  std::vector<std::size_t> stack{};
+  std::vector<Frame>       callStack{};
+  std::size_t              counter{0};
+  componentCount = 0;
+
+  const auto discover{[&](std::size_t vertex) {
+    order[vertex]   = counter;
+    lowLink[vertex] = counter;
+    ++counter;
+    stack.push_back(vertex);
+    callStack.push_back(Frame{vertex, adjacency.firstArc(vertex)});
+  }};
+
+  for (std::size_t root{0}; root < vertexCount; ++root) {
+    if (order[root] != unvisited) { continue; }
+
+    discover(root);
+
+    while (!callStack.empty()) {
+      Frame& frame{callStack.back()};
+
+      if (frame.arc < adjacency.lastArc(frame.vertex)) {
+        const std::size_t target{adjacency.target(frame.arc)};
+        ++frame.arc;
+
+        if (order[target] == unvisited) { discover(target); }
+        else if (componentOf[target] == unvisited) {
+          // Still on the stack, so part of the component being built.
+          lowLink[frame.vertex]
+            = std::min(lowLink[frame.vertex], order[target]);
+        }
+
+        continue;
+      }
+
+      const std::size_t vertex{frame.vertex};
+      callStack.pop_back();
+
+      if (lowLink[vertex] == order[vertex]) {
+        std::size_t member{};
+
+        do {
+          member = stack.back();
+          stack.pop_back();
+          componentOf[member] = componentCount;
+        } while (member != vertex);
+
+        ++componentCount;
+      }
+
+      if (!callStack.empty()) {
+        const std::size_t parent{callStack.back().vertex};
+        lowLink[parent] = std::min(lowLink[parent], lowLink[vertex]);
+      }
+    }
+  }
+
+  return componentOf;
+}
+} // anonymous namespace
+
+Condensation::Condensation(const IndexedAdjacency& adjacency)
+  : m_componentOf{}, m_firstArc{0}, m_target{}
+{
+  std::size_t componentCount{0};
+  m_componentOf = stronglyConnectedComponents(adjacency, componentCount);
+
+  // Groups the vertices by component, so that the arcs of a component are
+  // scanned together and duplicates can be skipped with a single array.
+  std::vector<std::size_t> firstVertex(componentCount + 1, 0);
+
+  for (std::size_t component : m_componentOf) {
+    ++firstVertex[component + 1];
+  }
+
+  std::partial_sum(firstVertex.begin(), firstVertex.end(), firstVertex.begin());
+  std::vector<std::size_t> vertices(adjacency.vertexCount());
+  std::vector<std::size_t> position{firstVertex};
+
+  for (std::size_t v{0}; v < adjacency.vertexCount(); ++v) {
+    vertices[position[m_componentOf[v]]++] = v;
+  }
+
+  std::vector<std::size_t> lastSeenFrom(componentCount, unvisited);
+
+  for (std::size_t component{0}; component < componentCount; ++component) {
+    for (std::size_t i{firstVertex[component]}; i < firstVertex[component + 1];
+         ++i) {
+      const std::size_t v{vertices[i]};
+
+      for (std::size_t arc{adjacency.firstArc(v)}; arc < adjacency.lastArc(v);
+           ++arc) {
+        const std::size_t successor{m_componentOf[adjacency.target(arc)]};
+
+        if (successor != component && lastSeenFrom[successor] != component) {
+          lastSeenFrom[successor] = component;
+          m_target.push_back(successor);
+        }
+      }
+    }
+
+    m_firstArc.push_back(m_target.size());
+  }
+}
+
+std::size_t Condensation::componentCount() const
+{
+  return m_firstArc.size() - 1;
+}
+
+std::size_t Condensation::arcCount() const { return m_target.size(); }
+
+const std::vector<std::size_t>& Condensation::componentsOf() const
+{
+  return m_componentOf;
+}
+} // namespace g::algo
@@ -0,0 +1,201 @@
+#include <algorithm>
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "algo/dijkstra/dense.hpp"
+#include "graph_exception.hpp"
+#include "throw.hpp"
+
+namespace g::algo::dijkstra::detail {
+namespace {
+constexpr std::int64_t infinity{INT64_MAX};
+
+/*!
+ * \brief The count of 64 bit lanes that the arrays are padded to.
+ **/
+constexpr std::size_t lanes{4};
+
+template<typename Type>
+using AlignedVector = std::vector<Type, g::detail::AlignedAllocator<Type, 64>>;
+
+#if defined(__AVX2__)
+__m256i load(const void* address)
+{
+  return _mm256_load_si256(static_cast<const __m256i*>(address));
+}
+
+void store(void* address, __m256i value)
+{
+  _mm256_store_si256(static_cast<__m256i*>(address), value);
+}
+#endif
+
+/*!
+ * \brief Finds the vertex with the least key.
+ * \param key The keys, padded to a multiple of `lanes`.
+ * \return The index of the first least key, or `key.size()` if every key is
+ *         infinity.
+ **/
+std::size_t argMin(const AlignedVector<std::int64_t>& key)
+{
+#if defined(__AVX2__)
+  __m256i least{_mm256_set1_epi64x(infinity)};
+
+  for (std::size_t i{0}; i < key.size(); i += lanes) {
+    const __m256i value{load(&key[i])};
+    least = _mm256_blendv_epi8(
+      least, value, _mm256_cmpgt_epi64(least, value));
+  }
+
+  alignas(32) std::int64_t leastLanes[lanes];
+  store(leastLanes, least);
+  const std::int64_t minimum{*std::min_element(leastLanes, leastLanes + lanes)};
+
+  if (minimum == infinity) { return key.size(); }
+
+  const __m256i wanted{_mm256_set1_epi64x(minimum)};
+
+  for (std::size_t i{0};; i += lanes) {
+    if (const int mask{_mm256_movemask_pd(
+          _mm256_castsi256_pd(_mm256_cmpeq_epi64(load(&key[i]), wanted)))};
+        mask != 0) {
+      return i + static_cast<std::size_t>(std::countr_zero(
+                   static_cast<unsigned>(mask)));
+    }
+  }
+#else
+  std::size_t  result{key.size()};
+  std::int64_t minimum{infinity};
+
+  for (std::size_t i{0}; i < key.size(); ++i) {
+    if (key[i] < minimum) {
+      minimum = key[i];
+      result  = i;
+    }
+  }
+
+  return result;
+#endif
+}
+
+/*!
+ * \brief Relaxes every edge leaving `vertex`.
+ * \param row The weights of the edges leaving `vertex`, infinity if there
+ *            is no edge.
+ * \return true if `row` contains a negative weight; otherwise false.
+ **/
+bool relax(
+  std::size_t                        vertex,
+  const AlignedVector<std::int64_t>& row,
+  AlignedVector<std::int64_t>&       distance,
+  AlignedVector<std::int64_t>&       key,
+  AlignedVector<std::size_t>&        predecessor)
+{
+  const std::int64_t base{distance[vertex]};
+
+#if defined(__AVX2__)
+  const __m256i bases{_mm256_set1_epi64x(base)};
+  const __m256i vertices{
+    _mm256_set1_epi64x(static_cast<std::int64_t>(vertex))};
+  const __m256i infinities{_mm256_set1_epi64x(infinity)};
+  const __m256i limits{_mm256_set1_epi64x(infinity - base)};
+  __m256i       negative{_mm256_setzero_si256()};
+
+  for (std::size_t i{0}; i < row.size(); i += lanes) {
+    const __m256i weight{load(&row[i])};
+    const __m256i current{load(&distance[i])};
+    const __m256i candidate{_mm256_add_epi64(bases, weight)};
+    // A weight above `limits` would wrap the sum around to a negative one.
+    const __m256i improves{_mm256_andnot_si256(
+      _mm256_cmpgt_epi64(weight, limits),
+      _mm256_and_si256(
+        _mm256_cmpgt_epi64(infinities, weight),
+        _mm256_cmpgt_epi64(current, candidate)))};
+    negative = _mm256_or_si256(
+      negative, _mm256_cmpgt_epi64(_mm256_setzero_si256(), weight));
+
+    if (_mm256_testz_si256(improves, improves) != 0) { continue; }
+
+    store(&distance[i], _mm256_blendv_epi8(current, candidate, improves));
+    store(&key[i], _mm256_blendv_epi8(load(&key[i]), candidate, improves));
+    store(
+      &predecessor[i],
+      _mm256_blendv_epi8(load(&predecessor[i]), vertices, improves));
+  }
+
+  return _mm256_testz_si256(negative, negative) == 0;
+#else
+  bool isNegative{false};
+
+  for (std::size_t i{0}; i < row.size(); ++i) {
+    if (row[i] == infinity) { continue; }
+
+    isNegative = isNegative || row[i] < 0;
+
+    // The sum would not fit, so the path is no shorter than unreachable.
+    if (row[i] > infinity - base) { continue; }
+
+    if (const std::int64_t candidate{base + row[i]}; candidate < distance[i]) {
+      distance[i]    = candidate;
+      key[i]         = candidate;
+      predecessor[i] = vertex;
+    }
+  }
+
+  return isNegative;
+#endif
+}
+} // anonymous namespace
+
+DenseShortestPaths denseShortestPaths(
+  std::size_t      vertexCount,
+  std::size_t      source,
+  const RowFiller& fillRow)
+{
+  if (source >= vertexCount) {
+    G_THROW(
+      GraphException,
+      "source (%zu) is not less than the vertex count (%zu)",
+      source,
+      vertexCount);
+  }
+
+  const std::size_t paddedCount{(vertexCount + lanes - 1) / lanes * lanes};
+  AlignedVector<std::int64_t> distance(paddedCount, infinity);
+  // The distance of every vertex that is not settled yet, else infinity.
+  AlignedVector<std::int64_t> key(paddedCount, infinity);
+  AlignedVector<std::size_t> predecessor(
+    paddedCount, DenseShortestPaths::none);
+  AlignedVector<std::int64_t> row(paddedCount);
+
+  distance[source] = 0;
+  key[source]      = 0;
+
+  // With non negative weights a settled vertex is never improved again, so
+  // the relaxation does not have to skip settled vertices.
+  for (std::size_t vertex{argMin(key)}; vertex != paddedCount;
+       vertex = argMin(key)) {
+    key[vertex] = infinity;
+    std::fill(row.begin(), row.end(), infinity);
+    fillRow(vertex, std::span<std::int64_t>{row.data(), vertexCount});
+
+    if (relax(vertex, row, distance, key, predecessor)) {
+      G_THROW(
+        GraphException,
+        "Vertex %zu has an edge with a negative weight.",
+        vertex);
+    }
+  }
+
+  return DenseShortestPaths{
+    std::vector<std::int64_t>(
+      distance.begin(),
+      distance.begin() + static_cast<std::ptrdiff_t>(vertexCount)),
+    std::vector<std::size_t>(
+      predecessor.begin(),
+      predecessor.begin() + static_cast<std::ptrdiff_t>(vertexCount))};
+}
+} // namespace g::algo::dijkstra::detail
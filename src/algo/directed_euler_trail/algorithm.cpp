@@ -0,0 +1,449 @@
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <utility>
+
+#include "algo/directed_euler_trail/algorithm.hpp"
+#include "graph_exception.hpp"
+#include "thread_team.hpp"
+#include "throw.hpp"
+
+namespace g::algo::directed_euler_trail {
+namespace {
+constexpr std::size_t none{std::numeric_limits<std::size_t>::max()};
+
+void checkOutput(
+  const Multigraph&              multigraph,
+  std::span<const std::uint32_t> output)
+{
+  if (multigraph.vertexCount() == 0) {
+    G_THROW(GraphException, "%s", "The multigraph given had no vertices.");
+  }
+
+  if (output.size() != multigraph.edgeCount() + 1) {
+    G_THROW(
+      GraphException,
+      "The output holds %zu vertices but the trail has %zu!",
+      output.size(),
+      multigraph.edgeCount() + 1);
+  }
+}
+
+[[noreturn]] void throwUnreachable(
+  const Multigraph& multigraph,
+  std::size_t       reachableEdgeCount,
+  std::size_t       start)
+{
+  G_THROW(
+    GraphException,
+    "The graph has no Euler trail: only %zu of %zu edges are reachable "
+    "from vertex %zu!",
+    reachableEdgeCount,
+    multigraph.edgeCount(),
+    multigraph.vertexIndex().vertexAt(start));
+}
+
+/*!
+ * \brief The walks of one thread, stored back to back.
+ **/
+struct Walks {
+  std::vector<std::uint32_t> vertices;
+  std::vector<std::size_t>   ends; /*!< One past the last vertex of a walk */
+};
+
+/*!
+ * \brief Walks from every vertex until every edge has been used.
+ * \param multigraph The multigraph.
+ * \param team The threads to walk with.
+ * \return The walks of every thread. A walk may end at another vertex than
+ *         the one it began at if another thread used the edges it needed.
+ **/
+std::vector<Walks> walk(const Multigraph& multigraph, ThreadTeam& team)
+{
+  const std::size_t vertexCount{multigraph.vertexCount()};
+
+  // The parallel edges of arc a are numbered [firstEdge[a], firstEdge[a + 1]).
+  std::vector<std::size_t> firstEdge(multigraph.arcCount() + 1, 0);
+
+  for (std::size_t arc{0}; arc < multigraph.arcCount(); ++arc) {
+    firstEdge[arc + 1] = firstEdge[arc] + multigraph.multiplicity(arc);
+  }
+
+  std::vector<std::atomic<std::size_t>> cursor(vertexCount);
+
+  for (std::size_t vertex{0}; vertex < vertexCount; ++vertex) {
+    cursor[vertex].store(
+      firstEdge[multigraph.firstArc(vertex)], std::memory_order_relaxed);
+  }
+
+  // Claims an unused edge leaving `vertex` and returns its target, or none.
+  const auto claim{[&](std::size_t vertex) {
+    const std::size_t lastEdge{firstEdge[multigraph.lastArc(vertex)]};
+
+    if (cursor[vertex].load(std::memory_order_relaxed) >= lastEdge) {
+      return none;
+    }
+
+    const std::size_t edge{
+      cursor[vertex].fetch_add(1, std::memory_order_relaxed)};
+
+    if (edge >= lastEdge) { return none; }
+
+    const auto arc{std::upper_bound(
+      firstEdge.begin() + static_cast<std::ptrdiff_t>(
+        multigraph.firstArc(vertex)),
+      firstEdge.begin() + static_cast<std::ptrdiff_t>(
+        multigraph.lastArc(vertex)),
+      edge)};
+
+    return std::size_t{multigraph.target(
+      static_cast<std::size_t>(arc - firstEdge.begin()) - 1)};
+  }};
+
+  std::vector<Walks> walks(team.threadCount());
+  team.parallelFor(
+    vertexCount,
+    [&claim, &walks](std::size_t begin, std::size_t end, std::size_t thread) {
+      Walks& own{walks[thread]};
+
+      for (std::size_t vertex{begin}; vertex < end; ++vertex) {
+        for (std::size_t next{claim(vertex)}; next != none;
+             next = claim(vertex)) {
+          own.vertices.push_back(static_cast<std::uint32_t>(vertex));
+
+          for (; next != none; next = claim(next)) {
+            own.vertices.push_back(static_cast<std::uint32_t>(next));
+          }
+
+          own.ends.push_back(own.vertices.size());
+        }
+      }
+    });
+
+  return walks;
+}
+
+/*!
+ * \brief Sub-trails stored back to back.
+ **/
+struct Trails {
+  std::vector<std::uint32_t> vertices;
+  std::vector<std::size_t>   begins; /*!< Plus vertices.size() at the end */
+
+  [[nodiscard]] std::size_t count() const { return begins.size() - 1; }
+
+  [[nodiscard]] std::size_t size(std::size_t trail) const
+  {
+    return begins[trail + 1] - begins[trail];
+  }
+};
+
+/*!
+ * \brief Joins walks end to start.
+ * \param multigraph The multigraph.
+ * \param walks The walks.
+ * \param start The vertex the Euler trail begins with.
+ * \return Trail 0 begins with `start` and may end elsewhere. Every other
+ *         trail is closed.
+ * \note Every vertex but the ends of the Euler trail begins as many walks as
+ *       it ends, so joining greedily can only get stuck where it began or
+ *       where the Euler trail ends.
+ **/
+Trails join(
+  const Multigraph&         multigraph,
+  const std::vector<Walks>& walks,
+  std::size_t               start)
+{
+  std::vector<std::span<const std::uint32_t>> spans{};
+
+  for (const Walks& own : walks) {
+    std::size_t begin{0};
+
+    for (const std::size_t end : own.ends) {
+      spans.emplace_back(own.vertices.data() + begin, end - begin);
+      begin = end;
+    }
+  }
+
+  // The walks beginning at a vertex form a list through `nextWalk`.
+  std::vector<std::size_t> firstWalk(multigraph.vertexCount(), none);
+  std::vector<std::size_t> nextWalk(spans.size());
+
+  for (std::size_t walk{0}; walk < spans.size(); ++walk) {
+    nextWalk[walk]                 = firstWalk[spans[walk].front()];
+    firstWalk[spans[walk].front()] = walk;
+  }
+
+  Trails trails{};
+  trails.vertices.reserve(multigraph.edgeCount() + spans.size() + 1);
+
+  const auto joinFrom{[&](std::size_t vertex) {
+    trails.begins.push_back(trails.vertices.size());
+    trails.vertices.push_back(static_cast<std::uint32_t>(vertex));
+
+    while (firstWalk[vertex] != none) {
+      const std::span<const std::uint32_t> walk{spans[firstWalk[vertex]]};
+      firstWalk[vertex] = nextWalk[firstWalk[vertex]];
+      trails.vertices.insert(
+        trails.vertices.end(), walk.begin() + 1, walk.end());
+      vertex = walk.back();
+    }
+  }};
+
+  joinFrom(start);
+
+  for (std::size_t vertex{0}; vertex < multigraph.vertexCount(); ++vertex) {
+    while (firstWalk[vertex] != none) { joinFrom(vertex); }
+  }
+
+  trails.begins.push_back(trails.vertices.size());
+  return trails;
+}
+
+/*!
+ * \brief Splices the closed trails into trail 0 and writes the result.
+ * \param multigraph The multigraph.
+ * \param trails The trails, as returned by `join`.
+ * \param start The vertex the Euler trail begins with.
+ * \param output Receives the Euler trail.
+ * \throws GraphException if some trails share no vertex with the others.
+ **/
+void splice(
+  const Multigraph&        multigraph,
+  const Trails&            trails,
+  std::size_t              start,
+  std::span<std::uint32_t> output)
+{
+  const std::size_t        trailCount{trails.count()};
+  std::vector<std::size_t> owner(multigraph.vertexCount(), none);
+  std::vector<std::size_t> component(trailCount);
+  std::vector<std::vector<std::pair<std::size_t, std::size_t>>> links(
+    trailCount);
+
+  for (std::size_t trail{0}; trail < trailCount; ++trail) {
+    component[trail] = trail;
+  }
+
+  const auto find{[&component](std::size_t trail) {
+    while (component[trail] != trail) {
+      trail = component[trail] = component[component[trail]];
+    }
+
+    return trail;
+  }};
+
+  // Links every trail to one that visited one of its vertices before and
+  // isn't connected to it yet, which makes the links a spanning forest.
+  // `owner` holds the position of the first visit of every vertex.
+  for (std::size_t trail{0}; trail < trailCount; ++trail) {
+    for (std::size_t position{trails.begins[trail]};
+         position < trails.begins[trail + 1];
+         ++position) {
+      std::size_t& first{owner[trails.vertices[position]]};
+
+      if (first == none) {
+        first = position;
+        continue;
+      }
+
+      const std::size_t other{static_cast<std::size_t>(
+        std::upper_bound(trails.begins.begin(), trails.begins.end(), first)
+        - trails.begins.begin() - 1)};
+
+      if (find(other) != find(trail)) {
+        component[find(other)] = find(trail);
+        links[trail].emplace_back(other, first);
+        links[other].emplace_back(trail, position);
+      }
+    }
+  }
+
+  // Hangs every trail off the trail 0 side of its link. A spliced trail
+  // starts and ends at the vertex it is linked at, so it may be spliced
+  // into whichever trail reaches that vertex first.
+  std::vector<std::size_t> offset(trailCount, none);
+  std::vector<std::size_t> firstPending(multigraph.vertexCount(), none);
+  std::vector<std::size_t> nextPending(trailCount, none);
+  std::vector<std::size_t> queue{0};
+  std::size_t              reachableEdgeCount{trails.size(0) - 1};
+  offset[0] = 0;
+
+  for (std::size_t head{0}; head < queue.size(); ++head) {
+    for (const auto& [trail, position] : links[queue[head]]) {
+      if (offset[trail] != none) { continue; }
+
+      const std::uint32_t vertex{trails.vertices[position]};
+      offset[trail]        = position - trails.begins[trail];
+      nextPending[trail]   = firstPending[vertex];
+      firstPending[vertex] = trail;
+      reachableEdgeCount += trails.size(trail) - 1;
+      queue.push_back(trail);
+    }
+  }
+
+  if (queue.size() != trailCount) {
+    throwUnreachable(multigraph, reachableEdgeCount, start);
+  }
+
+  /*!
+   * \brief The progress through a trail. Step k visits the vertex at
+   *        position (offset[trail] + k) % period of the trail.
+   **/
+  struct Frame {
+    std::size_t trail;
+    std::size_t period;
+    std::size_t step;
+    std::size_t last;
+  };
+
+  std::vector<Frame> frames{Frame{0, trails.size(0), 0, trails.size(0)}};
+  std::size_t        position{0};
+
+  while (!frames.empty()) {
+    Frame& frame{frames.back()};
+
+    if (frame.step == frame.last) {
+      frames.pop_back();
+      continue;
+    }
+
+    const std::uint32_t vertex{trails.vertices
+                                 [trails.begins[frame.trail]
+                                  + (offset[frame.trail] + frame.step++)
+                                      % frame.period]};
+    output[position++] = vertex;
+
+    if (const std::size_t trail{firstPending[vertex]}; trail != none) {
+      firstPending[vertex] = nextPending[trail];
+      frames.push_back(
+        Frame{trail, trails.size(trail) - 1, 1, trails.size(trail)});
+    }
+  }
+}
+} // anonymous namespace
+
+std::size_t trailStart(const Multigraph& multigraph)
+{
+  const std::size_t         vertexCount{multigraph.vertexCount()};
+  std::vector<std::int64_t> balance(vertexCount, 0);
+
+  for (std::size_t vertex{0}; vertex < vertexCount; ++vertex) {
+    for (std::size_t arc{multigraph.firstArc(vertex)};
+         arc < multigraph.lastArc(vertex);
+         ++arc) {
+      balance[vertex] += multigraph.multiplicity(arc);
+      balance[multigraph.target(arc)] -= multigraph.multiplicity(arc);
+    }
+  }
+
+  std::size_t start{vertexCount};
+  std::size_t endCount{0};
+
+  for (std::size_t vertex{0}; vertex < vertexCount; ++vertex) {
+    if (balance[vertex] == 1 && start == vertexCount) { start = vertex; }
+    else if (balance[vertex] == -1 && endCount == 0) { ++endCount; }
+    else if (balance[vertex] != 0) {
+      G_THROW(
+        GraphException,
+        "The graph has no Euler trail: vertex %zu has %lld more outgoing "
+        "than incoming edges!",
+        multigraph.vertexIndex().vertexAt(vertex),
+        static_cast<long long>(balance[vertex]));
+    }
+  }
+
+  if (start != vertexCount) { return start; }
+
+  // Every vertex is balanced, so the trail is a circuit.
+  for (std::size_t vertex{0}; vertex < vertexCount; ++vertex) {
+    if (multigraph.firstArc(vertex) != multigraph.lastArc(vertex)) {
+      return vertex;
+    }
+  }
+
+  return 0;
+}
+
+void writeEulerTrail(
+  const Multigraph&        multigraph,
+  std::span<std::uint32_t> output)
+{
+  checkOutput(multigraph, output);
+
+  const std::size_t          start{trailStart(multigraph)};
+  std::vector<std::size_t>   cursor(multigraph.vertexCount());
+  std::vector<std::uint32_t> remaining{multigraph.multiplicities()};
+  std::vector<std::uint32_t> stack{static_cast<std::uint32_t>(start)};
+  std::size_t                position{output.size()};
+
+  for (std::size_t vertex{0}; vertex < multigraph.vertexCount(); ++vertex) {
+    cursor[vertex] = multigraph.firstArc(vertex);
+  }
+
+  while (!stack.empty()) {
+    const std::uint32_t vertex{stack.back()};
+    std::size_t&        arc{cursor[vertex]};
+
+    while (arc < multigraph.lastArc(vertex) && remaining[arc] == 0) { ++arc; }
+
+    if (arc == multigraph.lastArc(vertex)) {
+      // At most one more vertex is finished than edges are used, so this
+      // never runs past the front of `output`.
+      output[--position] = vertex;
+      stack.pop_back();
+    }
+    else {
+      --remaining[arc];
+      stack.push_back(multigraph.target(arc));
+    }
+  }
+
+  if (position != 0) {
+    throwUnreachable(multigraph, output.size() - position - 1, start);
+  }
+}
+
+void writeEulerTrail(
+  const Multigraph&        multigraph,
+  std::span<std::uint32_t> output,
+  std::size_t              threadCount)
+{
+  checkOutput(multigraph, output);
+
+  const std::size_t start{trailStart(multigraph)};
+  ThreadTeam        team{threadCount};
+  splice(
+    multigraph, join(multigraph, walk(multigraph, team), start), start, output);
+}
+
+namespace {
+std::vector<VertexIdentifier> toVertices(
+  const Multigraph&                 multigraph,
+  const std::vector<std::uint32_t>& trail)
+{
+  std::vector<VertexIdentifier> result(trail.size());
+
+  for (std::size_t i{0}; i < trail.size(); ++i) {
+    result[i] = multigraph.vertexIndex().vertexAt(trail[i]);
+  }
+
+  return result;
+}
+} // anonymous namespace
+
+std::vector<VertexIdentifier> algorithm(const Multigraph& multigraph)
+{
+  std::vector<std::uint32_t> trail(multigraph.edgeCount() + 1);
+  writeEulerTrail(multigraph, trail);
+  return toVertices(multigraph, trail);
+}
+
+std::vector<VertexIdentifier> algorithm(
+  const Multigraph& multigraph,
+  std::size_t       threadCount)
+{
+  std::vector<std::uint32_t> trail(multigraph.edgeCount() + 1);
+  writeEulerTrail(multigraph, trail, threadCount);
+  return toVertices(multigraph, trail);
+}
+} // namespace g::algo::directed_euler_trail
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <utility>
+
+#include "algo/directed_euler_trail/multigraph.hpp"
+#include "graph_exception.hpp"
+#include "throw.hpp"
+
+namespace g::algo::directed_euler_trail {
+Multigraph::Multigraph(VertexIndex vertexIndex, const std::vector<Edge>& edges)
+  : Multigraph{
+    std::move(vertexIndex),
+    edges,
+    std::vector<std::uint32_t>(edges.size(), 1)}
+{
+}
+
+Multigraph::Multigraph(
+  VertexIndex                       vertexIndex,
+  const std::vector<Edge>&          edges,
+  const std::vector<std::uint32_t>& multiplicities)
+  : m_vertexIndex{std::move(vertexIndex)}
+  , m_edgeCount{0}
+  , m_firstArc(m_vertexIndex.size() + 1, 0)
+  , m_target{}
+  , m_multiplicity{}
+{
+  if (edges.size() != multiplicities.size()) {
+    G_THROW(
+      GraphException,
+      "Got %zu edges but %zu multiplicities!",
+      edges.size(),
+      multiplicities.size());
+  }
+
+  if (m_vertexIndex.size() > UINT32_MAX) {
+    G_THROW(
+      GraphException,
+      "%zu vertices are too many for 32 bit targets!",
+      m_vertexIndex.size());
+  }
+
+  // Bucket the edges by their source, then sort every bucket by target so
+  // that parallel edges become adjacent and can be merged into one arc.
+  std::vector<std::uint32_t> sources(edges.size());
+  std::vector<std::size_t>   bucket(m_vertexIndex.size() + 1, 0);
+
+  for (std::size_t i{0}; i < edges.size(); ++i) {
+    sources[i]
+      = static_cast<std::uint32_t>(m_vertexIndex.indexOf(edges[i].source()));
+    ++bucket[sources[i] + 1];
+  }
+
+  for (std::size_t vertex{0}; vertex < m_vertexIndex.size(); ++vertex) {
+    bucket[vertex + 1] += bucket[vertex];
+  }
+
+  std::vector<std::pair<std::uint32_t, std::uint64_t>> rows(edges.size());
+  std::vector<std::size_t> next(bucket.begin(), bucket.end() - 1);
+
+  for (std::size_t i{0}; i < edges.size(); ++i) {
+    rows[next[sources[i]]++] = {
+      static_cast<std::uint32_t>(m_vertexIndex.indexOf(edges[i].target())),
+      multiplicities[i]};
+  }
+
+  sources.clear();
+  sources.shrink_to_fit();
+  m_target.reserve(edges.size());
+  m_multiplicity.reserve(edges.size());
+
+  for (std::size_t vertex{0}; vertex < m_vertexIndex.size(); ++vertex) {
+    const auto rowBegin{
+      rows.begin() + static_cast<std::ptrdiff_t>(bucket[vertex])};
+    const auto rowEnd{
+      rows.begin() + static_cast<std::ptrdiff_t>(bucket[vertex + 1])};
+    std::sort(rowBegin, rowEnd);
+
+    for (auto it{rowBegin}; it != rowEnd;) {
+      const std::uint32_t target{it->first};
+      std::uint64_t       multiplicity{0};
+
+      for (; it != rowEnd && it->first == target; ++it) {
+        multiplicity += it->second;
+      }
+
+      if (multiplicity > UINT32_MAX) {
+        G_THROW(
+          GraphException,
+          "The edge from %zu to %zu has multiplicity %zu, which exceeds 32 "
+          "bits!",
+          m_vertexIndex.vertexAt(vertex),
+          m_vertexIndex.vertexAt(target),
+          static_cast<std::size_t>(multiplicity));
+      }
+
+      if (multiplicity != 0) {
+        m_target.push_back(target);
+        m_multiplicity.push_back(static_cast<std::uint32_t>(multiplicity));
+        m_edgeCount += multiplicity;
+      }
+    }
+
+    m_firstArc[vertex + 1] = m_target.size();
+  }
+
+  m_target.shrink_to_fit();
+  m_multiplicity.shrink_to_fit();
+}
+
+const VertexIndex& Multigraph::vertexIndex() const { return m_vertexIndex; }
+
+std::size_t Multigraph::vertexCount() const { return m_vertexIndex.size(); }
+
+std::size_t Multigraph::edgeCount() const { return m_edgeCount; }
+
+std::size_t Multigraph::arcCount() const { return m_target.size(); }
+
+const std::vector<std::uint32_t>& Multigraph::multiplicities() const
+{
+  return m_multiplicity;
+}
+} // namespace g::algo::directed_euler_trail
@@ -0,0 +1,285 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <utility>
+
+#include "algo/direction_optimizing_bfs/algorithm.hpp"
+
+namespace g::algo::direction_optimizing_bfs {
+namespace {
+constexpr std::size_t none{SIZE_MAX};
+constexpr std::size_t wordBits{64};
+
+/*!
+ * \brief Switch to bottom up once the arcs leaving the frontier outnumber
+ *        the arcs leaving unvisited vertices divided by this.
+ **/
+constexpr std::size_t alpha{15};
+
+/*!
+ * \brief Switch back to top down once a shrinking frontier holds less than
+ *        the vertices divided by this.
+ **/
+constexpr std::size_t beta{18};
+
+/*!
+ * \brief Shared state of the direction optimizing breadth first search.
+ **/
+class Search {
+public:
+  Search(
+    const IndexedAdjacency&   outgoing,
+    const IndexedAdjacency&   incoming,
+    ThreadTeam&               team,
+    std::vector<std::size_t>& distance,
+    std::vector<std::size_t>& parent)
+    : m_outgoing{outgoing}
+    , m_incoming{incoming}
+    , m_team{team}
+    , m_distance{distance}
+    , m_parent{parent}
+    , m_n{outgoing.vertexCount()}
+    , m_wordCount{(m_n + wordBits - 1) / wordBits}
+    , m_visited(m_wordCount, 0)
+    , m_frontier(m_wordCount, 0)
+    , m_next(m_wordCount, 0)
+    , m_threadVertices(team.threadCount())
+    , m_threadArcs(team.threadCount())
+    , m_frontierVertices{0}
+    , m_frontierArcs{0}
+  {
+    m_distance.assign(m_n, none);
+    m_parent.assign(m_n, none);
+
+    // The bits past the last vertex count as visited, so that the bottom up
+    // steps never look at them.
+    if (const std::size_t used{m_n % wordBits}; used != 0) {
+      m_visited.back() = ~std::uint64_t{0} << used;
+    }
+  }
+
+  void run(std::size_t source)
+  {
+    m_visited[source / wordBits] |= bitOf(source);
+    m_frontier[source / wordBits] |= bitOf(source);
+    m_distance[source] = 0;
+    m_frontierVertices = 1;
+    m_frontierArcs     = degreeOf(source);
+
+    std::size_t unexploredArcs{m_outgoing.arcCount() - m_frontierArcs};
+    std::size_t previousFrontierVertices{0};
+    bool        isBottomUp{false};
+
+    for (std::size_t level{0}; m_frontierVertices != 0; ++level) {
+      if (!isBottomUp && m_frontierArcs > unexploredArcs / alpha) {
+        isBottomUp = true;
+      }
+      else if (
+        isBottomUp && m_frontierVertices < previousFrontierVertices
+        && m_frontierVertices < m_n / beta) {
+        isBottomUp = false;
+      }
+
+      previousFrontierVertices = m_frontierVertices;
+
+      if (isBottomUp) { bottomUpStep(level); }
+      else { topDownStep(level); }
+
+      std::swap(m_frontier, m_next);
+      countFrontier();
+      unexploredArcs -= m_frontierArcs;
+    }
+  }
+
+private:
+  [[nodiscard]] static std::uint64_t bitOf(std::size_t vertex)
+  {
+    return std::uint64_t{1} << (vertex % wordBits);
+  }
+
+  [[nodiscard]] std::size_t degreeOf(std::size_t vertex) const
+  {
+    return m_outgoing.lastArc(vertex) - m_outgoing.firstArc(vertex);
+  }
+
+  /*!
+   * \brief Every vertex of the frontier claims its unvisited targets. Two
+   *        threads may race for a target, so the visited bitmap is updated
+   *        atomically and only the winner writes the parent.
+   **/
+  void topDownStep(std::size_t level)
+  {
+    m_team.parallelFor(
+      m_wordCount,
+      [this, level](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t word{begin}; word < end; ++word) {
+          for (std::uint64_t bits{m_frontier[word]}; bits != 0;
+               bits &= bits - 1) {
+            const std::size_t vertex{
+              word * wordBits + std::countr_zero(bits)};
+
+            for (std::size_t arc{m_outgoing.firstArc(vertex)};
+                 arc < m_outgoing.lastArc(vertex);
+                 ++arc) {
+              const std::size_t   target{m_outgoing.target(arc)};
+              const std::uint64_t bit{bitOf(target)};
+              std::atomic_ref<std::uint64_t> visited{
+                m_visited[target / wordBits]};
+
+              if (
+                (visited.load(std::memory_order_relaxed) & bit) != 0
+                || (visited.fetch_or(bit, std::memory_order_relaxed) & bit)
+                     != 0) {
+                continue;
+              }
+
+              m_parent[target]   = vertex;
+              m_distance[target] = level + 1;
+              std::atomic_ref<std::uint64_t>{m_next[target / wordBits]}
+                .fetch_or(bit, std::memory_order_relaxed);
+            }
+          }
+        }
+      });
+  }
+
+  /*!
+   * \brief Every unvisited vertex looks for a parent in the frontier. A
+   *        thread owns whole words of the bitmaps, so no atomics are needed.
+   **/
+  void bottomUpStep(std::size_t level)
+  {
+    m_team.parallelFor(
+      m_wordCount,
+      [this, level](std::size_t begin, std::size_t end, std::size_t) {
+        for (std::size_t word{begin}; word < end; ++word) {
+          std::uint64_t found{0};
+
+          for (std::uint64_t bits{~m_visited[word]}; bits != 0;
+               bits &= bits - 1) {
+            const std::size_t vertex{
+              word * wordBits + std::countr_zero(bits)};
+
+            for (std::size_t arc{m_incoming.firstArc(vertex)};
+                 arc < m_incoming.lastArc(vertex);
+                 ++arc) {
+              const std::size_t source{m_incoming.target(arc)};
+
+              if ((m_frontier[source / wordBits] & bitOf(source)) != 0) {
+                m_parent[vertex]   = source;
+                m_distance[vertex] = level + 1;
+                found |= bitOf(vertex);
+                break;
+              }
+            }
+          }
+
+          m_visited[word] |= found;
+          m_next[word] = found;
+        }
+      });
+  }
+
+  /*!
+   * \brief Counts the vertices of the new frontier and the arcs leaving
+   *        them, and clears the old frontier for the next step.
+   **/
+  void countFrontier()
+  {
+    std::fill(m_threadVertices.begin(), m_threadVertices.end(), 0);
+    std::fill(m_threadArcs.begin(), m_threadArcs.end(), 0);
+
+    m_team.parallelFor(
+      m_wordCount,
+      [this](std::size_t begin, std::size_t end, std::size_t thread) {
+        std::size_t vertices{0};
+        std::size_t arcs{0};
+
+        for (std::size_t word{begin}; word < end; ++word) {
+          vertices += std::popcount(m_frontier[word]);
+
+          for (std::uint64_t bits{m_frontier[word]}; bits != 0;
+               bits &= bits - 1) {
+            arcs += degreeOf(word * wordBits + std::countr_zero(bits));
+          }
+
+          m_next[word] = 0;
+        }
+
+        m_threadVertices[thread] += vertices;
+        m_threadArcs[thread] += arcs;
+      });
+
+    m_frontierVertices = 0;
+    m_frontierArcs     = 0;
+
+    for (std::size_t thread{0}; thread < m_team.threadCount(); ++thread) {
+      m_frontierVertices += m_threadVertices[thread];
+      m_frontierArcs += m_threadArcs[thread];
+    }
+  }
+
+  const IndexedAdjacency&    m_outgoing;
+  const IndexedAdjacency&    m_incoming;
+  ThreadTeam&                m_team;
+  std::vector<std::size_t>&  m_distance;
+  std::vector<std::size_t>&  m_parent;
+  std::size_t                m_n;
+  std::size_t                m_wordCount;
+  std::vector<std::uint64_t> m_visited;
+  std::vector<std::uint64_t> m_frontier;
+  std::vector<std::uint64_t> m_next;
+  std::vector<std::size_t>   m_threadVertices;
+  std::vector<std::size_t>   m_threadArcs;
+  std::size_t                m_frontierVertices;
+  std::size_t                m_frontierArcs;
+};
+} // anonymous namespace
+
+Result::Result(
+  VertexIndex              vertexIndex,
+  std::vector<std::size_t> distance,
+  std::vector<std::size_t> parent)
+  : m_vertexIndex{std::move(vertexIndex)}
+  , m_distance{std::move(distance)}
+  , m_parent{std::move(parent)}
+{
+}
+
+bool Result::isReachable(VertexIdentifier vertex) const
+{
+  return m_distance[m_vertexIndex.indexOf(vertex)] != none;
+}
+
+std::optional<std::size_t> Result::distanceTo(VertexIdentifier vertex) const
+{
+  const std::size_t distance{m_distance[m_vertexIndex.indexOf(vertex)]};
+
+  if (distance == none) { return std::nullopt; }
+
+  return distance;
+}
+
+std::optional<VertexIdentifier> Result::parentOf(VertexIdentifier vertex) const
+{
+  const std::size_t parent{m_parent[m_vertexIndex.indexOf(vertex)]};
+
+  if (parent == none) { return std::nullopt; }
+
+  return m_vertexIndex.vertexAt(parent);
+}
+
+namespace detail {
+void breadthFirstSearch(
+  const IndexedAdjacency&   outgoing,
+  const IndexedAdjacency&   incoming,
+  std::size_t               source,
+  ThreadTeam&               team,
+  std::vector<std::size_t>& distance,
+  std::vector<std::size_t>& parent)
+{
+  Search search{outgoing, incoming, team, distance, parent};
+  search.run(source);
+}
+} // namespace detail
+} // namespace g::algo::direction_optimizing_bfs
@@ -0,0 +1,66 @@
+#include "algo/fleury/algorithm.hpp"
+
+namespace g::algo::fleury::detail {
+std::vector<std::size_t> eulerTrail(const IndexedAdjacency& adjacency)
+{
+  const std::size_t        vertexCount{adjacency.vertexCount()};
+  std::vector<std::size_t> remainingArcs(vertexCount);
+  std::vector<std::size_t> cursor(vertexCount);
+  std::size_t              start{vertexCount};
+  std::size_t              oddStart{vertexCount};
+
+  for (std::size_t vertex{0}; vertex < vertexCount; ++vertex) {
+    cursor[vertex]        = adjacency.firstArc(vertex);
+    remainingArcs[vertex] = adjacency.lastArc(vertex) - cursor[vertex];
+    std::size_t degree{0};
+
+    // A loop has a single arc but adds 2 to the degree.
+    for (std::size_t arc{cursor[vertex]}; arc < adjacency.lastArc(vertex);
+         ++arc) {
+      degree += adjacency.target(arc) == vertex ? 2 : 1;
+    }
+
+    if (start == vertexCount && degree != 0) { start = vertex; }
+
+    if (oddStart == vertexCount && degree % 2 != 0) { oddStart = vertex; }
+  }
+
+  if (oddStart != vertexCount) { start = oddStart; }
+
+  if (start == vertexCount) { return {0}; }
+
+  BridgeOracle             oracle{adjacency};
+  std::vector<std::size_t> trail{start};
+  trail.reserve(adjacency.edgeCount() + 1);
+
+  for (std::size_t vertex{start}; remainingArcs[vertex] != 0;) {
+    std::size_t& first{cursor[vertex]};
+
+    while (oracle.isRemoved(adjacency.edgeId(first))) { ++first; }
+
+    std::size_t arc{first};
+
+    if (remainingArcs[vertex] > 1) {
+      while (oracle.isRemoved(adjacency.edgeId(arc))
+             || oracle.isBridge(adjacency.edgeId(arc))) {
+        ++arc;
+        G_ASSERT(
+          arc < adjacency.lastArc(vertex),
+          "Every edge of vertex %zu is a bridge!",
+          adjacency.vertexIndex().vertexAt(vertex));
+      }
+    }
+
+    const std::size_t target{adjacency.target(arc)};
+    oracle.remove(adjacency.edgeId(arc));
+    --remainingArcs[vertex];
+
+    if (target != vertex) { --remainingArcs[target]; }
+
+    trail.push_back(target);
+    vertex = target;
+  }
+
+  return trail;
+}
+} // namespace g::algo::fleury::detail
@@ -0,0 +1,246 @@
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#include "algo/fleury/bridge_oracle.hpp"
+
+namespace g::algo::fleury {
+namespace {
+constexpr std::size_t none{std::numeric_limits<std::size_t>::max()};
+} // anonymous namespace
+
+std::vector<bool> findBridges(
+  const IndexedAdjacency&  adjacency,
+  const std::vector<bool>& isRemoved)
+{
+  const std::size_t        vertexCount{adjacency.vertexCount()};
+  std::vector<bool>        isBridge(adjacency.edgeCount(), false);
+  std::vector<std::size_t> order(vertexCount, none);
+  std::vector<std::size_t> low(vertexCount, none);
+  std::vector<std::size_t> parentEdge(vertexCount, none);
+  std::vector<std::size_t> cursor(vertexCount);
+  std::vector<std::size_t> stack{};
+  std::size_t              counter{0};
+
+  for (std::size_t vertex{0}; vertex < vertexCount; ++vertex) {
+    cursor[vertex] = adjacency.firstArc(vertex);
+  }
+
+  for (std::size_t root{0}; root < vertexCount; ++root) {
+    if (order[root] != none) { continue; }
+
+    order[root] = low[root] = counter++;
+    stack.push_back(root);
+
+    while (!stack.empty()) {
+      const std::size_t vertex{stack.back()};
+
+      if (cursor[vertex] < adjacency.lastArc(vertex)) {
+        const std::size_t arc{cursor[vertex]++};
+        const std::size_t edgeId{adjacency.edgeId(arc)};
+
+        // Skipping the parent by edge rather than by vertex keeps parallel
+        // edges from being reported as bridges.
+        if (isRemoved[edgeId] || edgeId == parentEdge[vertex]) { continue; }
+
+        const std::size_t target{adjacency.target(arc)};
+
+        if (order[target] == none) {
+          order[target] = low[target] = counter++;
+          parentEdge[target]          = edgeId;
+          stack.push_back(target);
+        }
+        else {
+          low[vertex] = std::min(low[vertex], order[target]);
+        }
+
+        continue;
+      }
+
+      stack.pop_back();
+
+      if (stack.empty()) { continue; }
+
+      const std::size_t parent{stack.back()};
+      low[parent] = std::min(low[parent], low[vertex]);
+
+      if (low[vertex] > order[parent]) { isBridge[parentEdge[vertex]] = true; }
+    }
+  }
+
+  return isBridge;
+}
+
+BridgeOracle::BridgeOracle(const IndexedAdjacency& adjacency)
+  : m_adjacency{adjacency}
+  , m_isRemoved(adjacency.edgeCount(), false)
+  , m_isBridge{}
+  , m_blockOf{}
+  , m_ends{}
+  , m_marks{}
+  , m_mark{0}
+  , m_searches{}
+  , m_computationCount{0}
+  , m_examinedArcCount{0}
+{
+}
+
+bool BridgeOracle::isBridge(std::size_t edgeId)
+{
+  if (m_computationCount == 0) {
+    m_isBridge = findBridges(m_adjacency, m_isRemoved);
+    ++m_computationCount;
+    label();
+  }
+
+  if (m_isBridge[edgeId]) { return true; }
+
+  const std::size_t source{m_ends[2 * edgeId]};
+  const std::size_t target{m_ends[2 * edgeId + 1]};
+
+  // A loop lies on a cycle of its own.
+  if (source == target) { return false; }
+
+  if (m_mark > std::numeric_limits<std::uint32_t>::max() - 2) {
+    std::fill(m_marks.begin(), m_marks.end(), 0);
+    m_mark = 0;
+  }
+
+  const std::array<std::size_t, 2>   ends{source, target};
+  const std::array<std::uint32_t, 2> marks{m_mark + 1, m_mark + 2};
+  m_mark += 2;
+
+  for (std::size_t side{0}; side < 2; ++side) {
+    Search& search{m_searches[side]};
+    m_marks[ends[side]] = marks[side];
+    search.queue.assign(1, ends[side]);
+    search.head = 0;
+    search.arc  = m_adjacency.firstArc(ends[side]);
+  }
+
+  for (std::size_t side{0};; side = 1 - side) {
+    switch (advance(m_searches[side], marks[side], marks[1 - side], edgeId)) {
+    case Outcome::Continue: break;
+    case Outcome::Met: return false;
+    case Outcome::Exhausted:
+      m_isBridge[edgeId] = true;
+      m_blockOf[edgeId]  = none;
+      return true;
+    }
+  }
+}
+
+void BridgeOracle::remove(std::size_t edgeId) { m_isRemoved[edgeId] = true; }
+
+bool BridgeOracle::isRemoved(std::size_t edgeId) const
+{
+  return m_isRemoved[edgeId];
+}
+
+std::size_t BridgeOracle::computationCount() const
+{
+  return m_computationCount;
+}
+
+std::size_t BridgeOracle::examinedArcCount() const
+{
+  return m_examinedArcCount;
+}
+
+void BridgeOracle::label()
+{
+  const std::size_t        vertexCount{m_adjacency.vertexCount()};
+  std::vector<std::size_t> blockOfVertex(vertexCount, none);
+  std::vector<std::size_t> stack{};
+  m_blockOf.assign(m_adjacency.edgeCount(), none);
+  m_ends.assign(2 * m_adjacency.edgeCount(), none);
+  m_marks.assign(vertexCount, 0);
+
+  for (std::size_t vertex{0}; vertex < vertexCount; ++vertex) {
+    for (std::size_t arc{m_adjacency.firstArc(vertex)};
+         arc < m_adjacency.lastArc(vertex);
+         ++arc) {
+      const std::size_t edgeId{m_adjacency.edgeId(arc)};
+
+      if (m_ends[2 * edgeId] == none) {
+        m_ends[2 * edgeId]     = vertex;
+        m_ends[2 * edgeId + 1] = m_adjacency.target(arc);
+      }
+    }
+  }
+
+  // The blocks are the connected components of the edges left over once
+  // the bridges have been taken out.
+  for (std::size_t root{0}; root < vertexCount; ++root) {
+    if (blockOfVertex[root] != none) { continue; }
+
+    blockOfVertex[root] = root;
+    stack.push_back(root);
+
+    while (!stack.empty()) {
+      const std::size_t vertex{stack.back()};
+      stack.pop_back();
+
+      for (std::size_t arc{m_adjacency.firstArc(vertex)};
+           arc < m_adjacency.lastArc(vertex);
+           ++arc) {
+        const std::size_t edgeId{m_adjacency.edgeId(arc)};
+
+        if (m_isRemoved[edgeId] || m_isBridge[edgeId]) { continue; }
+
+        m_blockOf[edgeId] = root;
+        const std::size_t target{m_adjacency.target(arc)};
+
+        if (blockOfVertex[target] == none) {
+          blockOfVertex[target] = root;
+          stack.push_back(target);
+        }
+      }
+    }
+  }
+}
+
+BridgeOracle::Outcome BridgeOracle::advance(
+  Search&       search,
+  std::uint32_t mark,
+  std::uint32_t otherMark,
+  std::size_t   edgeId)
+{
+  while (search.head < search.queue.size()) {
+    if (search.arc == m_adjacency.lastArc(search.queue[search.head])) {
+      if (++search.head < search.queue.size()) {
+        search.arc = m_adjacency.firstArc(search.queue[search.head]);
+      }
+
+      continue;
+    }
+
+    const std::size_t arc{search.arc++};
+    const std::size_t otherEdgeId{m_adjacency.edgeId(arc)};
+    ++m_examinedArcCount;
+
+    // Any other path between the ends of the edge closes a cycle with it,
+    // so it can't leave the block of the edge.
+    if (
+      otherEdgeId == edgeId || m_isRemoved[otherEdgeId]
+      || m_blockOf[otherEdgeId] != m_blockOf[edgeId]) {
+      return Outcome::Continue;
+    }
+
+    const std::size_t target{m_adjacency.target(arc)};
+
+    if (m_marks[target] == otherMark) { return Outcome::Met; }
+
+    if (m_marks[target] != mark) {
+      m_marks[target] = mark;
+      search.queue.push_back(target);
+    }
+
+    return Outcome::Continue;
+  }
+
+  return Outcome::Exhausted;
+}
+} // namespace g::algo::fleury
@@ -0,0 +1,17 @@
+#include "algo/fleury/is_bridge.hpp"
+
+namespace g::algo::fleury::detail {
+std::optional<std::size_t> findEdgeId(
+  const IndexedAdjacency& adjacency,
+  std::size_t             source,
+  std::size_t             target)
+{
+  for (std::size_t arc{adjacency.firstArc(source)};
+       arc < adjacency.lastArc(source);
+       ++arc) {
+    if (adjacency.target(arc) == target) { return adjacency.edgeId(arc); }
+  }
+
+  return std::nullopt;
+}
+} // namespace g::algo::fleury::detail
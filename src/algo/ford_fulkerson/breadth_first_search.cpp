@@ -1,22 +1,68 @@
 #include "algo/ford_fulkerson/breadth_first_search.hpp"
 
 namespace g::algo::ford_fulkerson {
-void enqueue(
-  std::queue<VertexIdentifier>&                q,
-  VertexIdentifier                             x,
-  std::unordered_map<VertexIdentifier, Color>& color)
-{
-  q.push(x);
-  color[x] = Color::Gray;
-}
+namespace {
+/*!
+ * \brief Follows the arcs with residual capacity and records the
+ *        predecessors until the target is found.
+ **/
+class ResidualVisitor {
+public:
+  ResidualVisitor(
+    const IndexedAdjacency&                       adjacency,
+    std::size_t                                   target,
+    const std::unordered_map<Edge, std::int32_t>& capacity,
+    const std::unordered_map<Edge, std::int32_t>& flow,
+    std::vector<std::size_t>&                     predecessor)
+    : m_adjacency{adjacency}
+    , m_target{target}
+    , m_capacity{capacity}
+    , m_flow{flow}
+    , m_predecessor{predecessor}
+  {
+  }
+
+  Step discoverVertex(std::size_t vertex) const
+  {
+    return vertex == m_target ? Step::Stop : Step::Continue;
+  }
+
+  bool examineArc(std::size_t source, std::size_t arc) const
+  {
+    const Edge edge{
+      m_adjacency.vertexIndex().vertexAt(source),
+      m_adjacency.vertexIndex().vertexAt(m_adjacency.target(arc))};
+    return m_capacity.at(edge) - m_flow.at(edge) > 0;
+  }
+
+  void treeArc(std::size_t source, std::size_t arc)
+  {
+    m_predecessor[m_adjacency.target(arc)] = source;
+  }
+
+private:
+  const IndexedAdjacency&                       m_adjacency;
+  std::size_t                                   m_target;
+  const std::unordered_map<Edge, std::int32_t>& m_capacity;
+  const std::unordered_map<Edge, std::int32_t>& m_flow;
+  std::vector<std::size_t>&                     m_predecessor;
+};
+} // anonymous namespace
 
-VertexIdentifier dequeue(
-  std::queue<VertexIdentifier>&                q,
-  std::unordered_map<VertexIdentifier, Color>& color)
+bool breadthFirstSearch(
+  const IndexedAdjacency&                       adjacency,
+  Traversal&                                    traversal,
+  std::size_t                                   start,
+  std::size_t                                   target,
+  const std::unordered_map<Edge, std::int32_t>& capacity,
+  const std::unordered_map<Edge, std::int32_t>& flow,
+  std::vector<std::size_t>&                     predecessor)
 {
-  const VertexIdentifier x{q.front()};
-  q.pop();
-  color[x] = Color::Black;
-  return x;
+  traversal.reset();
+  traversal.breadthFirst(
+    adjacency,
+    start,
+    ResidualVisitor{adjacency, target, capacity, flow, predecessor});
+  return traversal.isVisited(target);
 }
 } // namespace g::algo::ford_fulkerson
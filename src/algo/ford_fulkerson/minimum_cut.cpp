@@ -0,0 +1,29 @@
+#include <utility>
+
+#include "algo/ford_fulkerson/minimum_cut.hpp"
+
+namespace g::algo::ford_fulkerson {
+MinimumCut::MinimumCut(
+  std::int64_t                  capacity,
+  std::vector<VertexIdentifier> sourceSide,
+  std::vector<Edge>             cutEdges)
+  : m_capacity{capacity}
+  , m_sourceSide{std::move(sourceSide)}
+  , m_cutEdges{std::move(cutEdges)}
+{
+}
+
+std::int64_t MinimumCut::capacity() const { return m_capacity; }
+
+const std::vector<VertexIdentifier>& MinimumCut::sourceSide() const
+{
+  return m_sourceSide;
+}
+
+const std::vector<Edge>& MinimumCut::cutEdges() const { return m_cutEdges; }
+
+bool MinimumCut::isOnSourceSide(VertexIdentifier vertex) const
+{
+  return std::binary_search(m_sourceSide.begin(), m_sourceSide.end(), vertex);
+}
+} // namespace g::algo::ford_fulkerson
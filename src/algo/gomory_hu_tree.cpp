@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <utility>
+
+#include "algo/gomory_hu_tree.hpp"
+#include "algo/push_relabel/algorithm.hpp"
+#include "assert.hpp"
+
+namespace g::algo {
+GomoryHuTree::GomoryHuTree(
+  VertexIndex               vertexIndex,
+  std::vector<std::size_t>  parent,
+  std::vector<std::int64_t> weight)
+  : m_vertexIndex{std::move(vertexIndex)}
+  , m_parent{std::move(parent)}
+  , m_weight{std::move(weight)}
+  , m_depth(m_parent.size(), 0)
+{
+  std::vector<bool> isKnown(m_parent.size(), false);
+  std::vector<std::size_t> path{};
+
+  for (std::size_t v{0}; v < m_parent.size(); ++v) {
+    std::size_t u{v};
+
+    while (!isKnown[u] && m_parent[u] != u) {
+      path.push_back(u);
+      u = m_parent[u];
+    }
+
+    isKnown[u] = true;
+
+    for (auto it{path.rbegin()}; it != path.rend(); ++it) {
+      m_depth[*it] = m_depth[m_parent[*it]] + 1;
+      isKnown[*it] = true;
+    }
+
+    path.clear();
+  }
+}
+
+std::optional<VertexIdentifier> GomoryHuTree::parentOf(
+  VertexIdentifier vertex) const
+{
+  const std::size_t index{m_vertexIndex.indexOf(vertex)};
+
+  if (m_parent[index] == index) { return std::nullopt; }
+
+  return m_vertexIndex.vertexAt(m_parent[index]);
+}
+
+std::int64_t GomoryHuTree::weightToParent(VertexIdentifier vertex) const
+{
+  const std::size_t index{m_vertexIndex.indexOf(vertex)};
+  G_ASSERT(m_parent[index] != index, "Vertex %zu is the root.", vertex);
+  return m_weight[index];
+}
+
+std::int64_t GomoryHuTree::minimumCut(
+  VertexIdentifier u,
+  VertexIdentifier v) const
+{
+  G_ASSERT(u != v, "Both vertices were %zu.", u);
+
+  std::size_t  a{m_vertexIndex.indexOf(u)};
+  std::size_t  b{m_vertexIndex.indexOf(v)};
+  std::int64_t result{INT64_MAX};
+
+  while (a != b) {
+    if (m_depth[a] < m_depth[b]) { std::swap(a, b); }
+
+    result = std::min(result, m_weight[a]);
+    a      = m_parent[a];
+  }
+
+  return result;
+}
+
+namespace detail {
+GomoryHuTree gusfield(ResidualNetwork& network)
+{
+  const std::size_t         n{network.vertexCount()};
+  std::vector<std::size_t>  parent(n, 0);
+  std::vector<std::int64_t> weight(n, 0);
+
+  for (std::size_t s{1}; s < n; ++s) {
+    const std::size_t t{parent[s]};
+    network.reset();
+    const std::int64_t cut{push_relabel::detail::maximumPreflow(
+      network, s, t, push_relabel::SelectionRule::HighestLabel)};
+
+    // The vertices that can still reach t form the sink side of a minimum
+    // cut, everything else is on the side of s.
+    const std::vector<bool> isOnSinkSide{network.verticesReaching(t)};
+    weight[s] = cut;
+
+    for (std::size_t i{0}; i < n; ++i) {
+      if (i != s && !isOnSinkSide[i] && parent[i] == t) { parent[i] = s; }
+    }
+
+    if (!isOnSinkSide[parent[t]]) {
+      parent[s] = parent[t];
+      parent[t] = s;
+      weight[s] = weight[t];
+      weight[t] = cut;
+    }
+  }
+
+  return GomoryHuTree{network.vertexIndex(), std::move(parent), std::move(weight)};
+}
+} // namespace detail
+} // namespace g::algo
@@ -0,0 +1,262 @@
+#include <algorithm>
+#include <random>
+#include <utility>
+
+#include "algo/grail/algorithm.hpp"
+#include "assert.hpp"
+
+namespace g::algo::grail {
+namespace {
+constexpr std::uint32_t unvisited{UINT32_MAX};
+
+/*!
+ * \brief Determines whether the interval of `outer` contains the one of
+ *        `inner`.
+ **/
+bool contains(const Label& outer, const Label& inner) noexcept
+{
+  return outer.low <= inner.low && inner.rank <= outer.rank;
+}
+
+/*!
+ * \brief Determines whether `inner` is in the search tree below `outer`.
+ **/
+bool isBelow(const Label& outer, const Label& inner) noexcept
+{
+  return outer.first <= inner.rank && inner.rank <= outer.rank;
+}
+
+/*!
+ * \brief Runs one randomized depth first search over the components.
+ * \param condensation The components.
+ * \param roots The components without predecessors.
+ * \param seed The seed of the search.
+ * \return The label of every component.
+ **/
+std::vector<Label> labelOnce(
+  const Condensation&             condensation,
+  const std::vector<std::size_t>& roots,
+  std::size_t                     seed)
+{
+  struct Frame {
+    std::size_t component;
+    std::size_t offset; /*!< The first arc to follow, relative */
+    std::size_t done;   /*!< The count of arcs followed */
+  };
+
+  std::mt19937_64          engine{seed};
+  std::vector<std::size_t> order{roots};
+  std::vector<Label>       labels(
+    condensation.componentCount(), Label{unvisited, unvisited, unvisited});
+  std::vector<Frame> callStack{};
+  std::uint32_t      counter{0};
+
+  std::shuffle(order.begin(), order.end(), engine);
+
+  const auto discover{[&](std::size_t component) {
+    const std::size_t degree{
+      condensation.lastArc(component) - condensation.firstArc(component)};
+    labels[component].first = counter;
+    callStack.push_back(Frame{
+      component,
+      degree == 0 ? 0 : static_cast<std::size_t>(engine() % degree),
+      0});
+  }};
+
+  for (std::size_t root : order) {
+    discover(root);
+
+    while (!callStack.empty()) {
+      Frame&            frame{callStack.back()};
+      const std::size_t component{frame.component};
+      const std::size_t firstArc{condensation.firstArc(component)};
+      const std::size_t degree{condensation.lastArc(component) - firstArc};
+
+      if (frame.done < degree) {
+        const std::size_t target{condensation.target(
+          firstArc + (frame.offset + frame.done) % degree)};
+        ++frame.done;
+
+        // The graph is acyclic, so a component seen before is finished.
+        if (labels[target].first == unvisited) { discover(target); }
+        else {
+          labels[component].low
+            = std::min(labels[component].low, labels[target].low);
+        }
+
+        continue;
+      }
+
+      Label& label{labels[component]};
+      label.rank = counter++;
+      label.low  = std::min(label.low, label.rank);
+      callStack.pop_back();
+
+      if (!callStack.empty()) {
+        Label& parent{labels[callStack.back().component]};
+        parent.low = std::min(parent.low, label.low);
+      }
+    }
+  }
+
+  return labels;
+}
+} // anonymous namespace
+
+ReachabilityIndex::ReachabilityIndex(
+  VertexIndex        vertexIndex,
+  Condensation       condensation,
+  std::size_t        labelingCount,
+  std::vector<Label> labels)
+  : m_vertexIndex{std::move(vertexIndex)}
+  , m_condensation{std::move(condensation)}
+  , m_labelingCount{labelingCount}
+  , m_labels{std::move(labels)}
+  , m_visited(m_condensation.componentCount(), 0)
+  , m_search{0}
+  , m_stack{}
+{
+  G_ASSERT(
+    m_labels.size() == m_labelingCount * m_condensation.componentCount(),
+    "m_labels.size(): %zu, componentCount: %zu",
+    m_labels.size(),
+    m_condensation.componentCount());
+}
+
+const VertexIndex& ReachabilityIndex::vertexIndex() const
+{
+  return m_vertexIndex;
+}
+
+const Condensation& ReachabilityIndex::condensation() const
+{
+  return m_condensation;
+}
+
+std::size_t ReachabilityIndex::labelingCount() const
+{
+  return m_labelingCount;
+}
+
+std::span<const Label> ReachabilityIndex::labelsOf(
+  std::size_t component) const
+{
+  return std::span<const Label>{m_labels}.subspan(
+    component * m_labelingCount, m_labelingCount);
+}
+
+bool ReachabilityIndex::reaches(
+  VertexIdentifier source,
+  VertexIdentifier target)
+{
+  return reachesByIndex(
+    m_vertexIndex.indexOf(source), m_vertexIndex.indexOf(target));
+}
+
+bool ReachabilityIndex::reachesByIndex(std::size_t source, std::size_t target)
+{
+  const std::size_t from{m_condensation.componentOf(source)};
+  const std::size_t to{m_condensation.componentOf(target)};
+
+  if (const Verdict verdict{compare(from, to)}; verdict != Verdict::Maybe) {
+    return verdict == Verdict::Yes;
+  }
+
+  if (++m_search == 0) {
+    std::fill(m_visited.begin(), m_visited.end(), 0);
+    m_search = 1;
+  }
+
+  m_stack.clear();
+  m_stack.push_back(from);
+  m_visited[from] = m_search;
+
+  while (!m_stack.empty()) {
+    const std::size_t component{m_stack.back()};
+    m_stack.pop_back();
+
+    for (std::size_t arc{m_condensation.firstArc(component)};
+         arc < m_condensation.lastArc(component);
+         ++arc) {
+      const std::size_t next{m_condensation.target(arc)};
+
+      if (m_visited[next] == m_search) { continue; }
+
+      m_visited[next] = m_search;
+
+      const Verdict verdict{compare(next, to)};
+
+      if (verdict == Verdict::Yes) { return true; }
+
+      if (verdict == Verdict::Maybe) { m_stack.push_back(next); }
+    }
+  }
+
+  return false;
+}
+
+ReachabilityIndex::Verdict ReachabilityIndex::compare(
+  std::size_t source,
+  std::size_t target) const
+{
+  if (source == target) { return Verdict::Yes; }
+
+  // Components are numbered in reverse topological order.
+  if (source < target) { return Verdict::No; }
+
+  const std::span<const Label> sourceLabels{labelsOf(source)};
+  const std::span<const Label> targetLabels{labelsOf(target)};
+  Verdict                      verdict{Verdict::Maybe};
+
+  for (std::size_t i{0}; i < m_labelingCount; ++i) {
+    if (!contains(sourceLabels[i], targetLabels[i])) { return Verdict::No; }
+
+    if (isBelow(sourceLabels[i], targetLabels[i])) { verdict = Verdict::Yes; }
+  }
+
+  return verdict;
+}
+
+namespace detail {
+std::vector<Label> label(
+  const Condensation& condensation,
+  std::size_t         labelingCount,
+  ThreadTeam&         team)
+{
+  const std::size_t componentCount{condensation.componentCount()};
+  G_ASSERT(
+    componentCount < unvisited,
+    "Too many components for 32 bit ranks: %zu",
+    componentCount);
+
+  std::vector<bool> hasPredecessor(componentCount, false);
+
+  for (std::size_t arc{0}; arc < condensation.arcCount(); ++arc) {
+    hasPredecessor[condensation.target(arc)] = true;
+  }
+
+  std::vector<std::size_t> roots{};
+
+  for (std::size_t component{0}; component < componentCount; ++component) {
+    if (!hasPredecessor[component]) { roots.push_back(component); }
+  }
+
+  std::vector<Label> labels(componentCount * labelingCount);
+
+  team.parallelFor(
+    labelingCount,
+    [&](std::size_t begin, std::size_t end, std::size_t /* thread */) {
+      for (std::size_t i{begin}; i < end; ++i) {
+        const std::vector<Label> labeling{labelOnce(condensation, roots, i)};
+
+        for (std::size_t component{0}; component < componentCount;
+             ++component) {
+          labels[component * labelingCount + i] = labeling[component];
+        }
+      }
+    });
+
+  return labels;
+}
+} // namespace detail
+} // namespace g::algo::grail
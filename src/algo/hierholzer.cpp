@@ -3,24 +3,55 @@
 #include "algo/hierholzer.hpp"
 
 namespace g::algo::detail {
-void insertInto(
-  std::vector<VertexIdentifier>&       eulerCircuit,
-  const std::vector<VertexIdentifier>& subCircuit)
+std::vector<std::size_t> eulerCircuit(const IndexedAdjacency& adjacency)
 {
-  if (subCircuit.empty()) { return; }
+  const std::size_t vertexCount{adjacency.vertexCount()};
+  std::size_t       start{0};
+
+  while (start < vertexCount
+         && adjacency.firstArc(start) == adjacency.lastArc(start)) {
+    ++start;
+  }
+
+  if (start == vertexCount) { return {0}; }
+
+  std::vector<std::size_t> cursor(vertexCount);
+  std::vector<bool>        isUsed(adjacency.edgeCount(), false);
+  std::vector<std::size_t> stack{start};
+  std::vector<std::size_t> circuit{};
+  circuit.reserve(adjacency.edgeCount() + 1);
+
+  for (std::size_t vertex{0}; vertex < vertexCount; ++vertex) {
+    cursor[vertex] = adjacency.firstArc(vertex);
+  }
+
+  while (!stack.empty()) {
+    const std::size_t vertex{stack.back()};
+    std::size_t&      arc{cursor[vertex]};
+
+    while (arc < adjacency.lastArc(vertex) && isUsed[adjacency.edgeId(arc)]) {
+      ++arc;
+    }
+
+    if (arc == adjacency.lastArc(vertex)) {
+      // Every edge of `vertex` is used: it is the next vertex of the circuit
+      // when read backwards.
+      circuit.push_back(vertex);
+      stack.pop_back();
+    }
+    else {
+      isUsed[adjacency.edgeId(arc)] = true;
+      stack.push_back(adjacency.target(arc));
+      ++arc;
+    }
+  }
 
-  const VertexIdentifier firstVertexOfSubCircuit{subCircuit.front()};
-  const std::vector<VertexIdentifier>::const_iterator position{std::find(
-    eulerCircuit.begin(), eulerCircuit.end(), firstVertexOfSubCircuit)};
   G_ASSERT(
-    position != eulerCircuit.end(),
-    "Could not find %zu in the euler circuit!",
-    firstVertexOfSubCircuit);
-
-  eulerCircuit.insert(
-    /* insert after position */ position + 1,
-    /* don't place the start vertex of the circuit in there a second time */
-    subCircuit.begin() + 1,
-    subCircuit.end());
+    circuit.size() == adjacency.edgeCount() + 1,
+    "The graph has no Euler circuit: only %zu of %zu edges were used!",
+    circuit.size() - 1,
+    adjacency.edgeCount());
+  std::reverse(circuit.begin(), circuit.end());
+  return circuit;
 }
 } // namespace g::algo::detail
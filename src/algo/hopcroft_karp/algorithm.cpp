@@ -0,0 +1,426 @@
+#include <cstdint>
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+#include "algo/hopcroft_karp/algorithm.hpp"
+#include "graph_exception.hpp"
+#include "throw.hpp"
+
+namespace g::algo::hopcroft_karp {
+namespace {
+constexpr std::size_t none{SIZE_MAX};
+
+/*!
+ * \brief Builds compressed sparse rows from (row, column) pairs.
+ * \param rowCount The count of rows.
+ * \param pairs The pairs, sorted.
+ * \param first Receives the offset of every row, rowCount + 1 entries.
+ * \param columns Receives the columns of all rows.
+ **/
+void buildRows(
+  std::size_t                                            rowCount,
+  const std::vector<std::pair<std::size_t, std::size_t>>& pairs,
+  std::vector<std::size_t>&                              first,
+  std::vector<std::size_t>&                              columns)
+{
+  first.assign(rowCount + 1, 0);
+  columns.clear();
+  columns.reserve(pairs.size());
+
+  for (const auto& [row, column] : pairs) {
+    ++first[row + 1];
+    columns.push_back(column);
+  }
+
+  std::partial_sum(first.begin(), first.end(), first.begin());
+}
+
+/*!
+ * \brief Hopcroft-Karp on dense left and right indices.
+ **/
+class HopcroftKarp {
+public:
+  HopcroftKarp(
+    std::size_t                                       leftCount,
+    std::size_t                                       rightCount,
+    std::vector<std::pair<std::size_t, std::size_t>>& pairs)
+    : m_leftCount{leftCount}
+    , m_rightCount{rightCount}
+    , m_leftFirst{}
+    , m_leftAdjacent{}
+    , m_rightFirst{}
+    , m_rightAdjacent{}
+    , m_leftMate(leftCount, none)
+    , m_rightMate(rightCount, none)
+    , m_distance(leftCount, none)
+    , m_currentArc(leftCount, 0)
+    , m_freeDistance{none}
+    , m_queue{}
+    , m_stack{}
+  {
+    buildRows(leftCount, pairs, m_leftFirst, m_leftAdjacent);
+
+    for (auto& [left, right] : pairs) { std::swap(left, right); }
+
+    std::sort(pairs.begin(), pairs.end());
+    buildRows(rightCount, pairs, m_rightFirst, m_rightAdjacent);
+  }
+
+  /*!
+   * \brief Computes the maximum matching.
+   * \return The mate of every left vertex or `none`.
+   **/
+  const std::vector<std::size_t>& run()
+  {
+    karpSipser();
+
+    while (buildLayers()) {
+      for (std::size_t left{0}; left < m_leftCount; ++left) {
+        m_currentArc[left] = m_leftFirst[left];
+      }
+
+      for (std::size_t left{0}; left < m_leftCount; ++left) {
+        if (m_leftMate[left] == none) { augmentFrom(left); }
+      }
+    }
+
+    return m_leftMate;
+  }
+
+private:
+  /*!
+   * \brief Finds an initial matching.
+   *
+   * Vertices with a single unmatched neighbor are matched first, as some
+   * maximum matching contains that edge; otherwise an arbitrary edge is
+   * taken. Vertex indices below `leftCount` are left vertices, the others
+   * are right vertices.
+   **/
+  void karpSipser()
+  {
+    const std::size_t        vertexCount{m_leftCount + m_rightCount};
+    std::vector<std::size_t> degree(vertexCount, 0);
+    std::vector<std::size_t> degreeOne{};
+
+    for (std::size_t vertex{0}; vertex < vertexCount; ++vertex) {
+      degree[vertex] = lastArc(vertex) - firstArc(vertex);
+
+      if (degree[vertex] == 1) { degreeOne.push_back(vertex); }
+    }
+
+    std::size_t nextLeft{0};
+
+    for (;;) {
+      std::size_t vertex{none};
+
+      while (!degreeOne.empty() && vertex == none) {
+        const std::size_t candidate{degreeOne.back()};
+        degreeOne.pop_back();
+
+        if (!isMatched(candidate) && degree[candidate] > 0) {
+          vertex = candidate;
+        }
+      }
+
+      while (vertex == none && nextLeft < m_leftCount) {
+        if (!isMatched(nextLeft) && degree[nextLeft] > 0) {
+          vertex = nextLeft;
+        }
+        else {
+          ++nextLeft;
+        }
+      }
+
+      if (vertex == none) { break; }
+
+      std::size_t mate{none};
+
+      for (std::size_t arc{firstArc(vertex)}; mate == none; ++arc) {
+        if (!isMatched(neighbor(vertex, arc))) { mate = neighbor(vertex, arc); }
+      }
+
+      match(vertex, mate);
+
+      for (const std::size_t matched : {vertex, mate}) {
+        for (std::size_t arc{firstArc(matched)}; arc < lastArc(matched);
+             ++arc) {
+          const std::size_t other{neighbor(matched, arc)};
+
+          if (!isMatched(other) && --degree[other] == 1) {
+            degreeOne.push_back(other);
+          }
+        }
+      }
+    }
+  }
+
+  std::size_t firstArc(std::size_t vertex) const
+  {
+    return vertex < m_leftCount ? m_leftFirst[vertex]
+                                : m_rightFirst[vertex - m_leftCount];
+  }
+
+  std::size_t lastArc(std::size_t vertex) const
+  {
+    return vertex < m_leftCount ? m_leftFirst[vertex + 1]
+                                : m_rightFirst[vertex - m_leftCount + 1];
+  }
+
+  std::size_t neighbor(std::size_t vertex, std::size_t arc) const
+  {
+    return vertex < m_leftCount ? m_leftAdjacent[arc] + m_leftCount
+                                : m_rightAdjacent[arc];
+  }
+
+  bool isMatched(std::size_t vertex) const
+  {
+    return vertex < m_leftCount ? m_leftMate[vertex] != none
+                                : m_rightMate[vertex - m_leftCount] != none;
+  }
+
+  void match(std::size_t vertex, std::size_t mate)
+  {
+    const std::size_t left{std::min(vertex, mate)};
+    const std::size_t right{std::max(vertex, mate) - m_leftCount};
+    m_leftMate[left]   = right;
+    m_rightMate[right] = left;
+  }
+
+  /*!
+   * \brief Layers the left vertices by their distance from the unmatched
+   *        left vertices along alternating paths.
+   * \return true if there is an augmenting path.
+   **/
+  bool buildLayers()
+  {
+    m_queue.clear();
+    m_freeDistance = none;
+
+    for (std::size_t left{0}; left < m_leftCount; ++left) {
+      if (m_leftMate[left] == none) {
+        m_distance[left] = 0;
+        m_queue.push_back(left);
+      }
+      else {
+        m_distance[left] = none;
+      }
+    }
+
+    for (std::size_t i{0}; i < m_queue.size(); ++i) {
+      const std::size_t left{m_queue[i]};
+
+      if (m_distance[left] >= m_freeDistance) { break; }
+
+      for (std::size_t arc{m_leftFirst[left]}; arc < m_leftFirst[left + 1];
+           ++arc) {
+        const std::size_t mate{m_rightMate[m_leftAdjacent[arc]]};
+
+        if (mate == none) { m_freeDistance = m_distance[left]; }
+        else if (m_distance[mate] == none) {
+          m_distance[mate] = m_distance[left] + 1;
+          m_queue.push_back(mate);
+        }
+      }
+    }
+
+    return m_freeDistance != none;
+  }
+
+  /*!
+   * \brief Searches a shortest augmenting path from the unmatched left
+   *        vertex `root` along the layers and augments along it.
+   **/
+  void augmentFrom(std::size_t root)
+  {
+    m_stack.clear();
+    m_stack.push_back(root);
+
+    while (!m_stack.empty()) {
+      const std::size_t left{m_stack.back()};
+      std::size_t&      arc{m_currentArc[left]};
+
+      if (arc == m_leftFirst[left + 1]) {
+        m_distance[left] = none;
+        m_stack.pop_back();
+        continue;
+      }
+
+      const std::size_t mate{m_rightMate[m_leftAdjacent[arc]]};
+
+      if (mate == none) {
+        if (m_distance[left] == m_freeDistance) {
+          for (const std::size_t vertex : m_stack) {
+            m_leftMate[vertex] = m_leftAdjacent[m_currentArc[vertex]];
+            m_rightMate[m_leftMate[vertex]] = vertex;
+            m_distance[vertex]              = none;
+          }
+
+          return;
+        }
+
+        ++arc;
+      }
+      else if (m_distance[mate] == m_distance[left] + 1) {
+        m_stack.push_back(mate);
+      }
+      else {
+        ++arc;
+      }
+    }
+  }
+
+  std::size_t              m_leftCount;
+  std::size_t              m_rightCount;
+  std::vector<std::size_t> m_leftFirst;
+  std::vector<std::size_t> m_leftAdjacent;
+  std::vector<std::size_t> m_rightFirst;
+  std::vector<std::size_t> m_rightAdjacent;
+  std::vector<std::size_t> m_leftMate;
+  std::vector<std::size_t> m_rightMate;
+  std::vector<std::size_t> m_distance;
+  std::vector<std::size_t> m_currentArc;
+  std::size_t              m_freeDistance;
+  std::vector<std::size_t> m_queue;
+  std::vector<std::size_t> m_stack;
+};
+} // namespace
+
+namespace detail {
+std::vector<VertexIdentifier> colourBipartite(
+  const VertexIndex&       vertexIndex,
+  const std::vector<Edge>& edges)
+{
+  const std::size_t                                n{vertexIndex.size()};
+  std::vector<std::pair<std::size_t, std::size_t>> pairs{};
+  pairs.reserve(2 * edges.size());
+
+  for (const Edge& edge : edges) {
+    const std::size_t source{vertexIndex.indexOf(edge.source())};
+    const std::size_t target{vertexIndex.indexOf(edge.target())};
+
+    if (source == target) {
+      G_THROW(
+        GraphException,
+        "The graph has a loop at %zu and is not bipartite!",
+        edge.source());
+    }
+
+    pairs.emplace_back(source, target);
+    pairs.emplace_back(target, source);
+  }
+
+  std::sort(pairs.begin(), pairs.end());
+  std::vector<std::size_t> first{};
+  std::vector<std::size_t> adjacent{};
+  buildRows(n, pairs, first, adjacent);
+
+  constexpr std::uint8_t        uncoloured{2};
+  std::vector<std::uint8_t>     colour(n, uncoloured);
+  std::vector<std::size_t>      stack{};
+  std::vector<VertexIdentifier> result{};
+  stack.reserve(n);
+
+  for (std::size_t root{0}; root < n; ++root) {
+    if (colour[root] != uncoloured) { continue; }
+
+    colour[root] = 0;
+    stack.push_back(root);
+
+    while (!stack.empty()) {
+      const std::size_t vertex{stack.back()};
+      stack.pop_back();
+
+      if (colour[vertex] == 0) {
+        result.push_back(vertexIndex.vertexAt(vertex));
+      }
+
+      for (std::size_t arc{first[vertex]}; arc < first[vertex + 1]; ++arc) {
+        const std::size_t other{adjacent[arc]};
+
+        if (colour[other] == uncoloured) {
+          colour[other] = static_cast<std::uint8_t>(1 - colour[vertex]);
+          stack.push_back(other);
+        }
+        else if (colour[other] == colour[vertex]) {
+          G_THROW(
+            GraphException,
+            "The graph is not bipartite: %zu and %zu are adjacent but need "
+            "the same colour!",
+            vertexIndex.vertexAt(vertex),
+            vertexIndex.vertexAt(other));
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+Matching maximumMatching(
+  const VertexIndex&                   vertexIndex,
+  const std::vector<VertexIdentifier>& leftVertices,
+  const std::vector<Edge>&             edges)
+{
+  const std::size_t n{vertexIndex.size()};
+  std::vector<bool> isLeft(n, false);
+
+  for (VertexIdentifier vertex : leftVertices) {
+    isLeft[vertexIndex.indexOf(vertex)] = true;
+  }
+
+  // Number the vertices of each side densely, in ascending order.
+  std::vector<std::size_t>      sideIndex(n, 0);
+  std::vector<VertexIdentifier> leftIdentifiers{};
+  std::vector<VertexIdentifier> rightIdentifiers{};
+
+  for (std::size_t vertex{0}; vertex < n; ++vertex) {
+    std::vector<VertexIdentifier>& side{
+      isLeft[vertex] ? leftIdentifiers : rightIdentifiers};
+    sideIndex[vertex] = side.size();
+    side.push_back(vertexIndex.vertexAt(vertex));
+  }
+
+  std::vector<std::pair<std::size_t, std::size_t>> pairs{};
+  pairs.reserve(edges.size());
+
+  for (const Edge& edge : edges) {
+    const std::size_t source{vertexIndex.indexOf(edge.source())};
+    const std::size_t target{vertexIndex.indexOf(edge.target())};
+
+    if (isLeft[source] == isLeft[target]) {
+      G_THROW(
+        GraphException,
+        "The edge from %zu to %zu connects two vertices on the same side!",
+        edge.source(),
+        edge.target());
+    }
+
+    if (isLeft[source]) {
+      pairs.emplace_back(sideIndex[source], sideIndex[target]);
+    }
+    else {
+      pairs.emplace_back(sideIndex[target], sideIndex[source]);
+    }
+  }
+
+  std::sort(pairs.begin(), pairs.end());
+  pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+  HopcroftKarp                    hopcroftKarp{
+    leftIdentifiers.size(), rightIdentifiers.size(), pairs};
+  const std::vector<std::size_t>& leftMate{hopcroftKarp.run()};
+  std::vector<Edge>               matched{};
+
+  for (std::size_t left{0}; left < leftMate.size(); ++left) {
+    if (leftMate[left] != none) {
+      matched.emplace_back(
+        leftIdentifiers[left], rightIdentifiers[leftMate[left]]);
+    }
+  }
+
+  return Matching{std::move(matched)};
+}
+} // namespace detail
+} // namespace g::algo::hopcroft_karp
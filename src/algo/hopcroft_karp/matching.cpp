@@ -0,0 +1,36 @@
+#include <algorithm>
+#include <utility>
+
+#include "algo/hopcroft_karp/matching.hpp"
+#include "assert.hpp"
+
+namespace g::algo::hopcroft_karp {
+Matching::Matching(std::vector<Edge> edges) : m_edges{std::move(edges)}, m_mate{}
+{
+  std::sort(m_edges.begin(), m_edges.end());
+  m_mate.reserve(2 * m_edges.size());
+
+  for (const Edge& edge : m_edges) {
+    const bool isNewSource{m_mate.emplace(edge.source(), edge.target()).second};
+    const bool isNewTarget{m_mate.emplace(edge.target(), edge.source()).second};
+    G_ASSERT(
+      isNewSource && isNewTarget,
+      "Edge from %zu to %zu shares a vertex with another matched edge!",
+      edge.source(),
+      edge.target());
+  }
+}
+
+std::size_t Matching::size() const { return m_edges.size(); }
+
+const std::vector<Edge>& Matching::edges() const { return m_edges; }
+
+std::optional<VertexIdentifier> Matching::mateOf(VertexIdentifier vertex) const
+{
+  if (const auto it{m_mate.find(vertex)}; it != m_mate.end()) {
+    return it->second;
+  }
+
+  return std::nullopt;
+}
+} // namespace g::algo::hopcroft_karp
@@ -0,0 +1,245 @@
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "algo/incremental_max_flow.hpp"
+#include "algo/push_relabel/algorithm.hpp"
+#include "graph_exception.hpp"
+#include "throw.hpp"
+
+namespace g::algo {
+IncrementalMaxFlow::IncrementalMaxFlow(
+  ResidualNetwork  network,
+  VertexIdentifier source,
+  VertexIdentifier sink,
+  Directionality   directionality)
+  : m_network{std::move(network)}
+  , m_source{m_network.vertexIndex().indexOf(source)}
+  , m_sink{m_network.vertexIndex().indexOf(sink)}
+  , m_directionality{directionality}
+  , m_visited(m_network.vertexCount(), 0)
+  , m_stamp{0}
+  , m_parentArc(m_network.vertexCount(), 0)
+  , m_queue{}
+  , m_path{}
+  , m_otherPath{}
+{
+  static_cast<void>(push_relabel::detail::maximumPreflow(
+    m_network, m_source, m_sink, push_relabel::SelectionRule::HighestLabel));
+  push_relabel::detail::convertPreflowToFlow(m_network, m_source, m_sink);
+}
+
+const ResidualNetwork& IncrementalMaxFlow::network() const
+{
+  return m_network;
+}
+
+std::int64_t IncrementalMaxFlow::maxFlow() const
+{
+  std::int64_t result{0};
+
+  for (std::size_t arc{m_network.firstArc(m_source)};
+       arc < m_network.lastArc(m_source);
+       ++arc) {
+    result += m_network.flow(arc);
+  }
+
+  return result;
+}
+
+ford_fulkerson::Result IncrementalMaxFlow::result() const
+{
+  return ford_fulkerson::Result{
+    static_cast<std::int32_t>(maxFlow()), m_network.flowMap()};
+}
+
+void IncrementalMaxFlow::setCapacity(
+  VertexIdentifier source,
+  VertexIdentifier target,
+  std::int64_t     capacity)
+{
+  if (capacity < 0) {
+    G_THROW(
+      GraphException,
+      "Capacity %lld of edge from %zu to %zu is negative!",
+      static_cast<long long>(capacity),
+      source,
+      target);
+  }
+
+  const VertexIndex&               vertexIndex{m_network.vertexIndex()};
+  const std::size_t                tail{vertexIndex.indexOf(source)};
+  const std::size_t                head{vertexIndex.indexOf(target)};
+  const std::optional<std::size_t> arc{m_network.findArc(tail, head)};
+
+  if (!arc.has_value()) {
+    G_THROW(
+      GraphException,
+      "There is no edge from %zu to %zu!",
+      source,
+      target);
+  }
+
+  changeCapacity(*arc, capacity);
+
+  if (m_directionality == Directionality::Undirected) {
+    const std::optional<std::size_t> reverseArc{
+      m_network.findArc(head, tail)};
+    G_ASSERT(
+      reverseArc.has_value(),
+      "Undirected edge from %zu to %zu has no reverse edge!",
+      source,
+      target);
+    changeCapacity(*reverseArc, capacity);
+  }
+}
+
+void IncrementalMaxFlow::changeCapacity(std::size_t arc, std::int64_t capacity)
+{
+  const std::int64_t oldCapacity{m_network.capacity(arc)};
+  m_network.setCapacity(arc, capacity);
+
+  if (capacity > oldCapacity) { increaseCapacity(arc); }
+  else if (capacity < oldCapacity) {
+    decreaseCapacity(arc);
+  }
+}
+
+void IncrementalMaxFlow::increaseCapacity(std::size_t arc)
+{
+  const std::size_t tail{m_network.head(m_network.reverse(arc))};
+  const std::size_t head{m_network.head(arc)};
+
+  // The flow was maximal before, so every augmenting path has to use `arc`.
+  while (m_network.residual(arc) > 0) {
+    if (!findPath(m_source, tail, Search::FromGoal, m_path)) { break; }
+
+    if (!findPath(head, m_sink, Search::FromStart, m_otherPath)) { break; }
+
+    m_path.push_back(arc);
+    m_path.insert(m_path.end(), m_otherPath.begin(), m_otherPath.end());
+    push(m_path, bottleneck(m_path));
+  }
+}
+
+void IncrementalMaxFlow::decreaseCapacity(std::size_t arc)
+{
+  std::int64_t excess{-m_network.residual(arc)};
+
+  if (excess <= 0) { return; }
+
+  const std::size_t tail{m_network.head(m_network.reverse(arc))};
+  const std::size_t head{m_network.head(arc)};
+
+  // Removing the flow that no longer fits leaves an excess at the tail and
+  // a deficit at the head; try to send it around the edge first.
+  m_network.push(arc, -excess);
+  excess -= route(tail, head, excess, Search::FromStart);
+
+  if (excess == 0) { return; }
+
+  std::int64_t tailExcess{excess};
+  tailExcess -= route(tail, m_source, tailExcess, Search::FromStart);
+  tailExcess -= route(tail, m_sink, tailExcess, Search::FromStart);
+  std::int64_t headDeficit{excess};
+  headDeficit -= route(m_sink, head, headDeficit, Search::FromGoal);
+  headDeficit -= route(m_source, head, headDeficit, Search::FromGoal);
+  G_ASSERT(
+    tailExcess == 0 && headDeficit == 0,
+    "Couldn't cancel the flow on the edge from %zu to %zu!",
+    m_network.vertexIndex().vertexAt(tail),
+    m_network.vertexIndex().vertexAt(head));
+}
+
+std::int64_t IncrementalMaxFlow::route(
+  std::size_t  start,
+  std::size_t  goal,
+  std::int64_t limit,
+  Search       search)
+{
+  std::int64_t routed{0};
+
+  while (routed < limit && findPath(start, goal, search, m_path)) {
+    const std::int64_t amount{std::min(limit - routed, bottleneck(m_path))};
+    push(m_path, amount);
+    routed += amount;
+  }
+
+  return routed;
+}
+
+bool IncrementalMaxFlow::findPath(
+  std::size_t               start,
+  std::size_t               goal,
+  Search                    search,
+  std::vector<std::size_t>& path)
+{
+  path.clear();
+  ++m_stamp;
+  m_queue.clear();
+
+  // Searching from the goal walks the arcs backwards and records for every
+  // vertex the arc leading towards the goal.
+  const std::size_t origin{search == Search::FromStart ? start : goal};
+  const std::size_t target{search == Search::FromStart ? goal : start};
+  m_visited[origin] = m_stamp;
+  m_queue.push_back(origin);
+
+  for (std::size_t i{0}; i < m_queue.size() && m_visited[target] != m_stamp;
+       ++i) {
+    const std::size_t vertex{m_queue[i]};
+
+    for (std::size_t arc{m_network.firstArc(vertex)};
+         arc < m_network.lastArc(vertex);
+         ++arc) {
+      const std::size_t neighbor{m_network.head(arc)};
+      const std::size_t pathArc{
+        search == Search::FromStart ? arc : m_network.reverse(arc)};
+
+      if (m_visited[neighbor] != m_stamp && m_network.residual(pathArc) > 0) {
+        m_visited[neighbor]   = m_stamp;
+        m_parentArc[neighbor] = pathArc;
+        m_queue.push_back(neighbor);
+      }
+    }
+  }
+
+  if (m_visited[target] != m_stamp) { return false; }
+
+  if (search == Search::FromStart) {
+    for (std::size_t vertex{goal}; vertex != start;
+         vertex = m_network.head(m_network.reverse(m_parentArc[vertex]))) {
+      path.push_back(m_parentArc[vertex]);
+    }
+
+    std::reverse(path.begin(), path.end());
+  }
+  else {
+    for (std::size_t vertex{start}; vertex != goal;
+         vertex = m_network.head(m_parentArc[vertex])) {
+      path.push_back(m_parentArc[vertex]);
+    }
+  }
+
+  return true;
+}
+
+std::int64_t IncrementalMaxFlow::bottleneck(
+  const std::vector<std::size_t>& path) const
+{
+  std::int64_t result{std::numeric_limits<std::int64_t>::max()};
+
+  for (std::size_t arc : path) {
+    result = std::min(result, m_network.residual(arc));
+  }
+
+  return result;
+}
+
+void IncrementalMaxFlow::push(
+  const std::vector<std::size_t>& path,
+  std::int64_t                    amount)
+{
+  for (std::size_t arc : path) { m_network.push(arc, amount); }
+}
+} // namespace g::algo
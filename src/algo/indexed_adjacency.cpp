@@ -0,0 +1,104 @@
+#include <utility>
+
+#include "algo/indexed_adjacency.hpp"
+
+namespace g::algo {
+IndexedAdjacency::IndexedAdjacency(
+  VertexIndex              vertexIndex,
+  const std::vector<Edge>& edges,
+  Directionality           directionality)
+  : m_vertexIndex{std::move(vertexIndex)}
+  , m_edgeCount{edges.size()}
+  , m_firstArc(m_vertexIndex.size() + 1, 0)
+  , m_target{}
+  , m_edgeId{}
+{
+  const bool               isUndirected{directionality
+                              == Directionality::Undirected};
+  std::vector<std::size_t> sources(edges.size());
+  std::vector<std::size_t> targets(edges.size());
+
+  for (std::size_t i{0}; i < edges.size(); ++i) {
+    sources[i] = m_vertexIndex.indexOf(edges[i].source());
+    targets[i] = m_vertexIndex.indexOf(edges[i].target());
+    ++m_firstArc[sources[i] + 1];
+
+    if (isUndirected && sources[i] != targets[i]) {
+      ++m_firstArc[targets[i] + 1];
+    }
+  }
+
+  for (std::size_t vertex{0}; vertex < m_vertexIndex.size(); ++vertex) {
+    m_firstArc[vertex + 1] += m_firstArc[vertex];
+  }
+
+  m_target.resize(m_firstArc.back());
+  m_edgeId.resize(m_firstArc.back());
+  std::vector<std::size_t> next(m_firstArc.begin(), m_firstArc.end() - 1);
+
+  for (std::size_t i{0}; i < edges.size(); ++i) {
+    std::size_t arc{next[sources[i]]++};
+    m_target[arc] = targets[i];
+    m_edgeId[arc] = i;
+
+    if (isUndirected && sources[i] != targets[i]) {
+      arc           = next[targets[i]]++;
+      m_target[arc] = sources[i];
+      m_edgeId[arc] = i;
+    }
+  }
+}
+
+IndexedAdjacency::IndexedAdjacency(
+  VertexIndex vertexIndex,
+  std::size_t edgeCount)
+  : m_vertexIndex{std::move(vertexIndex)}
+  , m_edgeCount{edgeCount}
+  , m_firstArc(m_vertexIndex.size() + 1, 0)
+  , m_target{}
+  , m_edgeId{}
+{
+}
+
+const VertexIndex& IndexedAdjacency::vertexIndex() const
+{
+  return m_vertexIndex;
+}
+
+std::size_t IndexedAdjacency::vertexCount() const
+{
+  return m_vertexIndex.size();
+}
+
+std::size_t IndexedAdjacency::edgeCount() const { return m_edgeCount; }
+
+std::size_t IndexedAdjacency::arcCount() const { return m_target.size(); }
+
+IndexedAdjacency IndexedAdjacency::transposed() const
+{
+  IndexedAdjacency result{m_vertexIndex, m_edgeCount};
+
+  for (std::size_t arc{0}; arc < arcCount(); ++arc) {
+    ++result.m_firstArc[m_target[arc] + 1];
+  }
+
+  for (std::size_t vertex{0}; vertex < vertexCount(); ++vertex) {
+    result.m_firstArc[vertex + 1] += result.m_firstArc[vertex];
+  }
+
+  result.m_target.resize(arcCount());
+  result.m_edgeId.resize(arcCount());
+  std::vector<std::size_t> next(
+    result.m_firstArc.begin(), result.m_firstArc.end() - 1);
+
+  for (std::size_t vertex{0}; vertex < vertexCount(); ++vertex) {
+    for (std::size_t arc{firstArc(vertex)}; arc < lastArc(vertex); ++arc) {
+      const std::size_t reversed{next[m_target[arc]]++};
+      result.m_target[reversed] = vertex;
+      result.m_edgeId[reversed] = m_edgeId[arc];
+    }
+  }
+
+  return result;
+}
+} // namespace g::algo
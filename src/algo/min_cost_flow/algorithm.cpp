@@ -0,0 +1,60 @@
+#include <ostream>
+
+#include "algo/min_cost_flow/algorithm.hpp"
+
+namespace g::algo::min_cost_flow {
+std::ostream& operator<<(std::ostream& os, Engine engine)
+{
+  switch (engine) {
+  case Engine::SuccessiveShortestPaths: os << "SuccessiveShortestPaths"; break;
+  case Engine::CostScaling: os << "CostScaling"; break;
+  }
+
+  return os;
+}
+
+Result::Result(
+  std::int64_t                                  maxFlow,
+  std::int64_t                                  totalCost,
+  const std::unordered_map<Edge, std::int32_t>& flow)
+  : m_maxFlow{maxFlow}, m_totalCost{totalCost}, m_flow{flow}
+{
+}
+
+std::int64_t Result::maxFlow() const { return m_maxFlow; }
+
+std::int64_t Result::totalCost() const { return m_totalCost; }
+
+const std::unordered_map<Edge, std::int32_t>& Result::flow() const
+{
+  return m_flow;
+}
+
+namespace detail {
+Result makeResult(
+  const ResidualNetwork&           network,
+  const std::vector<std::int64_t>& cost,
+  std::size_t                      source)
+{
+  std::int64_t                           maxFlow{0};
+  std::int64_t                           totalCost{0};
+  std::unordered_map<Edge, std::int32_t> flow{};
+  flow.reserve(network.edgeCount());
+
+  for (std::size_t arc{network.firstArc(source)};
+       arc < network.lastArc(source);
+       ++arc) {
+    maxFlow += network.flow(arc);
+  }
+
+  for (std::size_t i{0}; i < network.edgeCount(); ++i) {
+    const std::size_t  arc{network.arcOfEdge(i)};
+    const std::int64_t amount{network.flow(arc)};
+    totalCost += amount * cost[arc];
+    flow[network.edgeAt(i)] += static_cast<std::int32_t>(amount);
+  }
+
+  return Result{maxFlow, totalCost, flow};
+}
+} // namespace detail
+} // namespace g::algo::min_cost_flow
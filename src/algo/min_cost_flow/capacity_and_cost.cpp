@@ -0,0 +1,27 @@
+#include <ostream>
+
+#include "algo/min_cost_flow/capacity_and_cost.hpp"
+
+namespace g::algo::min_cost_flow {
+std::ostream& operator<<(
+  std::ostream&          os,
+  const CapacityAndCost& capacityAndCost)
+{
+  return os << "CapacityAndCost{capacity: " << capacityAndCost.m_capacity
+            << ", cost: " << capacityAndCost.m_cost << '}';
+}
+
+bool operator==(const CapacityAndCost& lhs, const CapacityAndCost& rhs)
+{
+  return lhs.m_capacity == rhs.m_capacity && lhs.m_cost == rhs.m_cost;
+}
+
+CapacityAndCost::CapacityAndCost(std::int32_t capacity, std::int64_t cost)
+  : m_capacity{capacity}, m_cost{cost}
+{
+}
+
+std::int32_t CapacityAndCost::capacity() const { return m_capacity; }
+
+std::int64_t CapacityAndCost::cost() const { return m_cost; }
+} // namespace g::algo::min_cost_flow
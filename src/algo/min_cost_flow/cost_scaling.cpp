@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <queue>
+
+#include "algo/min_cost_flow/algorithm.hpp"
+#include "algo/push_relabel/algorithm.hpp"
+
+namespace g::algo::min_cost_flow::detail {
+namespace {
+/*!
+ * \brief The factor by which epsilon shrinks between two refinements.
+ **/
+constexpr std::int64_t alpha{8};
+
+/*!
+ * \brief Turns an epsilon-optimal circulation into an (epsilon / alpha)
+ *        optimal one.
+ *
+ * The costs are multiplied by the vertex count, so that a 1-optimal
+ * circulation is optimal for the original costs. Every vertex, the source
+ * and the sink included, has to end up with the balance it started with.
+ **/
+class Refiner {
+public:
+  Refiner(ResidualNetwork& network, const std::vector<std::int64_t>& cost)
+    : m_network{network}
+    , m_cost(cost.size())
+    , m_price(network.vertexCount(), 0)
+    , m_excess(network.vertexCount(), 0)
+    , m_currentArc(network.vertexCount(), 0)
+    , m_queue{}
+  {
+    const std::int64_t n{static_cast<std::int64_t>(network.vertexCount())};
+    std::transform(
+      cost.begin(), cost.end(), m_cost.begin(), [n](std::int64_t c) {
+        return c * n;
+      });
+  }
+
+  void run()
+  {
+    std::int64_t epsilon{0};
+
+    for (std::int64_t c : m_cost) { epsilon = std::max(epsilon, std::abs(c)); }
+
+    while (epsilon > 1) {
+      epsilon = std::max(std::int64_t{1}, epsilon / alpha);
+      refine(epsilon);
+    }
+  }
+
+private:
+  [[nodiscard]] std::int64_t reducedCost(std::size_t vertex, std::size_t arc)
+    const
+  {
+    return m_cost[arc] + m_price[vertex] - m_price[m_network.head(arc)];
+  }
+
+  void push(std::size_t vertex, std::size_t arc, std::int64_t amount)
+  {
+    const std::size_t head{m_network.head(arc)};
+    m_network.push(arc, amount);
+    m_excess[vertex] -= amount;
+    const bool becomesActive{m_excess[head] <= 0};
+    m_excess[head] += amount;
+
+    if (becomesActive && m_excess[head] > 0) { m_queue.push(head); }
+  }
+
+  void refine(std::int64_t epsilon)
+  {
+    const std::size_t n{m_network.vertexCount()};
+
+    for (std::size_t vertex{0}; vertex < n; ++vertex) {
+      m_currentArc[vertex] = m_network.firstArc(vertex);
+
+      for (std::size_t arc{m_network.firstArc(vertex)};
+           arc < m_network.lastArc(vertex);
+           ++arc) {
+        const std::int64_t residual{m_network.residual(arc)};
+
+        if (residual > 0 && reducedCost(vertex, arc) < 0) {
+          m_network.push(arc, residual);
+          m_excess[vertex] -= residual;
+          m_excess[m_network.head(arc)] += residual;
+        }
+      }
+    }
+
+    for (std::size_t vertex{0}; vertex < n; ++vertex) {
+      if (m_excess[vertex] > 0) { m_queue.push(vertex); }
+    }
+
+    while (!m_queue.empty()) {
+      const std::size_t vertex{m_queue.front()};
+      m_queue.pop();
+      discharge(vertex, epsilon);
+    }
+  }
+
+  void discharge(std::size_t vertex, std::int64_t epsilon)
+  {
+    while (m_excess[vertex] > 0) {
+      std::size_t& arc{m_currentArc[vertex]};
+
+      if (arc == m_network.lastArc(vertex)) {
+        relabel(vertex, epsilon);
+        arc = m_network.firstArc(vertex);
+        continue;
+      }
+
+      const std::int64_t residual{m_network.residual(arc)};
+
+      if (residual > 0 && reducedCost(vertex, arc) < 0) {
+        push(vertex, arc, std::min(m_excess[vertex], residual));
+      }
+      else {
+        ++arc;
+      }
+    }
+  }
+
+  void relabel(std::size_t vertex, std::int64_t epsilon)
+  {
+    std::int64_t highest{std::numeric_limits<std::int64_t>::min()};
+
+    for (std::size_t arc{m_network.firstArc(vertex)};
+         arc < m_network.lastArc(vertex);
+         ++arc) {
+      if (m_network.residual(arc) > 0) {
+        highest
+          = std::max(highest, m_price[m_network.head(arc)] - m_cost[arc]);
+      }
+    }
+
+    G_ASSERT(
+      highest != std::numeric_limits<std::int64_t>::min(),
+      "Vertex %zu has excess but no residual arc!",
+      m_network.vertexIndex().vertexAt(vertex));
+    m_price[vertex] = highest - epsilon;
+  }
+
+  ResidualNetwork&          m_network;
+  std::vector<std::int64_t> m_cost;
+  std::vector<std::int64_t> m_price;
+  std::vector<std::int64_t> m_excess;
+  std::vector<std::size_t>  m_currentArc;
+  std::queue<std::size_t>   m_queue;
+};
+} // namespace
+
+void costScaling(
+  ResidualNetwork&                 network,
+  const std::vector<std::int64_t>& cost,
+  std::size_t                      source,
+  std::size_t                      sink)
+{
+  static_cast<void>(push_relabel::detail::maximumPreflow(
+    network, source, sink, push_relabel::SelectionRule::HighestLabel));
+  push_relabel::detail::convertPreflowToFlow(network, source, sink);
+  Refiner refiner{network, cost};
+  refiner.run();
+}
+} // namespace g::algo::min_cost_flow::detail
@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#include "algo/min_cost_flow/algorithm.hpp"
+#include "graph_exception.hpp"
+#include "throw.hpp"
+
+namespace g::algo::min_cost_flow::detail {
+namespace {
+constexpr std::int64_t infinity{std::numeric_limits<std::int64_t>::max()};
+constexpr std::size_t  none{SIZE_MAX};
+
+/*!
+ * \brief Computes shortest path distances from `source` with a queue based
+ *        Bellman-Ford algorithm.
+ * \param network The network.
+ * \param cost The cost of every arc.
+ * \param source The dense index of the source.
+ * \return The distances; vertices unreachable from `source` get 0.
+ * \throws GraphException if a negative cost cycle is reachable from `source`.
+ **/
+std::vector<std::int64_t> bellmanFord(
+  const ResidualNetwork&           network,
+  const std::vector<std::int64_t>& cost,
+  std::size_t                      source)
+{
+  const std::size_t         n{network.vertexCount()};
+  std::vector<std::int64_t> distance(n, infinity);
+  std::vector<std::size_t>  relaxations(n, 0);
+  std::vector<bool>         isQueued(n, false);
+  std::queue<std::size_t>   queue{};
+  distance[source] = 0;
+  queue.push(source);
+  isQueued[source] = true;
+
+  while (!queue.empty()) {
+    const std::size_t vertex{queue.front()};
+    queue.pop();
+    isQueued[vertex] = false;
+
+    for (std::size_t arc{network.firstArc(vertex)};
+         arc < network.lastArc(vertex);
+         ++arc) {
+      if (network.residual(arc) <= 0) { continue; }
+
+      const std::size_t  head{network.head(arc)};
+      const std::int64_t candidate{distance[vertex] + cost[arc]};
+
+      if (candidate < distance[head]) {
+        distance[head] = candidate;
+
+        if (!isQueued[head]) {
+          if (++relaxations[head] >= n) {
+            G_THROW(
+              GraphException,
+              "Negative cost cycle through vertex %zu detected!",
+              network.vertexIndex().vertexAt(head));
+          }
+
+          queue.push(head);
+          isQueued[head] = true;
+        }
+      }
+    }
+  }
+
+  std::replace(distance.begin(), distance.end(), infinity, std::int64_t{0});
+  return distance;
+}
+} // namespace
+
+void successiveShortestPaths(
+  ResidualNetwork&                 network,
+  const std::vector<std::int64_t>& cost,
+  std::size_t                      source,
+  std::size_t                      sink)
+{
+  if (source == sink) {
+    G_THROW(
+      GraphException,
+      "Source and sink are both %zu!",
+      network.vertexIndex().vertexAt(source));
+  }
+
+  const std::size_t n{network.vertexCount()};
+  bool              hasNegativeCost{false};
+
+  for (std::size_t arc{0}; arc < network.arcCount(); ++arc) {
+    hasNegativeCost
+      = hasNegativeCost || (network.residual(arc) > 0 && cost[arc] < 0);
+  }
+
+  std::vector<std::int64_t> potential{
+    hasNegativeCost ? bellmanFord(network, cost, source)
+                    : std::vector<std::int64_t>(n, 0)};
+  std::vector<std::int64_t> distance(n);
+  std::vector<std::size_t>  predecessorArc(n);
+  using entry_type = std::pair<std::int64_t, std::size_t>;
+  std::priority_queue<
+    entry_type,
+    std::vector<entry_type>,
+    std::greater<entry_type>>
+    heap{};
+
+  for (;;) {
+    std::fill(distance.begin(), distance.end(), infinity);
+    std::fill(predecessorArc.begin(), predecessorArc.end(), none);
+    distance[source] = 0;
+    heap.emplace(0, source);
+
+    while (!heap.empty()) {
+      const auto [vertexDistance, vertex] = heap.top();
+      heap.pop();
+
+      if (vertexDistance > distance[vertex]) { continue; }
+
+      for (std::size_t arc{network.firstArc(vertex)};
+           arc < network.lastArc(vertex);
+           ++arc) {
+        if (network.residual(arc) <= 0) { continue; }
+
+        const std::size_t  head{network.head(arc)};
+        const std::int64_t reducedCost{
+          cost[arc] + potential[vertex] - potential[head]};
+        const std::int64_t candidate{vertexDistance + reducedCost};
+
+        if (candidate < distance[head]) {
+          distance[head]       = candidate;
+          predecessorArc[head] = arc;
+          heap.emplace(candidate, head);
+        }
+      }
+    }
+
+    if (distance[sink] == infinity) { break; }
+
+    // Vertices that were not reached can never be reached again, as
+    // augmenting only adds arcs between reached vertices.
+    for (std::size_t vertex{0}; vertex < n; ++vertex) {
+      if (distance[vertex] != infinity) { potential[vertex] += distance[vertex]; }
+    }
+
+    std::int64_t amount{infinity};
+
+    for (std::size_t vertex{sink}; vertex != source;
+         vertex = network.head(network.reverse(predecessorArc[vertex]))) {
+      amount = std::min(amount, network.residual(predecessorArc[vertex]));
+    }
+
+    for (std::size_t vertex{sink}; vertex != source;
+         vertex = network.head(network.reverse(predecessorArc[vertex]))) {
+      network.push(predecessorArc[vertex], amount);
+    }
+  }
+}
+} // namespace g::algo::min_cost_flow::detail
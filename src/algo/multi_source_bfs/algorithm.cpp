@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+#include "algo/multi_source_bfs/algorithm.hpp"
+
+namespace g::algo::multi_source_bfs {
+namespace {
+constexpr std::size_t laneCount{64};
+} // anonymous namespace
+
+DistanceMatrix::DistanceMatrix(
+  VertexIndex                   vertexIndex,
+  std::vector<VertexIdentifier> sources,
+  std::vector<std::uint32_t>    distances)
+  : m_vertexIndex{std::move(vertexIndex)}
+  , m_sources{std::move(sources)}
+  , m_distances{std::move(distances)}
+{
+}
+
+const VertexIndex& DistanceMatrix::vertexIndex() const
+{
+  return m_vertexIndex;
+}
+
+const std::vector<VertexIdentifier>& DistanceMatrix::sources() const
+{
+  return m_sources;
+}
+
+std::span<const std::uint32_t> DistanceMatrix::row(std::size_t row) const
+{
+  return std::span<const std::uint32_t>{m_distances}.subspan(
+    row * m_vertexIndex.size(), m_vertexIndex.size());
+}
+
+std::optional<std::size_t> DistanceMatrix::distance(
+  std::size_t      row,
+  VertexIdentifier target) const
+{
+  const std::uint32_t distance{
+    this->row(row)[m_vertexIndex.indexOf(target)]};
+
+  if (distance == unreachable) { return std::nullopt; }
+
+  return distance;
+}
+
+namespace detail {
+std::vector<std::uint32_t> hopDistances(
+  const IndexedAdjacency&         adjacency,
+  const std::vector<std::size_t>& sources)
+{
+  const std::size_t          n{adjacency.vertexCount()};
+  std::vector<std::uint32_t> distances(
+    sources.size() * n, DistanceMatrix::unreachable);
+  std::vector<std::uint64_t> seen(n);
+  std::vector<std::uint64_t> visit(n);
+  std::vector<std::uint64_t> visitNext(n, 0);
+
+  for (std::size_t first{0}; first < sources.size(); first += laneCount) {
+    const std::size_t lanes{std::min(laneCount, sources.size() - first)};
+    std::fill(seen.begin(), seen.end(), 0);
+    std::fill(visit.begin(), visit.end(), 0);
+
+    for (std::size_t lane{0}; lane < lanes; ++lane) {
+      const std::size_t source{sources[first + lane]};
+      seen[source] |= std::uint64_t{1} << lane;
+      visit[source] |= std::uint64_t{1} << lane;
+      distances[(first + lane) * n + source] = 0;
+    }
+
+    bool isActive{true};
+
+    for (std::uint32_t level{1}; isActive; ++level) {
+      // Hand the frontier bits of every vertex on to its targets, once for
+      // all searches.
+      for (std::size_t vertex{0}; vertex < n; ++vertex) {
+        if (visit[vertex] == 0) { continue; }
+
+        for (std::size_t arc{adjacency.firstArc(vertex)};
+             arc < adjacency.lastArc(vertex);
+             ++arc) {
+          visitNext[adjacency.target(arc)] |= visit[vertex];
+        }
+      }
+
+      isActive = false;
+
+      for (std::size_t vertex{0}; vertex < n; ++vertex) {
+        const std::uint64_t discovered{visitNext[vertex] & ~seen[vertex]};
+        visitNext[vertex] = 0;
+        visit[vertex]     = discovered;
+
+        if (discovered == 0) { continue; }
+
+        isActive = true;
+        seen[vertex] |= discovered;
+
+        for (std::uint64_t bits{discovered}; bits != 0; bits &= bits - 1) {
+          const std::size_t lane{
+            static_cast<std::size_t>(std::countr_zero(bits))};
+          distances[(first + lane) * n + vertex] = level;
+        }
+      }
+    }
+  }
+
+  return distances;
+}
+} // namespace detail
+} // namespace g::algo::multi_source_bfs
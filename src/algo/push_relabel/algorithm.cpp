@@ -0,0 +1,349 @@
+#include <algorithm>
+#include <ostream>
+#include <queue>
+
+#include "algo/push_relabel/algorithm.hpp"
+#include "graph_exception.hpp"
+#include "throw.hpp"
+
+namespace g::algo::push_relabel {
+namespace {
+constexpr std::size_t none{SIZE_MAX};
+
+/*!
+ * \brief Discharges the active vertices of a `ResidualNetwork` towards a
+ *        root vertex.
+ *
+ * The labels are distances to the root in the residual network. A vertex
+ * whose label reaches the vertex count can no longer reach the root and is
+ * not discharged any further.
+ **/
+class Discharger {
+public:
+  Discharger(
+    ResidualNetwork& network,
+    std::size_t      root,
+    std::size_t      excluded,
+    SelectionRule    rule)
+    : m_network{network}
+    , m_root{root}
+    , m_excluded{excluded}
+    , m_rule{rule}
+    , m_n{network.vertexCount()}
+    , m_label(m_n, m_n)
+    , m_excess(m_n, 0)
+    , m_currentArc(m_n, 0)
+    , m_bucketFirst(m_n + 1, none)
+    , m_bucketNext(m_n, none)
+    , m_bucketPrev(m_n, none)
+    , m_activeFirst(m_n + 1, none)
+    , m_activeNext(m_n, none)
+    , m_fifo{}
+    , m_highestLabel{0}
+    , m_highestActive{0}
+    , m_work{0}
+    , m_globalRelabelThreshold{6 * m_n + network.arcCount()}
+  {
+  }
+
+  void saturateArcsOf(std::size_t vertex)
+  {
+    for (std::size_t arc{m_network.firstArc(vertex)};
+         arc < m_network.lastArc(vertex);
+         ++arc) {
+      if (const std::int64_t residual{m_network.residual(arc)}; residual > 0) {
+        m_network.push(arc, residual);
+        m_excess[vertex] -= residual;
+        m_excess[m_network.head(arc)] += residual;
+      }
+    }
+  }
+
+  void takeExcessFromFlow()
+  {
+    for (std::size_t v{0}; v < m_n; ++v) {
+      for (std::size_t arc{m_network.firstArc(v)};
+           arc < m_network.lastArc(v);
+           ++arc) {
+        m_excess[v] -= m_network.flow(arc);
+      }
+    }
+  }
+
+  [[nodiscard]] std::int64_t excessOf(std::size_t vertex) const
+  {
+    return m_excess[vertex];
+  }
+
+  void run()
+  {
+    globalRelabel();
+
+    if (m_rule == SelectionRule::HighestLabel) { runHighestLabel(); }
+    else {
+      runFifo();
+    }
+  }
+
+private:
+  [[nodiscard]] bool isDischargeable(std::size_t vertex) const
+  {
+    return vertex != m_root && vertex != m_excluded;
+  }
+
+  void runHighestLabel()
+  {
+    for (;;) {
+      while (m_activeFirst[m_highestActive] == none) {
+        if (m_highestActive == 0) { return; }
+
+        --m_highestActive;
+      }
+
+      const std::size_t v{m_activeFirst[m_highestActive]};
+      m_activeFirst[m_highestActive] = m_activeNext[v];
+      discharge(v);
+
+      if (m_work > m_globalRelabelThreshold) { globalRelabel(); }
+    }
+  }
+
+  void runFifo()
+  {
+    while (!m_fifo.empty()) {
+      const std::size_t v{m_fifo.front()};
+      m_fifo.pop();
+
+      if (m_label[v] >= m_n || m_excess[v] == 0) { continue; }
+
+      discharge(v);
+
+      if (m_work > m_globalRelabelThreshold) { globalRelabel(); }
+    }
+  }
+
+  void activate(std::size_t vertex)
+  {
+    if (m_rule == SelectionRule::HighestLabel) {
+      const std::size_t label{m_label[vertex]};
+      m_activeNext[vertex] = m_activeFirst[label];
+      m_activeFirst[label] = vertex;
+      m_highestActive      = std::max(m_highestActive, label);
+    }
+    else {
+      m_fifo.push(vertex);
+    }
+  }
+
+  void bucketInsert(std::size_t vertex)
+  {
+    const std::size_t label{m_label[vertex]};
+    m_bucketPrev[vertex] = none;
+    m_bucketNext[vertex] = m_bucketFirst[label];
+
+    if (m_bucketFirst[label] != none) {
+      m_bucketPrev[m_bucketFirst[label]] = vertex;
+    }
+
+    m_bucketFirst[label] = vertex;
+    m_highestLabel       = std::max(m_highestLabel, label);
+  }
+
+  void bucketRemove(std::size_t vertex)
+  {
+    const std::size_t label{m_label[vertex]};
+
+    if (m_bucketPrev[vertex] != none) {
+      m_bucketNext[m_bucketPrev[vertex]] = m_bucketNext[vertex];
+    }
+    else {
+      m_bucketFirst[label] = m_bucketNext[vertex];
+    }
+
+    if (m_bucketNext[vertex] != none) {
+      m_bucketPrev[m_bucketNext[vertex]] = m_bucketPrev[vertex];
+    }
+  }
+
+  void discharge(std::size_t v)
+  {
+    while (m_excess[v] > 0) {
+      const std::size_t last{m_network.lastArc(v)};
+
+      for (std::size_t& arc{m_currentArc[v]}; arc < last; ++arc) {
+        const std::size_t w{m_network.head(arc)};
+
+        if (
+          m_network.residual(arc) > 0 && m_label[v] == m_label[w] + 1) {
+          const std::int64_t delta{
+            std::min(m_excess[v], m_network.residual(arc))};
+          const bool wasInactive{m_excess[w] == 0};
+          m_network.push(arc, delta);
+          m_excess[v] -= delta;
+          m_excess[w] += delta;
+
+          if (wasInactive && isDischargeable(w)) { activate(w); }
+
+          if (m_excess[v] == 0) { return; }
+        }
+      }
+
+      relabel(v);
+
+      if (m_label[v] >= m_n) { return; }
+    }
+  }
+
+  void relabel(std::size_t v)
+  {
+    const std::size_t oldLabel{m_label[v]};
+    bucketRemove(v);
+
+    if (m_bucketFirst[oldLabel] == none) {
+      gap(oldLabel);
+      m_label[v] = m_n;
+      return;
+    }
+
+    std::size_t newLabel{m_n};
+    std::size_t newArc{m_network.firstArc(v)};
+
+    for (std::size_t arc{m_network.firstArc(v)};
+         arc < m_network.lastArc(v);
+         ++arc) {
+      if (m_network.residual(arc) > 0) {
+        if (const std::size_t candidate{m_label[m_network.head(arc)] + 1};
+            candidate < newLabel) {
+          newLabel = candidate;
+          newArc   = arc;
+        }
+      }
+    }
+
+    m_work += 12 + m_network.lastArc(v) - m_network.firstArc(v);
+    m_label[v] = newLabel;
+
+    if (newLabel < m_n) {
+      m_currentArc[v] = newArc;
+      bucketInsert(v);
+    }
+  }
+
+  void gap(std::size_t emptyLabel)
+  {
+    for (std::size_t label{emptyLabel + 1}; label <= m_highestLabel; ++label) {
+      for (std::size_t v{m_bucketFirst[label]}; v != none;
+           v = m_bucketNext[v]) {
+        m_label[v] = m_n;
+      }
+
+      m_bucketFirst[label] = none;
+      m_activeFirst[label] = none;
+    }
+
+    m_highestLabel  = emptyLabel > 0 ? emptyLabel - 1 : 0;
+    m_highestActive = std::min(m_highestActive, m_highestLabel);
+  }
+
+  void globalRelabel()
+  {
+    std::fill(m_label.begin(), m_label.end(), m_n);
+    std::fill(m_bucketFirst.begin(), m_bucketFirst.end(), none);
+    std::fill(m_activeFirst.begin(), m_activeFirst.end(), none);
+    m_fifo          = std::queue<std::size_t>{};
+    m_highestLabel  = 0;
+    m_highestActive = 0;
+    m_work          = 0;
+
+    std::queue<std::size_t> queue{};
+    m_label[m_root] = 0;
+    queue.push(m_root);
+
+    while (!queue.empty()) {
+      const std::size_t u{queue.front()};
+      queue.pop();
+
+      for (std::size_t arc{m_network.firstArc(u)};
+           arc < m_network.lastArc(u);
+           ++arc) {
+        const std::size_t w{m_network.head(arc)};
+
+        if (
+          m_label[w] == m_n && w != m_excluded
+          && m_network.residual(m_network.reverse(arc)) > 0) {
+          m_label[w] = m_label[u] + 1;
+          queue.push(w);
+        }
+      }
+    }
+
+    for (std::size_t v{0}; v < m_n; ++v) {
+      if (!isDischargeable(v) || m_label[v] >= m_n) { continue; }
+
+      m_currentArc[v] = m_network.firstArc(v);
+      bucketInsert(v);
+
+      if (m_excess[v] > 0) { activate(v); }
+    }
+  }
+
+  ResidualNetwork&          m_network;
+  std::size_t               m_root;
+  std::size_t               m_excluded;
+  SelectionRule             m_rule;
+  std::size_t               m_n;
+  std::vector<std::size_t>  m_label;
+  std::vector<std::int64_t> m_excess;
+  std::vector<std::size_t>  m_currentArc;
+  std::vector<std::size_t>  m_bucketFirst; /*!< All vertices by label */
+  std::vector<std::size_t>  m_bucketNext;
+  std::vector<std::size_t>  m_bucketPrev;
+  std::vector<std::size_t>  m_activeFirst; /*!< Active vertices by label */
+  std::vector<std::size_t>  m_activeNext;
+  std::queue<std::size_t>   m_fifo;
+  std::size_t               m_highestLabel;
+  std::size_t               m_highestActive;
+  std::size_t               m_work;
+  std::size_t               m_globalRelabelThreshold;
+};
+} // anonymous namespace
+
+std::ostream& operator<<(std::ostream& os, SelectionRule rule)
+{
+  switch (rule) {
+  case SelectionRule::HighestLabel: os << "HighestLabel"; break;
+  case SelectionRule::Fifo: os << "Fifo"; break;
+  }
+
+  return os;
+}
+
+namespace detail {
+std::int64_t maximumPreflow(
+  ResidualNetwork& network,
+  std::size_t      source,
+  std::size_t      sink,
+  SelectionRule    rule)
+{
+  if (source == sink) {
+    G_THROW(
+      GraphException, "The source and the sink were both %zu.", source);
+  }
+
+  Discharger discharger{network, sink, source, rule};
+  discharger.saturateArcsOf(source);
+  discharger.run();
+  return discharger.excessOf(sink);
+}
+
+void convertPreflowToFlow(
+  ResidualNetwork& network,
+  std::size_t      source,
+  std::size_t      sink)
+{
+  Discharger discharger{network, source, sink, SelectionRule::Fifo};
+  discharger.takeExcessFromFlow();
+  discharger.run();
+}
+} // namespace detail
+} // namespace g::algo::push_relabel
@@ -0,0 +1,288 @@
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "algo/push_relabel/parallel_algorithm.hpp"
+#include "graph_exception.hpp"
+#include "throw.hpp"
+
+namespace g::algo::push_relabel {
+namespace {
+/*!
+ * \brief Shared state of the synchronous parallel push-relabel method.
+ *
+ * Within a round the labels are only read while pushing. A push along an
+ * arc requires the label of its tail to be one above the label of its head,
+ * so the two endpoints of an arc never push along it in the same round and
+ * every arc pair is modified by at most one thread.
+ **/
+class ParallelDischarger {
+public:
+  ParallelDischarger(
+    ResidualNetwork& network,
+    std::size_t      source,
+    std::size_t      sink,
+    ThreadTeam&      team)
+    : m_network{network}
+    , m_source{source}
+    , m_sink{sink}
+    , m_team{team}
+    , m_n{network.vertexCount()}
+    , m_label(m_n, m_n)
+    , m_newLabel(m_n, m_n)
+    , m_excess(m_n, 0)
+    , m_added(m_n)
+    , m_isQueued(m_n)
+    , m_active{}
+    , m_perThread(team.threadCount())
+    , m_work(team.threadCount())
+    , m_globalRelabelThreshold{6 * m_n + network.arcCount()}
+  {
+  }
+
+  void saturateArcsOfSource()
+  {
+    for (std::size_t arc{m_network.firstArc(m_source)};
+         arc < m_network.lastArc(m_source);
+         ++arc) {
+      if (const std::int64_t residual{m_network.residual(arc)}; residual > 0) {
+        m_network.push(arc, residual);
+        m_excess[m_source] -= residual;
+        m_excess[m_network.head(arc)] += residual;
+      }
+    }
+  }
+
+  void run()
+  {
+    std::size_t workSinceGlobalRelabel{0};
+    globalRelabel();
+
+    while (!m_active.empty()) {
+      pushPhase();
+      relabelPhase();
+      applyPhase();
+
+      for (std::size_t& work : m_work) {
+        workSinceGlobalRelabel += work;
+        work = 0;
+      }
+
+      if (workSinceGlobalRelabel > m_globalRelabelThreshold) {
+        globalRelabel();
+        workSinceGlobalRelabel = 0;
+      }
+    }
+  }
+
+  [[nodiscard]] std::int64_t excessOf(std::size_t vertex) const
+  {
+    return m_excess[vertex];
+  }
+
+private:
+  [[nodiscard]] bool isDischargeable(std::size_t vertex) const
+  {
+    return vertex != m_source && vertex != m_sink;
+  }
+
+  void pushPhase()
+  {
+    for (std::size_t v : m_active) {
+      m_isQueued[v].store(true, std::memory_order_relaxed);
+    }
+
+    m_team.parallelFor(
+      m_active.size(),
+      [this](std::size_t begin, std::size_t end, std::size_t thread) {
+        for (std::size_t i{begin}; i < end; ++i) { push(m_active[i], thread); }
+      });
+  }
+
+  void push(std::size_t v, std::size_t thread)
+  {
+    std::int64_t      excess{m_excess[v]};
+    const std::size_t label{m_label[v]};
+
+    for (std::size_t arc{m_network.firstArc(v)};
+         excess > 0 && arc < m_network.lastArc(v);
+         ++arc) {
+      const std::size_t w{m_network.head(arc)};
+
+      // The label test has to come first: it guarantees that no other
+      // thread is modifying this arc pair.
+      if (label != m_label[w] + 1 || m_network.residual(arc) <= 0) {
+        continue;
+      }
+
+      const std::int64_t delta{std::min(excess, m_network.residual(arc))};
+      m_network.push(arc, delta);
+      excess -= delta;
+      m_added[w].fetch_add(delta, std::memory_order_relaxed);
+
+      if (
+        isDischargeable(w)
+        && !m_isQueued[w].exchange(true, std::memory_order_relaxed)) {
+        m_perThread[thread].push_back(w);
+      }
+    }
+
+    m_excess[v] = excess;
+  }
+
+  void relabelPhase()
+  {
+    m_team.parallelFor(
+      m_active.size(),
+      [this](std::size_t begin, std::size_t end, std::size_t thread) {
+        for (std::size_t i{begin}; i < end; ++i) {
+          const std::size_t v{m_active[i]};
+
+          if (m_excess[v] == 0) { continue; }
+
+          std::size_t newLabel{m_n};
+
+          for (std::size_t arc{m_network.firstArc(v)};
+               arc < m_network.lastArc(v);
+               ++arc) {
+            if (m_network.residual(arc) > 0) {
+              newLabel
+                = std::min(newLabel, m_label[m_network.head(arc)] + 1);
+            }
+          }
+
+          m_newLabel[v] = std::min(newLabel, m_n);
+          m_work[thread]
+            += 12 + m_network.lastArc(v) - m_network.firstArc(v);
+        }
+      });
+  }
+
+  void applyPhase()
+  {
+    for (std::vector<std::size_t>& discovered : m_perThread) {
+      m_active.insert(m_active.end(), discovered.begin(), discovered.end());
+      discovered.clear();
+    }
+
+    m_team.parallelFor(
+      m_active.size(),
+      [this](std::size_t begin, std::size_t end, std::size_t thread) {
+        for (std::size_t i{begin}; i < end; ++i) {
+          const std::size_t v{m_active[i]};
+          m_label[v] = m_newLabel[v];
+          m_excess[v] += m_added[v].exchange(0, std::memory_order_relaxed);
+          m_isQueued[v].store(false, std::memory_order_relaxed);
+
+          if (m_excess[v] > 0 && m_label[v] < m_n) {
+            m_perThread[thread].push_back(v);
+          }
+        }
+      });
+
+    m_excess[m_sink] += m_added[m_sink].exchange(0);
+    m_excess[m_source] += m_added[m_source].exchange(0);
+    collectActive();
+  }
+
+  void collectActive()
+  {
+    m_active.clear();
+
+    for (std::vector<std::size_t>& vertices : m_perThread) {
+      m_active.insert(m_active.end(), vertices.begin(), vertices.end());
+      vertices.clear();
+    }
+  }
+
+  void globalRelabel()
+  {
+    std::vector<std::atomic<bool>> isVisited(m_n);
+    std::vector<std::size_t>       frontier{m_sink};
+    isVisited[m_sink].store(true);
+    isVisited[m_source].store(true);
+    std::fill(m_label.begin(), m_label.end(), m_n);
+    m_label[m_sink] = 0;
+
+    for (std::size_t level{1}; !frontier.empty(); ++level) {
+      m_team.parallelFor(
+        frontier.size(),
+        [this, &frontier, &isVisited, level](
+          std::size_t begin, std::size_t end, std::size_t thread) {
+          for (std::size_t i{begin}; i < end; ++i) {
+            const std::size_t u{frontier[i]};
+
+            for (std::size_t arc{m_network.firstArc(u)};
+                 arc < m_network.lastArc(u);
+                 ++arc) {
+              const std::size_t w{m_network.head(arc)};
+
+              if (
+                m_network.residual(m_network.reverse(arc)) > 0
+                && !isVisited[w].load(std::memory_order_relaxed)
+                && !isVisited[w].exchange(true, std::memory_order_relaxed)) {
+                m_label[w] = level;
+                m_perThread[thread].push_back(w);
+              }
+            }
+          }
+        });
+
+      frontier.clear();
+
+      for (std::vector<std::size_t>& vertices : m_perThread) {
+        frontier.insert(frontier.end(), vertices.begin(), vertices.end());
+        vertices.clear();
+      }
+    }
+
+    m_team.parallelFor(
+      m_n, [this](std::size_t begin, std::size_t end, std::size_t thread) {
+        for (std::size_t v{begin}; v < end; ++v) {
+          m_newLabel[v] = m_label[v];
+
+          if (isDischargeable(v) && m_excess[v] > 0 && m_label[v] < m_n) {
+            m_perThread[thread].push_back(v);
+          }
+        }
+      });
+
+    collectActive();
+  }
+
+  ResidualNetwork&                       m_network;
+  std::size_t                            m_source;
+  std::size_t                            m_sink;
+  ThreadTeam&                            m_team;
+  std::size_t                            m_n;
+  std::vector<std::size_t>               m_label;
+  std::vector<std::size_t>               m_newLabel;
+  std::vector<std::int64_t>              m_excess;
+  std::vector<std::atomic<std::int64_t>> m_added;
+  std::vector<std::atomic<bool>>         m_isQueued;
+  std::vector<std::size_t>               m_active;
+  std::vector<std::vector<std::size_t>>  m_perThread;
+  std::vector<std::size_t>               m_work;
+  std::size_t                            m_globalRelabelThreshold;
+};
+} // anonymous namespace
+
+namespace detail {
+std::int64_t parallelMaximumPreflow(
+  ResidualNetwork& network,
+  std::size_t      source,
+  std::size_t      sink,
+  ThreadTeam&      team)
+{
+  if (source == sink) {
+    G_THROW(
+      GraphException, "The source and the sink were both %zu.", source);
+  }
+
+  ParallelDischarger discharger{network, source, sink, team};
+  discharger.saturateArcsOfSource();
+  discharger.run();
+  return discharger.excessOf(sink);
+}
+} // namespace detail
+} // namespace g::algo::push_relabel
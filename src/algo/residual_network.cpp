@@ -0,0 +1,174 @@
+#include <queue>
+#include <utility>
+
+#include "algo/residual_network.hpp"
+
+namespace g::algo {
+ResidualNetwork::ResidualNetwork(
+  VertexIndex                      vertexIndex,
+  std::vector<Edge>                edges,
+  const std::vector<std::int64_t>& capacities)
+  : m_vertexIndex{std::move(vertexIndex)}
+  , m_edges{std::move(edges)}
+  , m_firstArc(m_vertexIndex.size() + 1, 0)
+  , m_edgeArc(m_edges.size())
+  , m_head(2 * m_edges.size())
+  , m_reverse(2 * m_edges.size())
+  , m_capacity(2 * m_edges.size(), 0)
+  , m_residual(2 * m_edges.size(), 0)
+  , m_isForward(2 * m_edges.size(), false)
+{
+  G_ASSERT(
+    m_edges.size() == capacities.size(),
+    "edges.size(): %zu, capacities.size(): %zu",
+    m_edges.size(),
+    capacities.size());
+
+  std::vector<std::size_t> tails(m_edges.size());
+  std::vector<std::size_t> heads(m_edges.size());
+
+  for (std::size_t i{0}; i < m_edges.size(); ++i) {
+    tails[i] = m_vertexIndex.indexOf(m_edges[i].source());
+    heads[i] = m_vertexIndex.indexOf(m_edges[i].target());
+    ++m_firstArc[tails[i] + 1];
+    ++m_firstArc[heads[i] + 1];
+  }
+
+  for (std::size_t v{0}; v < m_vertexIndex.size(); ++v) {
+    m_firstArc[v + 1] += m_firstArc[v];
+  }
+
+  std::vector<std::size_t> nextArc(
+    m_firstArc.begin(), m_firstArc.end() - 1);
+
+  for (std::size_t i{0}; i < m_edges.size(); ++i) {
+    const std::size_t forward{nextArc[tails[i]]++};
+    const std::size_t backward{nextArc[heads[i]]++};
+    m_head[forward]     = heads[i];
+    m_head[backward]    = tails[i];
+    m_reverse[forward]  = backward;
+    m_reverse[backward] = forward;
+    m_capacity[forward] = capacities[i];
+    m_residual[forward] = capacities[i];
+    m_isForward[forward] = true;
+    m_edgeArc[i]        = forward;
+  }
+}
+
+const VertexIndex& ResidualNetwork::vertexIndex() const
+{
+  return m_vertexIndex;
+}
+
+std::size_t ResidualNetwork::vertexCount() const
+{
+  return m_vertexIndex.size();
+}
+
+std::size_t ResidualNetwork::arcCount() const { return m_head.size(); }
+
+std::size_t ResidualNetwork::edgeCount() const { return m_edges.size(); }
+
+const Edge& ResidualNetwork::edgeAt(std::size_t edgeIndex) const
+{
+  return m_edges[edgeIndex];
+}
+
+std::size_t ResidualNetwork::firstArc(std::size_t vertex) const
+{
+  return m_firstArc[vertex];
+}
+
+std::size_t ResidualNetwork::lastArc(std::size_t vertex) const
+{
+  return m_firstArc[vertex + 1];
+}
+
+std::size_t ResidualNetwork::arcOfEdge(std::size_t edgeIndex) const
+{
+  return m_edgeArc[edgeIndex];
+}
+
+std::optional<std::size_t> ResidualNetwork::findArc(
+  std::size_t tail,
+  std::size_t head) const
+{
+  for (std::size_t arc{firstArc(tail)}; arc < lastArc(tail); ++arc) {
+    if (m_head[arc] == head && m_isForward[arc]) { return arc; }
+  }
+
+  return std::nullopt;
+}
+
+void ResidualNetwork::setCapacity(std::size_t arc, std::int64_t capacity)
+{
+  m_residual[arc] += capacity - m_capacity[arc];
+  m_capacity[arc] = capacity;
+}
+
+void ResidualNetwork::reset() { m_residual = m_capacity; }
+
+std::vector<bool> ResidualNetwork::verticesReaching(std::size_t target) const
+{
+  std::vector<bool>       isReaching(vertexCount(), false);
+  std::queue<std::size_t> queue{};
+  isReaching[target] = true;
+  queue.push(target);
+
+  while (!queue.empty()) {
+    const std::size_t u{queue.front()};
+    queue.pop();
+
+    for (std::size_t arc{firstArc(u)}; arc < lastArc(u); ++arc) {
+      const std::size_t w{m_head[arc]};
+
+      if (!isReaching[w] && m_residual[m_reverse[arc]] > 0) {
+        isReaching[w] = true;
+        queue.push(w);
+      }
+    }
+  }
+
+  return isReaching;
+}
+
+std::vector<bool> ResidualNetwork::verticesReachableFrom(
+  std::size_t source) const
+{
+  std::vector<bool>       isReachable(vertexCount(), false);
+  std::queue<std::size_t> queue{};
+  isReachable[source] = true;
+  queue.push(source);
+
+  while (!queue.empty()) {
+    const std::size_t u{queue.front()};
+    queue.pop();
+
+    for (std::size_t arc{firstArc(u)}; arc < lastArc(u); ++arc) {
+      const std::size_t w{m_head[arc]};
+
+      if (!isReachable[w] && m_residual[arc] > 0) {
+        isReachable[w] = true;
+        queue.push(w);
+      }
+    }
+  }
+
+  return isReachable;
+}
+
+std::unordered_map<Edge, std::int32_t> ResidualNetwork::flowMap() const
+{
+  std::unordered_map<Edge, std::int32_t> result{};
+  result.reserve(2 * m_edges.size());
+
+  for (std::size_t i{0}; i < m_edges.size(); ++i) {
+    const Edge&        edge{m_edges[i]};
+    const std::int32_t amount{static_cast<std::int32_t>(flow(m_edgeArc[i]))};
+    result[edge] += amount;
+    result[Edge{edge.target(), edge.source()}] -= amount;
+  }
+
+  return result;
+}
+} // namespace g::algo
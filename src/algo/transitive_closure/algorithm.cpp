@@ -0,0 +1,180 @@
+#include <cstdint>
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+#include <span>
+#include <utility>
+
+#include "algo/transitive_closure/algorithm.hpp"
+
+namespace g::algo::transitive_closure {
+namespace {
+/*!
+ * \brief The count of finished components that are handed out together.
+ **/
+constexpr std::size_t groupSize{8};
+
+/*!
+ * \brief The predecessors of every component in compressed sparse row form.
+ **/
+struct Predecessors {
+  std::vector<std::size_t> first; /*!< CSR offsets, one per component + 1 */
+  std::vector<std::size_t> source;
+};
+
+/*!
+ * \brief Reverses every arc of `condensation`.
+ * \param condensation The components.
+ * \return The predecessors of every component.
+ **/
+Predecessors predecessorsOf(const Condensation& condensation)
+{
+  const std::size_t componentCount{condensation.componentCount()};
+  Predecessors      result{
+    std::vector<std::size_t>(componentCount + 1, 0),
+    std::vector<std::size_t>(condensation.arcCount())};
+
+  for (std::size_t arc{0}; arc < condensation.arcCount(); ++arc) {
+    ++result.first[condensation.target(arc) + 1];
+  }
+
+  std::partial_sum(
+    result.first.begin(), result.first.end(), result.first.begin());
+  std::vector<std::size_t> position{result.first};
+
+  for (std::size_t source{0}; source < componentCount; ++source) {
+    for (std::size_t arc{condensation.firstArc(source)};
+         arc < condensation.lastArc(source);
+         ++arc) {
+      result.source[position[condensation.target(arc)]++] = source;
+    }
+  }
+
+  return result;
+}
+} // anonymous namespace
+
+TransitiveClosure::TransitiveClosure(
+  VertexIndex              vertexIndex,
+  std::vector<std::size_t> componentOf,
+  BitMatrix                reachability)
+  : m_vertexIndex{std::move(vertexIndex)}
+  , m_componentOf{std::move(componentOf)}
+  , m_reachability{std::move(reachability)}
+{
+}
+
+const VertexIndex& TransitiveClosure::vertexIndex() const
+{
+  return m_vertexIndex;
+}
+
+std::size_t TransitiveClosure::componentCount() const
+{
+  return m_reachability.rowCount();
+}
+
+bool TransitiveClosure::reaches(
+  VertexIdentifier source,
+  VertexIdentifier target) const
+{
+  return reachesByIndex(
+    m_vertexIndex.indexOf(source), m_vertexIndex.indexOf(target));
+}
+
+const BitMatrix& TransitiveClosure::reachability() const
+{
+  return m_reachability;
+}
+
+namespace detail {
+BitMatrix componentReachability(const Condensation& condensation)
+{
+  const std::size_t  componentCount{condensation.componentCount()};
+  const Predecessors predecessors{predecessorsOf(condensation)};
+
+  BitMatrix reachability{componentCount, componentCount};
+  BitMatrix table{std::size_t{1} << groupSize, componentCount};
+
+  // The members of the current group that every predecessor has an arc to.
+  std::vector<std::uint8_t> mask(componentCount, 0);
+  std::vector<std::size_t>  touched{};
+
+  for (std::size_t first{0}; first < componentCount; first += groupSize) {
+    const std::size_t last{std::min(first + groupSize, componentCount)};
+
+    // Every successor in an earlier group has already been ORed in. The ones
+    // in this group are smaller and thus finished.
+    for (std::size_t component{first}; component < last; ++component) {
+      for (std::size_t arc{condensation.firstArc(component)};
+           arc < condensation.lastArc(component);
+           ++arc) {
+        if (const std::size_t successor{condensation.target(arc)};
+            successor >= first) {
+          orInto(
+            reachability.mutableRow(component), reachability.row(successor));
+        }
+      }
+
+      reachability.set(component, component);
+    }
+
+    std::size_t arcCount{0};
+
+    for (std::size_t component{first}; component < last; ++component) {
+      for (std::size_t i{predecessors.first[component]};
+           i < predecessors.first[component + 1];
+           ++i) {
+        if (const std::size_t predecessor{predecessors.source[i]};
+            predecessor >= last) {
+          if (mask[predecessor] == 0) { touched.push_back(predecessor); }
+
+          mask[predecessor] |= static_cast<std::uint8_t>(
+            1U << (component - first));
+          ++arcCount;
+        }
+      }
+    }
+
+    const std::size_t tableSize{std::size_t{1} << (last - first)};
+
+    if (arcCount - touched.size() >= tableSize) {
+      // Every subset is the OR of a smaller subset and a single member.
+      for (std::size_t subset{1}; subset < tableSize; ++subset) {
+        const std::span<const BitMatrix::word_type> smaller{
+          table.row(subset & (subset - 1))};
+        std::copy(
+          smaller.begin(), smaller.end(), table.mutableRow(subset).begin());
+        orInto(
+          table.mutableRow(subset),
+          reachability.row(
+            first + static_cast<std::size_t>(std::countr_zero(subset))));
+      }
+
+      for (std::size_t predecessor : touched) {
+        orInto(
+          reachability.mutableRow(predecessor), table.row(mask[predecessor]));
+        mask[predecessor] = 0;
+      }
+    }
+    else {
+      for (std::size_t predecessor : touched) {
+        for (unsigned bits{mask[predecessor]}; bits != 0; bits &= bits - 1) {
+          orInto(
+            reachability.mutableRow(predecessor),
+            reachability.row(
+              first + static_cast<std::size_t>(std::countr_zero(bits))));
+        }
+
+        mask[predecessor] = 0;
+      }
+    }
+
+    touched.clear();
+  }
+
+  return reachability;
+}
+} // namespace detail
+} // namespace g::algo::transitive_closure
@@ -0,0 +1,22 @@
+#include <algorithm>
+
+#include "algo/traversal.hpp"
+
+namespace g::algo {
+Traversal::Traversal(std::size_t vertexCount)
+  : m_vertexCount{vertexCount}
+  , m_visited((vertexCount + 63) / 64, 0)
+  , m_queue{}
+  , m_stack{}
+{
+  m_queue.reserve(vertexCount);
+  m_stack.reserve(vertexCount);
+}
+
+std::size_t Traversal::vertexCount() const { return m_vertexCount; }
+
+void Traversal::reset()
+{
+  std::fill(m_visited.begin(), m_visited.end(), 0);
+}
+} // namespace g::algo
@@ -0,0 +1,47 @@
+#include <algorithm>
+#include <utility>
+
+#include "algo/vertex_index.hpp"
+#include "graph_exception.hpp"
+#include "throw.hpp"
+
+namespace g::algo {
+VertexIndex::VertexIndex(std::vector<VertexIdentifier> vertices)
+  : m_vertices{std::move(vertices)}, m_indices{}
+{
+  std::sort(m_vertices.begin(), m_vertices.end());
+  m_indices.reserve(m_vertices.size());
+
+  for (std::size_t i{0}; i < m_vertices.size(); ++i) {
+    m_indices.emplace(m_vertices[i], i);
+  }
+}
+
+std::size_t VertexIndex::size() const { return m_vertices.size(); }
+
+bool VertexIndex::contains(VertexIdentifier vertex) const
+{
+  return m_indices.find(vertex) != m_indices.end();
+}
+
+std::size_t VertexIndex::indexOf(VertexIdentifier vertex) const
+{
+  const auto it{m_indices.find(vertex)};
+
+  if (it == m_indices.end()) {
+    G_THROW(GraphException, "Vertex %zu is not indexed.", vertex);
+  }
+
+  return it->second;
+}
+
+VertexIdentifier VertexIndex::vertexAt(std::size_t index) const
+{
+  return m_vertices[index];
+}
+
+const std::vector<VertexIdentifier>& VertexIndex::vertices() const
+{
+  return m_vertices;
+}
+} // namespace g::algo
@@ -0,0 +1,268 @@
+#include <cinttypes>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include <chrono>
+#include <fstream>
+#include <istream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "algo/ford_fulkerson/algorithm.hpp"
+#include "algo/push_relabel/algorithm.hpp"
+#include "dimacs/max_flow_problem.hpp"
+#include "graph_exception.hpp"
+
+namespace {
+/*!
+ * \brief Ford-Fulkerson keeps V^2 hash map entries, so it is left out above
+ *        this count of vertices.
+ **/
+constexpr std::size_t fordFulkersonVertexLimit{1'500};
+
+/*!
+ * \brief Writes a GENRMF instance: `frameCount` frames of `side` x `side`
+ *        grids. Arcs within a frame get a capacity of `inFrameCapacity`
+ *        times side^2, the arcs from every vertex to a random vertex of the
+ *        next frame get a random capacity in [1, `betweenFrameCapacity`].
+ **/
+std::string genrmf(
+  std::size_t   side,
+  std::size_t   frameCount,
+  std::int32_t  betweenFrameCapacity,
+  std::int32_t  inFrameCapacity,
+  std::uint32_t seed)
+{
+  const std::size_t  frameSize{side * side};
+  const std::int32_t gridCapacity{
+    inFrameCapacity * static_cast<std::int32_t>(frameSize)};
+  std::mt19937                                engine{seed};
+  std::uniform_int_distribution<std::int32_t> capacity{
+    1, betweenFrameCapacity};
+  std::uniform_int_distribution<std::size_t> position{0, frameSize - 1};
+  std::ostringstream                         arcs{};
+  std::size_t                                arcCount{0};
+
+  const auto vertex{[&](std::size_t frame, std::size_t x, std::size_t y) {
+    return frame * frameSize + y * side + x + 1;
+  }};
+  const auto addArc{[&](std::size_t from, std::size_t to, std::int32_t c) {
+    arcs << "a " << from << ' ' << to << ' ' << c << '\n';
+    ++arcCount;
+  }};
+
+  for (std::size_t frame{0}; frame < frameCount; ++frame) {
+    for (std::size_t y{0}; y < side; ++y) {
+      for (std::size_t x{0}; x < side; ++x) {
+        const std::size_t from{vertex(frame, x, y)};
+
+        if (x + 1 < side) {
+          addArc(from, vertex(frame, x + 1, y), gridCapacity);
+          addArc(vertex(frame, x + 1, y), from, gridCapacity);
+        }
+
+        if (y + 1 < side) {
+          addArc(from, vertex(frame, x, y + 1), gridCapacity);
+          addArc(vertex(frame, x, y + 1), from, gridCapacity);
+        }
+
+        if (frame + 1 < frameCount) {
+          const std::size_t to{position(engine)};
+          addArc(
+            from,
+            vertex(frame + 1, to % side, to / side),
+            capacity(engine));
+        }
+      }
+    }
+  }
+
+  std::ostringstream problem{};
+  problem << "p max " << frameCount * frameSize << ' ' << arcCount << '\n'
+          << "n 1 s\nn " << frameCount * frameSize << " t\n"
+          << arcs.str();
+  return problem.str();
+}
+
+/*!
+ * \brief Writes a Washington random level graph instance: `levelCount`
+ *        levels of `width` vertices, every vertex having 3 arcs to random
+ *        vertices of the next level, plus a source and a sink.
+ **/
+std::string randomLevelGraph(
+  std::size_t   width,
+  std::size_t   levelCount,
+  std::int32_t  maxCapacity,
+  std::uint32_t seed)
+{
+  std::mt19937                                engine{seed};
+  std::uniform_int_distribution<std::int32_t> capacity{1, maxCapacity};
+  std::uniform_int_distribution<std::size_t>  column{0, width - 1};
+  const std::size_t  vertexCount{width * levelCount + 2};
+  const std::size_t  sink{vertexCount};
+  std::ostringstream arcs{};
+  std::size_t        arcCount{0};
+
+  for (std::size_t level{0}; level < levelCount; ++level) {
+    for (std::size_t i{0}; i < width; ++i) {
+      const std::size_t from{level * width + i + 2};
+
+      if (level == 0) {
+        arcs << "a 1 " << from << ' ' << capacity(engine) << '\n';
+        ++arcCount;
+      }
+
+      if (level + 1 == levelCount) {
+        arcs << "a " << from << ' ' << sink << ' ' << capacity(engine)
+             << '\n';
+        ++arcCount;
+        continue;
+      }
+
+      for (int k{0}; k < 3; ++k) {
+        arcs << "a " << from << ' ' << (level + 1) * width + column(engine) + 2
+             << ' ' << capacity(engine) << '\n';
+        ++arcCount;
+      }
+    }
+  }
+
+  std::ostringstream problem{};
+  problem << "p max " << vertexCount << ' ' << arcCount << '\n'
+          << "n 1 s\nn " << sink << " t\n"
+          << arcs.str();
+  return problem.str();
+}
+
+/*!
+ * \brief Runs `solve` and returns the milliseconds taken and the flow.
+ **/
+template<typename Solve>
+std::pair<double, std::int32_t> measure(const Solve& solve)
+{
+  const auto         begin{std::chrono::steady_clock::now()};
+  const std::int32_t maxFlow{solve().maxFlow()};
+  const auto         end{std::chrono::steady_clock::now()};
+  return {
+    std::chrono::duration<double, std::milli>(end - begin).count(), maxFlow};
+}
+
+/*!
+ * \brief Solves a DIMACS instance with every solver and prints a table row.
+ * \return false if the solvers disagree on the maximum flow.
+ **/
+bool run(const std::string& name, std::istream& is)
+{
+  const g::dimacs::MaxFlowProblem       problem{
+    g::dimacs::readMaxFlowProblem(is)};
+  const g::dimacs::max_flow_graph_type& graph{problem.graph()};
+  const auto [highestLabelMs, maxFlow]{measure([&] {
+    return g::algo::push_relabel::algorithm(
+      graph,
+      problem.source(),
+      problem.sink(),
+      g::algo::push_relabel::SelectionRule::HighestLabel);
+  })};
+  const auto [fifoMs, fifoFlow]{measure([&] {
+    return g::algo::push_relabel::algorithm(
+      graph,
+      problem.source(),
+      problem.sink(),
+      g::algo::push_relabel::SelectionRule::Fifo);
+  })};
+  bool isConsistent{fifoFlow == maxFlow};
+
+  std::printf(
+    "%-24s %8zu %8zu %10" PRId32 " %10.1f %10.1f ",
+    name.c_str(),
+    graph.vertexCount(),
+    graph.edgeCount(),
+    maxFlow,
+    highestLabelMs,
+    fifoMs);
+
+  if (graph.vertexCount() <= fordFulkersonVertexLimit) {
+    const auto [fordFulkersonMs, fordFulkersonFlow]{measure([&] {
+      return g::algo::ford_fulkerson::algorithm(
+        graph, problem.source(), problem.sink());
+    })};
+    isConsistent = isConsistent && fordFulkersonFlow == maxFlow;
+    std::printf("%14.1f", fordFulkersonMs);
+  }
+  else {
+    std::printf("%14s", "-");
+  }
+
+  std::printf("%s\n", isConsistent ? "" : " mismatch");
+  return isConsistent;
+}
+} // anonymous namespace
+
+/*!
+ * \brief Times push-relabel with both selection rules and Ford-Fulkerson on
+ *        the DIMACS max-flow instances given as arguments, or on generated
+ *        GENRMF and Washington random level graph instances if there are
+ *        none.
+ **/
+int main(int argc, char* argv[])
+{
+  std::printf(
+    "%-24s %8s %8s %10s %10s %10s %14s\n",
+    "instance",
+    "V",
+    "E",
+    "max flow",
+    "HL ms",
+    "FIFO ms",
+    "Ford-Ful. ms");
+  bool isConsistent{true};
+
+  try {
+    if (argc > 1) {
+      for (int i{1}; i < argc; ++i) {
+        std::ifstream file{argv[i]};
+        isConsistent = run(argv[i], file) && isConsistent;
+      }
+    }
+    else {
+      for (const auto& [side, frameCount] :
+           {std::pair<std::size_t, std::size_t>{4, 16},
+            {8, 8},
+            {8, 16},
+            {16, 16},
+            {24, 32}}) {
+        std::istringstream is{genrmf(side, frameCount, 1'000, 1, 1)};
+        isConsistent = run(
+                         "genrmf " + std::to_string(side) + 'x'
+                           + std::to_string(frameCount),
+                         is)
+                       && isConsistent;
+      }
+
+      for (const auto& [width, levelCount] :
+           {std::pair<std::size_t, std::size_t>{16, 64},
+            {32, 32},
+            {64, 256},
+            {256, 256}}) {
+        std::istringstream is{randomLevelGraph(width, levelCount, 10'000, 1)};
+        isConsistent = run(
+                         "rlg " + std::to_string(width) + 'x'
+                           + std::to_string(levelCount),
+                         is)
+                       && isConsistent;
+      }
+    }
+  }
+  catch (const g::GraphException& exception) {
+    std::fprintf(stderr, "%s\n", exception.what());
+    return 1;
+  }
+
+  if (!isConsistent) {
+    std::fprintf(stderr, "The solvers disagree on a maximum flow!\n");
+    return 1;
+  }
+}
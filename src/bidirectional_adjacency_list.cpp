@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <ostream>
+
+#include "bidirectional_adjacency_list.hpp"
+
+namespace g {
+std::ostream& operator<<(std::ostream& os, const BidirectionalAdjacencyList& l)
+{
+  os << "BidirectionalAdjacencyList:\n";
+
+  for (std::size_t i{0}; i < l.m_outgoing.size(); ++i) {
+    os << i << ": ";
+
+    for (const auto& e : l.m_outgoing[i]) { os << e << ' '; }
+
+    os << '\n';
+  }
+
+  return os;
+}
+
+BidirectionalAdjacencyList::BidirectionalAdjacencyList()
+  : m_outgoing{}, m_incoming{}
+{
+}
+
+bool BidirectionalAdjacencyList::isDirectlyReachable(
+  VertexIdentifier source,
+  VertexIdentifier target) const
+{
+  const std::vector<VertexIdentifier>* list{listOf(m_outgoing, source)};
+
+  if (list == nullptr) { return false; }
+
+  return std::find(list->begin(), list->end(), target) != list->end();
+}
+
+void BidirectionalAdjacencyList::addTo(
+  VertexIdentifier source,
+  VertexIdentifier target)
+{
+  if (isDirectlyReachable(source, target)) { return; }
+
+  const std::size_t size{std::max(source, target) + 1};
+
+  if (m_outgoing.size() < size) {
+    m_outgoing.resize(size);
+    m_incoming.resize(size);
+  }
+
+  m_outgoing[source].push_back(target);
+  m_incoming[target].push_back(source);
+}
+
+std::vector<VertexIdentifier> BidirectionalAdjacencyList::directlyReachables(
+  VertexIdentifier source) const
+{
+  if (const std::vector<VertexIdentifier>* list{listOf(m_outgoing, source)};
+      list != nullptr) {
+    return *list;
+  }
+
+  return {};
+}
+
+std::vector<VertexIdentifier> BidirectionalAdjacencyList::incoming(
+  VertexIdentifier target) const
+{
+  if (const std::vector<VertexIdentifier>* list{listOf(m_incoming, target)};
+      list != nullptr) {
+    return *list;
+  }
+
+  return {};
+}
+
+std::size_t BidirectionalAdjacencyList::inDegree(VertexIdentifier target) const
+{
+  const std::vector<VertexIdentifier>* list{listOf(m_incoming, target)};
+  return list == nullptr ? 0 : list->size();
+}
+
+void BidirectionalAdjacencyList::removeAdjacentFrom(
+  VertexIdentifier source,
+  VertexIdentifier target)
+{
+  eraseFrom(m_outgoing, source, target);
+  eraseFrom(m_incoming, target, source);
+}
+
+void BidirectionalAdjacencyList::removeVertex(VertexIdentifier toRemove)
+{
+  if (toRemove >= m_outgoing.size()) { return; }
+
+  for (VertexIdentifier target : m_outgoing[toRemove]) {
+    eraseFrom(m_incoming, target, toRemove);
+  }
+
+  for (VertexIdentifier source : m_incoming[toRemove]) {
+    eraseFrom(m_outgoing, source, toRemove);
+  }
+
+  m_outgoing[toRemove].clear();
+  m_incoming[toRemove].clear();
+}
+
+void BidirectionalAdjacencyList::clear()
+{
+  m_outgoing.clear();
+  m_incoming.clear();
+}
+
+void BidirectionalAdjacencyList::swap(this_type& other) noexcept
+{
+  m_outgoing.swap(other.m_outgoing);
+  m_incoming.swap(other.m_incoming);
+}
+
+const std::vector<VertexIdentifier>* BidirectionalAdjacencyList::listOf(
+  const std::vector<std::vector<VertexIdentifier>>& lists,
+  VertexIdentifier                                  vertex)
+{
+  if (vertex >= lists.size()) { return nullptr; }
+
+  return &lists[vertex];
+}
+
+void BidirectionalAdjacencyList::eraseFrom(
+  std::vector<std::vector<VertexIdentifier>>& lists,
+  VertexIdentifier                            vertex,
+  VertexIdentifier                            value)
+{
+  if (vertex >= lists.size()) { return; }
+
+  std::vector<VertexIdentifier>& list{lists[vertex]};
+
+  if (const auto it{std::find(list.begin(), list.end(), value)};
+      it != list.end()) {
+    list.erase(it);
+  }
+}
+
+void swap(
+  BidirectionalAdjacencyList& lhs,
+  BidirectionalAdjacencyList& rhs) noexcept
+{
+  lhs.swap(rhs);
+}
+} // namespace g
@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <ostream>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "assert.hpp"
+#include "bit_matrix.hpp"
+
+namespace g {
+namespace {
+using word_type = BitMatrix::word_type;
+
+#if defined(__AVX2__)
+constexpr std::size_t wordsPerVector{4};
+
+__m256i load(const word_type* words)
+{
+  return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words));
+}
+
+void store(word_type* words, __m256i value)
+{
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(words), value);
+}
+
+/*!
+ * \brief Counts the set bits of every 64 bit lane of `value` by looking up
+ *        the count of every nibble.
+ **/
+__m256i countOnesPerLane(__m256i value)
+{
+  const __m256i lookup{_mm256_setr_epi8(
+    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+    0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4)};
+  const __m256i lowNibbles{_mm256_set1_epi8(0x0F)};
+  const __m256i low{_mm256_and_si256(value, lowNibbles)};
+  const __m256i high{
+    _mm256_and_si256(_mm256_srli_epi16(value, 4), lowNibbles)};
+  const __m256i counts{_mm256_add_epi8(
+    _mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high))};
+  return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+}
+
+std::size_t sumLanes(__m256i value)
+{
+  alignas(32) word_type lanes[wordsPerVector];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), value);
+  return static_cast<std::size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+}
+#endif
+} // anonymous namespace
+
+std::ostream& operator<<(std::ostream& os, const BitMatrix& m)
+{
+  for (std::size_t row{0}; row < m.rowCount(); ++row) {
+    for (std::size_t col{0}; col < m.columnCount(); ++col) {
+      os << m.test(row, col) << ' ';
+    }
+    os << '\n';
+  }
+
+  return os;
+}
+
+BitMatrix::BitMatrix() : BitMatrix{0, 0} {}
+
+BitMatrix::BitMatrix(std::size_t rowCount, std::size_t columnCount)
+  : m_rowCount{rowCount}
+  , m_columnCount{columnCount}
+  , m_wordsPerRow{wordsPerRowFor(columnCount)}
+  , m_words(rowCount * m_wordsPerRow)
+{
+}
+
+std::size_t BitMatrix::rowCount() const noexcept { return m_rowCount; }
+
+std::size_t BitMatrix::columnCount() const noexcept { return m_columnCount; }
+
+std::size_t BitMatrix::wordsPerRow() const noexcept { return m_wordsPerRow; }
+
+void BitMatrix::resize(std::size_t rowCount, std::size_t columnCount)
+{
+  if (const std::size_t wordsPerRow{wordsPerRowFor(columnCount)};
+      wordsPerRow > m_wordsPerRow) {
+    const std::size_t newWordsPerRow{std::max(wordsPerRow, 2 * m_wordsPerRow)};
+    decltype(m_words) words(rowCount * newWordsPerRow);
+
+    for (std::size_t row{0}; row < std::min(rowCount, m_rowCount); ++row) {
+      const std::span<const word_type> source{this->row(row)};
+      std::copy(
+        source.begin(),
+        source.end(),
+        words.begin() + static_cast<std::ptrdiff_t>(row * newWordsPerRow));
+    }
+
+    m_words.swap(words);
+    m_wordsPerRow = newWordsPerRow;
+  }
+  else {
+    // Rows that are dropped and added again must come back cleared.
+    m_words.resize(std::min(rowCount, m_rowCount) * m_wordsPerRow);
+    m_words.resize(rowCount * m_wordsPerRow);
+  }
+
+  m_rowCount = rowCount;
+
+  if (columnCount < m_columnCount) {
+    for (std::size_t row{0}; row < m_rowCount; ++row) {
+      for (std::size_t column{columnCount}; column < m_columnCount; ++column) {
+        reset(row, column);
+      }
+    }
+  }
+
+  m_columnCount = columnCount;
+}
+
+void BitMatrix::clear()
+{
+  m_rowCount    = 0;
+  m_columnCount = 0;
+  m_wordsPerRow = 0;
+  m_words.clear();
+}
+
+void BitMatrix::swap(this_type& other) noexcept
+{
+  std::swap(m_rowCount, other.m_rowCount);
+  std::swap(m_columnCount, other.m_columnCount);
+  std::swap(m_wordsPerRow, other.m_wordsPerRow);
+  m_words.swap(other.m_words);
+}
+
+std::size_t BitMatrix::wordsPerRowFor(std::size_t columnCount) noexcept
+{
+  const std::size_t words{(columnCount + bitsPerWord - 1) / bitsPerWord};
+  return (words + wordsPerBlock - 1) / wordsPerBlock * wordsPerBlock;
+}
+
+void swap(BitMatrix& lhs, BitMatrix& rhs) noexcept { lhs.swap(rhs); }
+
+void orInto(
+  std::span<BitMatrix::word_type>       destination,
+  std::span<const BitMatrix::word_type> source)
+{
+  G_ASSERT(
+    destination.size() == source.size(),
+    "destination.size(): %zu, source.size(): %zu",
+    destination.size(),
+    source.size());
+
+  std::size_t i{0};
+#if defined(__AVX2__)
+  for (; i + wordsPerVector <= destination.size(); i += wordsPerVector) {
+    store(
+      &destination[i],
+      _mm256_or_si256(load(&destination[i]), load(&source[i])));
+  }
+#endif
+
+  for (; i < destination.size(); ++i) { destination[i] |= source[i]; }
+}
+
+void andInto(
+  std::span<BitMatrix::word_type>       destination,
+  std::span<const BitMatrix::word_type> source)
+{
+  G_ASSERT(
+    destination.size() == source.size(),
+    "destination.size(): %zu, source.size(): %zu",
+    destination.size(),
+    source.size());
+
+  std::size_t i{0};
+#if defined(__AVX2__)
+  for (; i + wordsPerVector <= destination.size(); i += wordsPerVector) {
+    store(
+      &destination[i],
+      _mm256_and_si256(load(&destination[i]), load(&source[i])));
+  }
+#endif
+
+  for (; i < destination.size(); ++i) { destination[i] &= source[i]; }
+}
+
+std::size_t countOnes(std::span<const BitMatrix::word_type> words)
+{
+  std::size_t count{0};
+  std::size_t i{0};
+#if defined(__AVX2__)
+  __m256i counts{_mm256_setzero_si256()};
+
+  for (; i + wordsPerVector <= words.size(); i += wordsPerVector) {
+    counts = _mm256_add_epi64(counts, countOnesPerLane(load(&words[i])));
+  }
+
+  count = sumLanes(counts);
+#endif
+
+  for (; i < words.size(); ++i) {
+    count += static_cast<std::size_t>(std::popcount(words[i]));
+  }
+
+  return count;
+}
+
+std::size_t countCommonOnes(
+  std::span<const BitMatrix::word_type> lhs,
+  std::span<const BitMatrix::word_type> rhs)
+{
+  G_ASSERT(
+    lhs.size() == rhs.size(),
+    "lhs.size(): %zu, rhs.size(): %zu",
+    lhs.size(),
+    rhs.size());
+
+  std::size_t count{0};
+  std::size_t i{0};
+#if defined(__AVX2__)
+  __m256i counts{_mm256_setzero_si256()};
+
+  for (; i + wordsPerVector <= lhs.size(); i += wordsPerVector) {
+    counts = _mm256_add_epi64(
+      counts,
+      countOnesPerLane(_mm256_and_si256(load(&lhs[i]), load(&rhs[i]))));
+  }
+
+  count = sumLanes(counts);
+#endif
+
+  for (; i < lhs.size(); ++i) {
+    count += static_cast<std::size_t>(std::popcount(lhs[i] & rhs[i]));
+  }
+
+  return count;
+}
+} // namespace g
@@ -0,0 +1,130 @@
+#include <cinttypes>
+#include <cstdio>
+
+#include <istream>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "dimacs/max_flow_problem.hpp"
+#include "graph_exception.hpp"
+#include "throw.hpp"
+
+namespace g::dimacs {
+MaxFlowProblem::MaxFlowProblem(
+  max_flow_graph_type graph,
+  VertexIdentifier    source,
+  VertexIdentifier    sink)
+  : m_graph{std::move(graph)}, m_source{source}, m_sink{sink}
+{
+}
+
+const max_flow_graph_type& MaxFlowProblem::graph() const { return m_graph; }
+
+VertexIdentifier MaxFlowProblem::source() const { return m_source; }
+
+VertexIdentifier MaxFlowProblem::sink() const { return m_sink; }
+
+MaxFlowProblem readMaxFlowProblem(std::istream& is)
+{
+  max_flow_graph_type             graph{};
+  std::optional<VertexIdentifier> source{std::nullopt};
+  std::optional<VertexIdentifier> sink{std::nullopt};
+  bool                            hasProblemLine{false};
+  std::size_t                     lineNumber{0};
+  std::string                     line{};
+
+  while (std::getline(is, line)) {
+    ++lineNumber;
+
+    if (line.empty() || line.front() == 'c') { continue; }
+
+    switch (line.front()) {
+    case 'p': {
+      char        problemType[8]{};
+      std::size_t vertexCount{};
+      std::size_t arcCount{};
+
+      if (
+        std::sscanf(
+          line.c_str(), "p %7s %zu %zu", problemType, &vertexCount, &arcCount)
+          != 3
+        || std::string{problemType} != "max") {
+        G_THROW(
+          GraphException, "Invalid problem line %zu: %s", lineNumber, line.c_str());
+      }
+
+      for (VertexIdentifier v{1}; v <= vertexCount; ++v) {
+        G_ASSERT(graph.addVertex(v, nullptr), "Couldn't add vertex %zu.", v);
+      }
+
+      hasProblemLine = true;
+      break;
+    }
+    case 'n': {
+      VertexIdentifier vertex{};
+      char             kind{};
+
+      if (std::sscanf(line.c_str(), "n %zu %c", &vertex, &kind) != 2) {
+        G_THROW(
+          GraphException, "Invalid node line %zu: %s", lineNumber, line.c_str());
+      }
+
+      if (kind == 's') { source = vertex; }
+      else if (kind == 't') {
+        sink = vertex;
+      }
+      else {
+        G_THROW(
+          GraphException,
+          "Invalid node designator '%c' in line %zu.",
+          kind,
+          lineNumber);
+      }
+
+      break;
+    }
+    case 'a': {
+      VertexIdentifier arcSource{};
+      VertexIdentifier arcTarget{};
+      std::int32_t     capacity{};
+
+      if (
+        !hasProblemLine
+        || std::sscanf(
+             line.c_str(),
+             "a %zu %zu %" SCNd32,
+             &arcSource,
+             &arcTarget,
+             &capacity)
+             != 3) {
+        G_THROW(
+          GraphException, "Invalid arc line %zu: %s", lineNumber, line.c_str());
+      }
+
+      if (const auto it{graph.fetchEdgeIterator(arcSource, arcTarget)};
+          graph.isEdgeIteratorValid(it)) {
+        it->second += capacity;
+      }
+      else if (!graph.addEdge(arcSource, arcTarget, capacity)) {
+        G_THROW(
+          GraphException,
+          "Arc in line %zu refers to an unknown vertex.",
+          lineNumber);
+      }
+
+      break;
+    }
+    default:
+      G_THROW(
+        GraphException, "Invalid line %zu: %s", lineNumber, line.c_str());
+    }
+  }
+
+  if (!source.has_value() || !sink.has_value()) {
+    G_THROW(GraphException, "%s", "The source or the sink was not given.");
+  }
+
+  return MaxFlowProblem{std::move(graph), *source, *sink};
+}
+} // namespace g::dimacs
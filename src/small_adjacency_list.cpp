@@ -0,0 +1,196 @@
+#include <cstdint>
+
+#include <algorithm>
+#include <bit>
+#include <ostream>
+
+#include "assert.hpp"
+#include "small_adjacency_list.hpp"
+
+namespace g {
+std::ostream& operator<<(std::ostream& os, const SmallAdjacencyList& l)
+{
+  os << "SmallAdjacencyList:\n";
+
+  for (std::size_t i{0}; i < l.m_rows.size(); ++i) {
+    os << i << ": ";
+
+    for (const auto& e : l.neighbors(i)) { os << e << ' '; }
+
+    os << '\n';
+  }
+
+  return os;
+}
+
+SmallAdjacencyList::SmallAdjacencyList()
+  : m_rows{}, m_slab{}, m_freeBlocks{}
+{
+}
+
+bool SmallAdjacencyList::isDirectlyReachable(
+  VertexIdentifier source,
+  VertexIdentifier target) const
+{
+  const std::span<const VertexIdentifier> list{neighbors(source)};
+  return std::find(list.begin(), list.end(), target) != list.end();
+}
+
+void SmallAdjacencyList::addTo(
+  VertexIdentifier source,
+  VertexIdentifier target)
+{
+  if (isDirectlyReachable(source, target)) { return; }
+
+  if (source >= m_rows.size()) {
+    m_rows.resize(source + 1, Row{0, inlineCapacity, {}});
+  }
+
+  Row& row{m_rows[source]};
+
+  if (row.size == row.capacity) { grow(row); }
+
+  dataOf(row)[row.size] = target;
+  ++row.size;
+}
+
+std::vector<VertexIdentifier> SmallAdjacencyList::directlyReachables(
+  VertexIdentifier source) const
+{
+  const std::span<const VertexIdentifier> list{neighbors(source)};
+  return std::vector<VertexIdentifier>(list.begin(), list.end());
+}
+
+std::span<const VertexIdentifier> SmallAdjacencyList::neighbors(
+  VertexIdentifier source) const
+{
+  if (source >= m_rows.size()) { return {}; }
+
+  const Row& row{m_rows[source]};
+  return {dataOf(row), row.size};
+}
+
+void SmallAdjacencyList::removeAdjacentFrom(
+  VertexIdentifier source,
+  VertexIdentifier target)
+{
+  if (source >= m_rows.size()) { return; }
+
+  Row&              row{m_rows[source]};
+  VertexIdentifier* begin{dataOf(row)};
+  VertexIdentifier* end{begin + row.size};
+
+  if (VertexIdentifier* it{std::find(begin, end, target)}; it != end) {
+    std::copy(it + 1, end, it);
+    --row.size;
+  }
+}
+
+void SmallAdjacencyList::removeVertex(VertexIdentifier toRemove)
+{
+  if (toRemove < m_rows.size()) { release(m_rows[toRemove]); }
+
+  for (std::size_t row{0}; row < m_rows.size(); ++row) {
+    removeAdjacentFrom(VertexIdentifier{row}, toRemove);
+  }
+}
+
+void SmallAdjacencyList::clear()
+{
+  m_rows.clear();
+  m_slab.clear();
+  m_freeBlocks.clear();
+}
+
+void SmallAdjacencyList::swap(this_type& other) noexcept
+{
+  m_rows.swap(other.m_rows);
+  m_slab.swap(other.m_slab);
+  m_freeBlocks.swap(other.m_freeBlocks);
+}
+
+std::size_t SmallAdjacencyList::slabSize() const noexcept
+{
+  return m_slab.size();
+}
+
+bool SmallAdjacencyList::isSpilled(const Row& row) noexcept
+{
+  return row.capacity > inlineCapacity;
+}
+
+std::size_t SmallAdjacencyList::sizeClassOf(std::size_t capacity) noexcept
+{
+  return static_cast<std::size_t>(
+    std::countr_zero(capacity) - std::countr_zero(inlineCapacity * 2));
+}
+
+VertexIdentifier* SmallAdjacencyList::dataOf(Row& row)
+{
+  if (isSpilled(row)) { return m_slab.data() + row.offset; }
+
+  return row.local.data();
+}
+
+const VertexIdentifier* SmallAdjacencyList::dataOf(const Row& row) const
+{
+  return const_cast<this_type*>(this)->dataOf(const_cast<Row&>(row));
+}
+
+std::size_t SmallAdjacencyList::allocate(std::size_t capacity)
+{
+  if (const std::size_t sizeClass{sizeClassOf(capacity)};
+      sizeClass < m_freeBlocks.size() && !m_freeBlocks[sizeClass].empty()) {
+    const std::size_t offset{m_freeBlocks[sizeClass].back()};
+    m_freeBlocks[sizeClass].pop_back();
+    return offset;
+  }
+
+  const std::size_t offset{m_slab.size()};
+  m_slab.resize(offset + capacity);
+  return offset;
+}
+
+void SmallAdjacencyList::release(Row& row)
+{
+  if (isSpilled(row)) {
+    const std::size_t sizeClass{sizeClassOf(row.capacity)};
+
+    if (sizeClass >= m_freeBlocks.size()) {
+      m_freeBlocks.resize(sizeClass + 1);
+    }
+
+    m_freeBlocks[sizeClass].push_back(row.offset);
+  }
+
+  row.size     = 0;
+  row.capacity = inlineCapacity;
+}
+
+void SmallAdjacencyList::grow(Row& row)
+{
+  const std::size_t capacity{std::size_t{row.capacity} * 2};
+
+  G_ASSERT(
+    capacity <= UINT32_MAX,
+    "capacity: %zu, size: %zu",
+    capacity,
+    std::size_t{row.size});
+
+  // Allocating may move the slab, so the targets are located afterwards.
+  const std::size_t       offset{allocate(capacity)};
+  const VertexIdentifier* begin{dataOf(row)};
+  std::copy(begin, begin + row.size, m_slab.data() + offset);
+
+  const std::uint32_t size{row.size};
+  release(row);
+  row.size     = size;
+  row.capacity = static_cast<std::uint32_t>(capacity);
+  row.offset   = offset;
+}
+
+void swap(SmallAdjacencyList& lhs, SmallAdjacencyList& rhs) noexcept
+{
+  lhs.swap(rhs);
+}
+} // namespace g
@@ -0,0 +1,209 @@
+#include <algorithm>
+#include <iterator>
+#include <ostream>
+#include <utility>
+
+#include "sorted_adjacency_list.hpp"
+
+namespace g {
+namespace {
+/*!
+ * \brief Gallop instead of merging if the longer range is at least this many
+ *        times as long as the shorter one.
+ **/
+constexpr std::size_t gallopRatio{32};
+
+/*!
+ * \brief Calls `callback` with every element that `lhs` and `rhs` have in
+ *        common, in ascending order.
+ **/
+template<typename Callback>
+void forEachCommon(
+  std::span<const VertexIdentifier> lhs,
+  std::span<const VertexIdentifier> rhs,
+  Callback                          callback)
+{
+  if (lhs.size() > rhs.size()) { std::swap(lhs, rhs); }
+
+  if (lhs.empty()) { return; }
+
+  if (rhs.size() / lhs.size() < gallopRatio) {
+    std::size_t i{0};
+    std::size_t j{0};
+
+    while (i < lhs.size() && j < rhs.size()) {
+      if (lhs[i] < rhs[j]) { ++i; }
+      else if (rhs[j] < lhs[i]) { ++j; }
+      else {
+        callback(lhs[i]);
+        ++i;
+        ++j;
+      }
+    }
+
+    return;
+  }
+
+  // Every element of rhs before `low` is less than the current value.
+  std::size_t low{0};
+
+  for (VertexIdentifier value : lhs) {
+    std::size_t high{low};
+
+    for (std::size_t step{1}; high < rhs.size() && rhs[high] < value;
+         step *= 2) {
+      low = high + 1;
+      high += step;
+    }
+
+    const std::size_t end{std::min(high + 1, rhs.size())};
+    low = static_cast<std::size_t>(
+      std::lower_bound(
+        rhs.begin() + static_cast<std::ptrdiff_t>(low),
+        rhs.begin() + static_cast<std::ptrdiff_t>(end),
+        value)
+      - rhs.begin());
+
+    if (low == rhs.size()) { return; }
+
+    if (rhs[low] == value) {
+      callback(value);
+      ++low;
+    }
+  }
+}
+} // anonymous namespace
+
+std::ostream& operator<<(std::ostream& os, const SortedAdjacencyList& l)
+{
+  os << "SortedAdjacencyList:\n";
+
+  for (std::size_t i{0}; i < l.m_data.size(); ++i) {
+    os << i << ": ";
+
+    for (const auto& e : l.m_data[i]) { os << e << ' '; }
+
+    os << '\n';
+  }
+
+  return os;
+}
+
+SortedAdjacencyList::SortedAdjacencyList() : m_data{} {}
+
+bool SortedAdjacencyList::isDirectlyReachable(
+  VertexIdentifier source,
+  VertexIdentifier target) const
+{
+  const std::span<const VertexIdentifier> list{neighbors(source)};
+  return std::binary_search(list.begin(), list.end(), target);
+}
+
+void SortedAdjacencyList::addTo(
+  VertexIdentifier source,
+  VertexIdentifier target)
+{
+  std::vector<VertexIdentifier>& list{fetchList(source)};
+
+  if (const auto it{std::lower_bound(list.begin(), list.end(), target)};
+      it == list.end() || *it != target) {
+    list.insert(it, target);
+  }
+}
+
+void SortedAdjacencyList::addAllTo(
+  VertexIdentifier              source,
+  std::vector<VertexIdentifier> targets)
+{
+  std::sort(targets.begin(), targets.end());
+  targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+
+  std::vector<VertexIdentifier>& list{fetchList(source)};
+  std::vector<VertexIdentifier>  merged{};
+  merged.reserve(list.size() + targets.size());
+  std::set_union(
+    list.begin(),
+    list.end(),
+    targets.begin(),
+    targets.end(),
+    std::back_inserter(merged));
+  list.swap(merged);
+}
+
+std::vector<VertexIdentifier> SortedAdjacencyList::directlyReachables(
+  VertexIdentifier source) const
+{
+  const std::span<const VertexIdentifier> list{neighbors(source)};
+  return std::vector<VertexIdentifier>(list.begin(), list.end());
+}
+
+std::span<const VertexIdentifier> SortedAdjacencyList::neighbors(
+  VertexIdentifier source) const
+{
+  if (source >= m_data.size()) { return {}; }
+
+  return m_data[source];
+}
+
+void SortedAdjacencyList::removeAdjacentFrom(
+  VertexIdentifier source,
+  VertexIdentifier target)
+{
+  if (source >= m_data.size()) { return; }
+
+  std::vector<VertexIdentifier>& list{m_data[source]};
+
+  if (const auto it{std::lower_bound(list.begin(), list.end(), target)};
+      it != list.end() && *it == target) {
+    list.erase(it);
+  }
+}
+
+void SortedAdjacencyList::removeVertex(VertexIdentifier toRemove)
+{
+  if (toRemove < m_data.size()) { m_data[toRemove].clear(); }
+
+  for (std::size_t row{0}; row < m_data.size(); ++row) {
+    removeAdjacentFrom(VertexIdentifier{row}, toRemove);
+  }
+}
+
+void SortedAdjacencyList::clear() { m_data.clear(); }
+
+void SortedAdjacencyList::swap(this_type& other) noexcept
+{
+  m_data.swap(other.m_data);
+}
+
+std::vector<VertexIdentifier>& SortedAdjacencyList::fetchList(
+  VertexIdentifier source)
+{
+  if (source >= m_data.size()) { m_data.resize(source + 1); }
+
+  return m_data[source];
+}
+
+void swap(SortedAdjacencyList& lhs, SortedAdjacencyList& rhs) noexcept
+{
+  lhs.swap(rhs);
+}
+
+std::vector<VertexIdentifier> intersect(
+  std::span<const VertexIdentifier> lhs,
+  std::span<const VertexIdentifier> rhs)
+{
+  std::vector<VertexIdentifier> result{};
+  forEachCommon(
+    lhs, rhs, [&result](VertexIdentifier value) { result.push_back(value); });
+  return result;
+}
+
+std::size_t intersectionSize(
+  std::span<const VertexIdentifier> lhs,
+  std::span<const VertexIdentifier> rhs)
+{
+  std::size_t count{0};
+  forEachCommon(lhs, rhs, [&count](VertexIdentifier) { ++count; });
+  return count;
+}
+} // namespace g
@@ -0,0 +1,205 @@
+#include <cstdint>
+
+#include <random>
+#include <vector>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "algo/boykov_kolmogorov/algorithm.hpp"
+#include "algo/push_relabel/algorithm.hpp"
+#include "graph_exception.hpp"
+
+namespace {
+using g::algo::boykov_kolmogorov::Connectivity;
+using g::algo::boykov_kolmogorov::GridGraph;
+using g::algo::boykov_kolmogorov::Neighbor;
+using g::algo::boykov_kolmogorov::Segment;
+
+/*!
+ * A grid with random capacities that is also built as a `Graph`, whose
+ * source is width * height and whose sink is width * height + 1.
+ **/
+struct RandomGrid {
+  RandomGrid(
+    std::mt19937& engine,
+    std::size_t   width,
+    std::size_t   height,
+    Connectivity  connectivity)
+    : grid{width, height, connectivity}
+    , graph{}
+    , sourceCapacity{}
+    , sinkCapacity{}
+    , edges{}
+    , edgeCapacity{}
+  {
+    std::uniform_int_distribution<std::int32_t> capacity{0, 9};
+    const g::VertexIdentifier source{width * height};
+    const g::VertexIdentifier sink{source + 1};
+
+    for (g::VertexIdentifier v{0}; v <= sink; ++v) {
+      G_ASSERT(graph.addVertex(v, nullptr), "Couldn't add %zu.", v);
+    }
+
+    for (std::size_t y{0}; y < height; ++y) {
+      for (std::size_t x{0}; x < width; ++x) {
+        const g::VertexIdentifier pixel{y * width + x};
+        const std::int32_t        fromSource{capacity(engine)};
+        const std::int32_t        toSink{capacity(engine)};
+        grid.addTerminalCapacities(x, y, fromSource, toSink);
+        sourceCapacity.push_back(fromSource);
+        sinkCapacity.push_back(toSink);
+        G_ASSERT(graph.addEdge(source, pixel, fromSource), "%zu", pixel);
+        G_ASSERT(graph.addEdge(pixel, sink, toSink), "%zu", pixel);
+
+        for (const Neighbor neighbor :
+             {Neighbor::East,
+              Neighbor::SouthEast,
+              Neighbor::South,
+              Neighbor::SouthWest,
+              Neighbor::West,
+              Neighbor::NorthWest,
+              Neighbor::North,
+              Neighbor::NorthEast}) {
+          const auto value{static_cast<int>(neighbor)};
+          const int  dx[]{1, 1, 0, -1, -1, -1, 0, 1};
+          const int  dy[]{0, 1, 1, 1, 0, -1, -1, -1};
+          const auto nx{static_cast<long>(x) + dx[value]};
+          const auto ny{static_cast<long>(y) + dy[value]};
+
+          if (
+            (connectivity == Connectivity::Four && (value % 2) != 0) || nx < 0
+            || ny < 0 || nx >= static_cast<long>(width)
+            || ny >= static_cast<long>(height)) {
+            continue;
+          }
+
+          const std::int32_t c{capacity(engine)};
+          grid.setEdgeCapacity(x, y, neighbor, c);
+          edges.push_back(
+            {pixel, static_cast<std::size_t>(ny) * width
+                      + static_cast<std::size_t>(nx)});
+          edgeCapacity.push_back(c);
+          G_ASSERT(
+            graph.addEdge(edges.back().source(), edges.back().target(), c),
+            "%zu",
+            pixel);
+        }
+      }
+    }
+  }
+
+  GridGraph grid;
+  g::Graph<
+    g::Directionality::Directed,
+    g::AdjacencyList,
+    std::nullptr_t,
+    std::int32_t>
+                            graph;
+  std::vector<std::int64_t> sourceCapacity;
+  std::vector<std::int64_t> sinkCapacity;
+  std::vector<g::Edge>      edges;
+  std::vector<std::int64_t> edgeCapacity;
+};
+
+std::int64_t cutCapacity(
+  const RandomGrid&                            grid,
+  const g::algo::boykov_kolmogorov::Result& result)
+{
+  const std::vector<Segment>& segments{result.segments()};
+  std::int64_t                capacity{0};
+
+  for (std::size_t pixel{0}; pixel < segments.size(); ++pixel) {
+    capacity += segments[pixel] == Segment::Source ? grid.sinkCapacity[pixel]
+                                                   : grid.sourceCapacity[pixel];
+  }
+
+  for (std::size_t i{0}; i < grid.edges.size(); ++i) {
+    if (
+      segments[grid.edges[i].source()] == Segment::Source
+      && segments[grid.edges[i].target()] == Segment::Sink) {
+      capacity += grid.edgeCapacity[i];
+    }
+  }
+
+  return capacity;
+}
+} // anonymous namespace
+
+TEST_CASE("Boykov-Kolmogorov should cut a small grid")
+{
+  GridGraph grid{3, 1, Connectivity::Four};
+  grid.addTerminalCapacities(0, 0, 5, 0);
+  grid.addTerminalCapacities(2, 0, 0, 5);
+  grid.addTerminalCapacities(1, 0, 2, 1);
+  grid.setEdgeCapacity(0, 0, Neighbor::East, 4);
+  grid.setEdgeCapacity(1, 0, Neighbor::East, 3);
+
+  const g::algo::boykov_kolmogorov::Result result{
+    g::algo::boykov_kolmogorov::algorithm(grid)};
+
+  CHECK_EQ(4, result.maxFlow());
+  CHECK_EQ(Segment::Source, result.segmentOf(0, 0));
+  CHECK_EQ(Segment::Source, result.segmentOf(1, 0));
+  CHECK_EQ(Segment::Sink, result.segmentOf(2, 0));
+}
+
+TEST_CASE("Boykov-Kolmogorov should add terminal capacities up")
+{
+  GridGraph split{1, 1, Connectivity::Four};
+  split.addTerminalCapacities(0, 0, 5, 0);
+  split.addTerminalCapacities(0, 0, 0, 5);
+
+  GridGraph single{1, 1, Connectivity::Four};
+  single.addTerminalCapacities(0, 0, 5, 5);
+
+  CHECK_EQ(5, g::algo::boykov_kolmogorov::algorithm(split).maxFlow());
+  CHECK_EQ(5, g::algo::boykov_kolmogorov::algorithm(single).maxFlow());
+
+  // Leaves 3 of source capacity, then 1 of sink capacity.
+  GridGraph three{1, 1, Connectivity::Four};
+  three.addTerminalCapacities(0, 0, 4, 1);
+  three.addTerminalCapacities(0, 0, 0, 2);
+  three.addTerminalCapacities(0, 0, 1, 5);
+
+  const g::algo::boykov_kolmogorov::Result result{
+    g::algo::boykov_kolmogorov::algorithm(three)};
+  CHECK_EQ(5, result.maxFlow());
+  CHECK_EQ(Segment::Sink, result.segmentOf(0, 0));
+}
+
+TEST_CASE("Boykov-Kolmogorov should reject invalid capacities")
+{
+  GridGraph four{2, 2, Connectivity::Four};
+  CHECK_THROWS_AS(
+    four.setEdgeCapacity(0, 0, Neighbor::SouthEast, 1), g::GraphException);
+  CHECK_THROWS_AS(
+    four.setEdgeCapacity(0, 0, Neighbor::West, 1), g::GraphException);
+  CHECK_THROWS_AS(
+    four.setEdgeCapacity(0, 0, Neighbor::East, -1), g::GraphException);
+  CHECK_THROWS_AS(four.addTerminalCapacities(2, 0, 1, 1), g::GraphException);
+
+  GridGraph eight{2, 2, Connectivity::Eight};
+  CHECK_NOTHROW(eight.setEdgeCapacity(0, 0, Neighbor::SouthEast, 1));
+  CHECK_THROWS_AS(
+    eight.setEdgeCapacity(1, 0, Neighbor::NorthEast, 1), g::GraphException);
+}
+
+TEST_CASE("Boykov-Kolmogorov should agree with push-relabel on random grids")
+{
+  std::mt19937 engine{2718}; // NOLINT
+
+  for (int i{0}; i < 20; ++i) {
+    for (const Connectivity connectivity :
+         {Connectivity::Four, Connectivity::Eight}) {
+      const RandomGrid grid{engine, 7, 5, connectivity};
+      const g::algo::boykov_kolmogorov::Result result{
+        g::algo::boykov_kolmogorov::algorithm(grid.grid)};
+
+      REQUIRE_EQ(
+        g::algo::push_relabel::algorithm(grid.graph, 35, 36).maxFlow(),
+        result.maxFlow());
+      REQUIRE_EQ(result.maxFlow(), cutCapacity(grid, result));
+    }
+  }
+}
@@ -0,0 +1,59 @@
+#include <cstddef>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "algo/condensation.hpp"
+
+TEST_CASE("condensation should number components in reverse topological order")
+{
+  g::Graph<
+    g::Directionality::Directed,
+    g::AdjacencyList,
+    std::nullptr_t,
+    std::nullptr_t>
+    graph{};
+
+  for (g::VertexIdentifier v{0}; v < 6; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  // {0, 1} -> {2, 3} -> 4, with two arcs from {0, 1} to {2, 3}.
+  REQUIRE_UNARY(graph.addEdge(0, 1, nullptr));
+  REQUIRE_UNARY(graph.addEdge(1, 0, nullptr));
+  REQUIRE_UNARY(graph.addEdge(0, 2, nullptr));
+  REQUIRE_UNARY(graph.addEdge(1, 3, nullptr));
+  REQUIRE_UNARY(graph.addEdge(2, 3, nullptr));
+  REQUIRE_UNARY(graph.addEdge(3, 2, nullptr));
+  REQUIRE_UNARY(graph.addEdge(3, 4, nullptr));
+  REQUIRE_UNARY(graph.addEdge(4, 4, nullptr));
+
+  const g::algo::IndexedAdjacency adjacency{
+    g::algo::makeIndexedAdjacency(graph)};
+  const g::algo::Condensation condensation{adjacency};
+  const auto                  componentOf{[&](g::VertexIdentifier v) {
+    return condensation.componentOf(adjacency.vertexIndex().indexOf(v));
+  }};
+
+  REQUIRE_EQ(4, condensation.componentCount());
+  CHECK_EQ(componentOf(0), componentOf(1));
+  CHECK_EQ(componentOf(2), componentOf(3));
+  CHECK_UNARY(componentOf(0) > componentOf(2));
+  CHECK_UNARY(componentOf(2) > componentOf(4));
+
+  // One arc per pair of components and none for the loop.
+  CHECK_EQ(2, condensation.arcCount());
+
+  for (std::size_t c{0}; c < condensation.componentCount(); ++c) {
+    for (std::size_t arc{condensation.firstArc(c)};
+         arc < condensation.lastArc(c);
+         ++arc) {
+      CHECK_UNARY(condensation.target(arc) < c);
+    }
+  }
+
+  CHECK_EQ(
+    0,
+    condensation.lastArc(componentOf(5))
+      - condensation.firstArc(componentOf(5)));
+}
@@ -1,11 +1,109 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <random>
+#include <vector>
+
 #include <doctest.h>
 
 #include "adjacency_list.hpp"
 #include "adjacency_matrix.hpp"
 #include "algo/dijkstra/algorithm.hpp"
 #include "algo/shortest_paths.hpp"
+#include "graph_exception.hpp"
 #include "nm/create_graph.hpp"
 #include "romania/create_graph.hpp"
+#include "weighted_adjacency_matrix.hpp"
+
+namespace {
+/*!
+ * \brief Fills `graph` with a fixed random dense graph.
+ **/
+template<typename Graph>
+void addRandomDenseGraph(Graph& graph)
+{
+  std::mt19937                                engine{1234};
+  std::uniform_int_distribution<std::int64_t> weight{0, 100};
+  std::bernoulli_distribution                 isEdge{0.4};
+
+  for (g::VertexIdentifier v{0}; v < 150; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  // Has no edges, so it lies beyond the matrix.
+  REQUIRE_UNARY(graph.addVertex(500, nullptr));
+
+  for (g::VertexIdentifier v{0}; v < 150; ++v) {
+    for (g::VertexIdentifier w{0}; w < 150; ++w) {
+      if (isEdge(engine)) {
+        REQUIRE_UNARY(graph.addEdge(v, w, weight(engine)));
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Checks that dijkstra rejects a negative weight that is reachable
+ *        from the source but ignores one that is not.
+ **/
+template<typename Implementation>
+void checkRejectsNegativeWeights()
+{
+  g::Graph<
+    g::Directionality::Directed,
+    Implementation,
+    std::nullptr_t,
+    std::int64_t>
+    graph{};
+
+  for (g::VertexIdentifier v{0}; v < 4; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(0, 1, 4));
+  REQUIRE_UNARY(graph.addEdge(1, 2, -1));
+  REQUIRE_UNARY(graph.addEdge(3, 0, 1));
+
+  CHECK_THROWS_AS(
+    (void)g::algo::dijkstra::algorithm(graph, 0), g::GraphException);
+
+  const g::algo::ShortestPaths result{g::algo::dijkstra::algorithm(graph, 2)};
+  CHECK_EQ(0, result.distanceTo(2));
+  CHECK_EQ(INT64_MAX, result.distanceTo(0));
+  CHECK_UNARY(result.shortestPathTo(1).empty());
+}
+
+/*!
+ * \brief Checks that dijkstra leaves a vertex unreachable rather than
+ *        wrapping around if its shortest path does not fit in 64 bits.
+ **/
+template<typename Implementation>
+void checkHugeWeights()
+{
+  g::Graph<
+    g::Directionality::Directed,
+    Implementation,
+    std::nullptr_t,
+    std::int64_t>
+    graph{};
+
+  for (g::VertexIdentifier v{0}; v < 5; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(0, 1, INT64_MAX - 5));
+  REQUIRE_UNARY(graph.addEdge(1, 2, 10));
+  REQUIRE_UNARY(graph.addEdge(1, 3, 4));
+  REQUIRE_UNARY(graph.addEdge(0, 4, INT64_MAX - 1));
+
+  const g::algo::ShortestPaths result{g::algo::dijkstra::algorithm(graph, 0)};
+  CHECK_EQ(INT64_MAX - 5, result.distanceTo(1));
+  CHECK_EQ(INT64_MAX, result.distanceTo(2));
+  CHECK_UNARY(result.shortestPathTo(2).empty());
+  CHECK_EQ(INT64_MAX - 1, result.distanceTo(3));
+  CHECK_EQ(INT64_MAX - 1, result.distanceTo(4));
+}
+} // anonymous namespace
 
 TEST_CASE("dijkstra should work for Romania")
 {
@@ -247,3 +345,66 @@ TEST_CASE("dijkstra should work for a non monotonic graph")
   CHECK_EQ(result.shortestPathTo(5), fiveExpectedPath);
   CHECK_EQ(result.shortestPathTo(6), sixExpectedPath);
 }
+
+TEST_CASE("dense dijkstra should work for a non monotonic graph")
+{
+  const g::nm::graph_type<g::AdjacencyMatrix> graph{
+    g::nm::createGraph<g::AdjacencyMatrix>()};
+  const g::nm::graph_type<g::WeightedAdjacencyMatrix<std::int64_t>>
+    weightedGraph{
+      g::nm::createGraph<g::WeightedAdjacencyMatrix<std::int64_t>>()};
+
+  for (const g::algo::ShortestPaths& result :
+       {g::algo::dijkstra::algorithm(graph, 1),
+        g::algo::dijkstra::algorithm(weightedGraph, 1)}) {
+    CHECK_EQ(result.distanceTo(1), 0);
+    CHECK_EQ(result.distanceTo(2), 5);
+    CHECK_EQ(result.distanceTo(6), 20);
+    CHECK_EQ(
+      result.shortestPathTo(6),
+      (std::vector<g::VertexIdentifier>{1, 3, 4, 5, 6}));
+  }
+}
+
+TEST_CASE("dense dijkstra should agree with the list based version")
+{
+  using Graph = g::Graph<
+    g::Directionality::Directed,
+    g::AdjacencyList,
+    std::nullptr_t,
+    std::int64_t>;
+  using MatrixGraph = g::Graph<
+    g::Directionality::Directed,
+    g::WeightedAdjacencyMatrix<std::int64_t>,
+    std::nullptr_t,
+    std::int64_t>;
+
+  Graph       graph{};
+  MatrixGraph matrixGraph{};
+  addRandomDenseGraph(graph);
+  addRandomDenseGraph(matrixGraph);
+
+  const g::algo::ShortestPaths expected{g::algo::dijkstra::algorithm(graph, 7)};
+  const g::algo::ShortestPaths actual{
+    g::algo::dijkstra::algorithm(matrixGraph, 7)};
+
+  for (g::VertexIdentifier v : graph.vertices()) {
+    REQUIRE_EQ(expected.distanceTo(v), actual.distanceTo(v));
+  }
+
+  CHECK_EQ(INT64_MAX, actual.distanceTo(500));
+  CHECK_UNARY(actual.shortestPathTo(500).empty());
+}
+
+TEST_CASE("dijkstra should reject negative weights for every implementation")
+{
+  checkRejectsNegativeWeights<g::AdjacencyList>();
+  checkRejectsNegativeWeights<g::AdjacencyMatrix>();
+}
+
+TEST_CASE("dijkstra should not overflow for huge weights")
+{
+  checkHugeWeights<g::AdjacencyList>();
+  checkHugeWeights<g::AdjacencyMatrix>();
+  checkHugeWeights<g::WeightedAdjacencyMatrix<std::int64_t>>();
+}
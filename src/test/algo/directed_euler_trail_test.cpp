@@ -0,0 +1,239 @@
+#include <cstdint>
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "algo/directed_euler_trail/algorithm.hpp"
+#include "graph_exception.hpp"
+
+namespace {
+using VertexPair = std::pair<g::VertexIdentifier, g::VertexIdentifier>;
+using Multiset   = std::map<VertexPair, std::uint32_t>;
+
+/*!
+ * \brief Checks that `trail` walks along every edge of `edges` exactly once.
+ **/
+bool usesEveryEdgeOnce(
+  Multiset                                edges,
+  const std::vector<g::VertexIdentifier>& trail)
+{
+  for (std::size_t i{1}; i < trail.size(); ++i) {
+    const auto it{edges.find({trail[i - 1], trail[i]})};
+
+    if (it == edges.end() || it->second == 0) { return false; }
+
+    --it->second;
+  }
+
+  return std::all_of(edges.begin(), edges.end(), [](const auto& entry) {
+    return entry.second == 0;
+  });
+}
+
+/*!
+ * \brief Checks that the parallel overload finds a valid Euler trail with
+ *        the same ends as the sequential one.
+ **/
+void checkParallelTrail(
+  const g::algo::directed_euler_trail::Multigraph& multigraph,
+  const Multiset&                                  edges)
+{
+  const std::vector<g::VertexIdentifier> sequential{
+    g::algo::directed_euler_trail::algorithm(multigraph)};
+  REQUIRE_UNARY(usesEveryEdgeOnce(edges, sequential));
+
+  for (std::size_t threadCount{1}; threadCount <= 4; ++threadCount) {
+    const std::vector<g::VertexIdentifier> parallel{
+      g::algo::directed_euler_trail::algorithm(multigraph, threadCount)};
+
+    REQUIRE_EQ(sequential.size(), parallel.size());
+    CHECK_EQ(sequential.front(), parallel.front());
+    CHECK_EQ(sequential.back(), parallel.back());
+    CHECK_UNARY(usesEveryEdgeOnce(edges, parallel));
+  }
+}
+} // namespace
+
+TEST_CASE("multigraph should merge parallel edges into one arc")
+{
+  const g::algo::directed_euler_trail::Multigraph multigraph{
+    g::algo::VertexIndex{{4, 5, 6}},
+    {g::Edge{4, 5}, g::Edge{5, 6}, g::Edge{4, 5}, g::Edge{4, 6}},
+    {2, 1, 3, 1}};
+
+  REQUIRE_EQ(3, multigraph.vertexCount());
+  CHECK_EQ(7, multigraph.edgeCount());
+  CHECK_EQ(3, multigraph.arcCount());
+  CHECK_EQ(0, multigraph.firstArc(0));
+  CHECK_EQ(2, multigraph.lastArc(0));
+  CHECK_EQ(1, multigraph.target(0));
+  CHECK_EQ(5, multigraph.multiplicity(0));
+  CHECK_EQ(2, multigraph.target(1));
+  CHECK_EQ(1, multigraph.multiplicity(1));
+  CHECK_EQ(multigraph.lastArc(2), multigraph.firstArc(2));
+}
+
+TEST_CASE("directed Euler trail should traverse a de Bruijn graph")
+{
+  // B(2, 4): the vertices are the binary 3-mers and every 4-mer is an edge.
+  std::vector<g::VertexIdentifier> vertices{};
+  std::vector<g::Edge>             edges{};
+  Multiset                         expected{};
+
+  for (g::VertexIdentifier v{0}; v < 8; ++v) { vertices.push_back(v); }
+
+  for (g::VertexIdentifier word{0}; word < 16; ++word) {
+    edges.emplace_back(word >> 1, word & 7);
+    ++expected[{word >> 1, word & 7}];
+  }
+
+  const g::algo::directed_euler_trail::Multigraph multigraph{
+    g::algo::VertexIndex{vertices}, edges};
+  const std::vector<g::VertexIdentifier> trail{
+    g::algo::directed_euler_trail::algorithm(multigraph)};
+
+  REQUIRE_EQ(17, trail.size());
+  CHECK_EQ(trail.front(), trail.back());
+  CHECK_UNARY(usesEveryEdgeOnce(expected, trail));
+}
+
+TEST_CASE("directed Euler trail should use every parallel edge")
+{
+  const g::algo::directed_euler_trail::Multigraph multigraph{
+    g::algo::VertexIndex{{1, 2, 3}},
+    {g::Edge{1, 2}, g::Edge{2, 1}, g::Edge{2, 3}, g::Edge{3, 3}},
+    {3, 2, 1, 1000}};
+  const std::vector<g::VertexIdentifier> trail{
+    g::algo::directed_euler_trail::algorithm(multigraph)};
+
+  REQUIRE_EQ(1007, trail.size());
+  CHECK_EQ(1, trail.front());
+  CHECK_EQ(3, trail.back());
+  CHECK_UNARY(usesEveryEdgeOnce(
+    {{{1, 2}, 3}, {{2, 1}, 2}, {{2, 3}, 1}, {{3, 3}, 1000}}, trail));
+}
+
+TEST_CASE("directed Euler trail should write to a caller provided buffer")
+{
+  const g::algo::directed_euler_trail::Multigraph multigraph{
+    g::algo::VertexIndex{{0, 1}}, {g::Edge{0, 1}, g::Edge{1, 0}}, {2, 2}};
+  std::vector<std::uint32_t> buffer(5, UINT32_MAX);
+
+  g::algo::directed_euler_trail::writeEulerTrail(multigraph, buffer);
+
+  CHECK_EQ((std::vector<std::uint32_t>{0, 1, 0, 1, 0}), buffer);
+
+  std::vector<std::uint32_t> tooSmall(4);
+  CHECK_THROWS_AS(
+    g::algo::directed_euler_trail::writeEulerTrail(multigraph, tooSmall),
+    g::GraphException);
+}
+
+TEST_CASE("parallel directed Euler trail should find a valid trail")
+{
+  std::mt19937                                       engine{5489U};
+  std::uniform_int_distribution<g::VertexIdentifier> vertices{0, 199};
+
+  std::vector<g::VertexIdentifier> identifiers{};
+
+  for (g::VertexIdentifier v{0}; v < 200; ++v) { identifiers.push_back(v); }
+
+  // A random closed walk, which is an Euler circuit of its edges.
+  std::vector<g::VertexIdentifier> walk{vertices(engine)};
+
+  for (std::size_t i{0}; i < 5'000; ++i) { walk.push_back(vertices(engine)); }
+
+  walk.push_back(walk.front());
+
+  for (const bool isClosed : {true, false}) {
+    std::vector<g::Edge> edges{};
+    Multiset             expected{};
+
+    // Leaving out the last edge turns the circuit into a trail.
+    for (std::size_t i{1}; i < walk.size() - (isClosed ? 0 : 1); ++i) {
+      edges.emplace_back(walk[i - 1], walk[i]);
+      ++expected[{walk[i - 1], walk[i]}];
+    }
+
+    checkParallelTrail(
+      g::algo::directed_euler_trail::Multigraph{
+        g::algo::VertexIndex{identifiers}, edges},
+      expected);
+  }
+
+  checkParallelTrail(
+    g::algo::directed_euler_trail::Multigraph{
+      g::algo::VertexIndex{{1, 2, 3}},
+      {g::Edge{1, 2}, g::Edge{2, 1}, g::Edge{2, 3}, g::Edge{3, 3}},
+      {3, 2, 1, 1000}},
+    {{{1, 2}, 3}, {{2, 1}, 2}, {{2, 3}, 1}, {{3, 3}, 1000}});
+  checkParallelTrail(
+    g::algo::directed_euler_trail::Multigraph{
+      g::algo::VertexIndex{{7, 8}}, {}},
+    {});
+}
+
+TEST_CASE("parallel directed Euler trail should reject graphs without one")
+{
+  using g::algo::directed_euler_trail::Multigraph;
+
+  const Multigraph twoCycles{
+    g::algo::VertexIndex{{0, 1, 2, 3}},
+    {g::Edge{0, 1}, g::Edge{1, 0}, g::Edge{2, 3}, g::Edge{3, 2}}};
+  CHECK_THROWS_AS(
+    (void)g::algo::directed_euler_trail::algorithm(twoCycles, 2),
+    g::GraphException);
+
+  std::vector<std::uint32_t> tooLarge(6);
+  CHECK_THROWS_AS(
+    g::algo::directed_euler_trail::writeEulerTrail(twoCycles, tooLarge, 2),
+    g::GraphException);
+}
+
+TEST_CASE("directed Euler trail should reject graphs without one")
+{
+  using g::algo::directed_euler_trail::Multigraph;
+
+  // Two vertices with surplus outgoing edges.
+  CHECK_THROWS_AS(
+    (void)g::algo::directed_euler_trail::algorithm(Multigraph{
+      g::algo::VertexIndex{{0, 1, 2}}, {g::Edge{0, 1}, g::Edge{2, 1}}}),
+    g::GraphException);
+
+  // Balanced, but made of two separate cycles.
+  CHECK_THROWS_AS(
+    (void)g::algo::directed_euler_trail::algorithm(Multigraph{
+      g::algo::VertexIndex{{0, 1, 2, 3}},
+      {g::Edge{0, 1}, g::Edge{1, 0}, g::Edge{2, 3}, g::Edge{3, 2}}}),
+    g::GraphException);
+}
+
+TEST_CASE("directed Euler trail should work on a directed graph")
+{
+  g::Graph<
+    g::Directionality::Directed,
+    g::AdjacencyList,
+    std::nullptr_t,
+    std::nullptr_t>
+    graph{};
+
+  for (g::VertexIdentifier v{1}; v <= 4; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(1, 2, nullptr));
+  REQUIRE_UNARY(graph.addEdge(2, 3, nullptr));
+  REQUIRE_UNARY(graph.addEdge(3, 1, nullptr));
+  REQUIRE_UNARY(graph.addEdge(3, 4, nullptr));
+
+  const std::vector<g::VertexIdentifier> trail{
+    g::algo::directed_euler_trail::algorithm(graph)};
+
+  CHECK_EQ((std::vector<g::VertexIdentifier>{3, 1, 2, 3, 4}), trail);
+}
@@ -0,0 +1,133 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <random>
+#include <vector>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "algo/direction_optimizing_bfs/algorithm.hpp"
+#include "algo/traversal.hpp"
+#include "random_graph/create_graph.hpp"
+
+namespace {
+template<g::Directionality TheDirectionality>
+using graph_type = g::
+  Graph<TheDirectionality, g::AdjacencyList, std::nullptr_t, std::nullptr_t>;
+
+template<g::Directionality TheDirectionality>
+graph_type<TheDirectionality> makeRandomGraph(
+  std::size_t   vertexCount,
+  std::size_t   edgeCount,
+  std::uint32_t seed)
+{
+  graph_type<TheDirectionality> graph{};
+  std::mt19937                  engine{seed};
+  g::random_graph::addVertices(graph, vertexCount);
+  g::random_graph::addRandomEdges(graph, engine, vertexCount, edgeCount);
+  return graph;
+}
+
+/*!
+ * \brief Computes the hop distances with a sequential top down search.
+ **/
+std::vector<std::size_t> referenceDistances(
+  const g::algo::IndexedAdjacency& adjacency,
+  std::size_t                      source)
+{
+  struct Levels {
+    void treeArc(std::size_t from, std::size_t arc)
+    {
+      (*distance)[adjacency->target(arc)] = (*distance)[from] + 1;
+    }
+
+    const g::algo::IndexedAdjacency* adjacency;
+    std::vector<std::size_t>*        distance;
+  };
+
+  std::vector<std::size_t> distance(adjacency.vertexCount(), SIZE_MAX);
+  distance[source] = 0;
+  g::algo::Traversal traversal{adjacency.vertexCount()};
+  traversal.breadthFirst(adjacency, source, Levels{&adjacency, &distance});
+  return distance;
+}
+
+template<g::Directionality TheDirectionality>
+void checkAgainstReference(
+  const graph_type<TheDirectionality>& graph,
+  g::VertexIdentifier                  source,
+  std::size_t                          threadCount)
+{
+  const g::algo::IndexedAdjacency adjacency{
+    g::algo::makeIndexedAdjacency(graph)};
+  const std::vector<std::size_t> expected{referenceDistances(
+    adjacency, adjacency.vertexIndex().indexOf(source))};
+  const g::algo::direction_optimizing_bfs::Result result{
+    g::algo::direction_optimizing_bfs::algorithm(graph, source, threadCount)};
+
+  for (std::size_t i{0}; i < adjacency.vertexCount(); ++i) {
+    const g::VertexIdentifier vertex{adjacency.vertexIndex().vertexAt(i)};
+
+    if (expected[i] == SIZE_MAX) {
+      REQUIRE_UNARY_FALSE(result.isReachable(vertex));
+      REQUIRE_UNARY_FALSE(result.parentOf(vertex).has_value());
+      continue;
+    }
+
+    REQUIRE_EQ(expected[i], result.distanceTo(vertex).value());
+
+    if (vertex == source) {
+      REQUIRE_UNARY_FALSE(result.parentOf(vertex).has_value());
+      continue;
+    }
+
+    const g::VertexIdentifier parent{result.parentOf(vertex).value()};
+    REQUIRE_UNARY(graph.isDirectlyReachable(parent, vertex));
+    REQUIRE_EQ(expected[i] - 1, result.distanceTo(parent).value());
+  }
+}
+} // anonymous namespace
+
+TEST_CASE("direction optimizing BFS should find hop distances on a path")
+{
+  graph_type<g::Directionality::Directed> graph{};
+
+  for (g::VertexIdentifier v{0}; v < 5; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(0, 1, nullptr));
+  REQUIRE_UNARY(graph.addEdge(1, 2, nullptr));
+  REQUIRE_UNARY(graph.addEdge(2, 3, nullptr));
+  REQUIRE_UNARY(graph.addEdge(4, 0, nullptr));
+
+  const g::algo::direction_optimizing_bfs::Result result{
+    g::algo::direction_optimizing_bfs::algorithm(graph, 0, 2)};
+
+  CHECK_EQ(0, result.distanceTo(0).value());
+  CHECK_EQ(3, result.distanceTo(3).value());
+  CHECK_EQ(2, result.parentOf(3).value());
+  CHECK_UNARY_FALSE(result.isReachable(4));
+  CHECK_UNARY_FALSE(result.distanceTo(4).has_value());
+}
+
+TEST_CASE("direction optimizing BFS should agree with a top down search")
+{
+  // Dense enough that the search turns bottom up after the second level.
+  for (std::uint32_t seed{1}; seed <= 3; ++seed) {
+    const auto undirected{
+      makeRandomGraph<g::Directionality::Undirected>(700, 5000, seed)};
+    const auto directed{
+      makeRandomGraph<g::Directionality::Directed>(700, 9000, seed)};
+
+    for (std::size_t threadCount : {1, 4}) {
+      checkAgainstReference(undirected, seed, threadCount);
+      checkAgainstReference(directed, seed, threadCount);
+    }
+  }
+
+  // Sparse with long paths, so that it stays top down.
+  checkAgainstReference(
+    makeRandomGraph<g::Directionality::Directed>(500, 600, 7), 0, 3);
+}
@@ -0,0 +1,186 @@
+#include <cstddef>
+
+#include <vector>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "algo/fleury/bridge_oracle.hpp"
+#include "algo/fleury/is_bridge.hpp"
+#include "graph.hpp"
+
+namespace {
+using graph_type = g::Graph<
+  g::Directionality::Undirected,
+  g::AdjacencyList,
+  std::nullptr_t,
+  std::nullptr_t>;
+
+/* Two triangles 0-1-2 and 3-4-5 joined by the bridge 2-3. */
+graph_type makeGraph()
+{
+  graph_type graph{};
+
+  for (g::VertexIdentifier v{0}; v < 6; ++v) {
+    G_ASSERT(graph.addVertex(v, nullptr), "Couldn't add %zu to graph.", v);
+  }
+
+  for (const auto& [source, target] :
+       {std::pair<g::VertexIdentifier, g::VertexIdentifier>{0, 1},
+        {1, 2},
+        {2, 0},
+        {2, 3},
+        {3, 4},
+        {4, 5},
+        {5, 3}}) {
+    G_ASSERT(
+      graph.addEdge(source, target, nullptr),
+      "Couldn't add edge from %zu to %zu to graph.",
+      source,
+      target);
+  }
+
+  return graph;
+}
+
+/* The cycle 0-1-...-(n-1)-0 with the chords i-(i+2), which leaves every
+ * vertex with degree 4 and no bridges. */
+graph_type makeCycleWithChords(g::VertexIdentifier vertexCount)
+{
+  graph_type graph{};
+
+  for (g::VertexIdentifier v{0}; v < vertexCount; ++v) {
+    G_ASSERT(graph.addVertex(v, nullptr), "Couldn't add %zu to graph.", v);
+  }
+
+  for (g::VertexIdentifier v{0}; v < vertexCount; ++v) {
+    for (g::VertexIdentifier offset{1}; offset <= 2; ++offset) {
+      const g::VertexIdentifier target{(v + offset) % vertexCount};
+      G_ASSERT(
+        graph.addEdge(v, target, nullptr),
+        "Couldn't add edge from %zu to %zu to graph.",
+        v,
+        target);
+    }
+  }
+
+  return graph;
+}
+
+std::size_t edgeIdOf(
+  const g::algo::IndexedAdjacency& adjacency,
+  g::VertexIdentifier              source,
+  g::VertexIdentifier              target)
+{
+  const std::optional<std::size_t> edgeId{g::algo::fleury::detail::findEdgeId(
+    adjacency,
+    adjacency.vertexIndex().indexOf(source),
+    adjacency.vertexIndex().indexOf(target))};
+  G_ASSERT(edgeId.has_value(), "No edge from %zu to %zu.", source, target);
+  return *edgeId;
+}
+} // anonymous namespace
+
+TEST_CASE("findBridges should find the bridges")
+{
+  const graph_type                graph{makeGraph()};
+  const g::algo::IndexedAdjacency adjacency{
+    g::algo::makeIndexedAdjacency(graph)};
+  const std::vector<bool> isBridge{g::algo::fleury::findBridges(
+    adjacency, std::vector<bool>(adjacency.edgeCount(), false))};
+
+  CHECK_UNARY(isBridge[edgeIdOf(adjacency, 2, 3)]);
+  CHECK_UNARY_FALSE(isBridge[edgeIdOf(adjacency, 0, 1)]);
+  CHECK_UNARY_FALSE(isBridge[edgeIdOf(adjacency, 4, 5)]);
+  CHECK_UNARY(g::algo::fleury::isBridge(graph, 3, 2));
+  CHECK_UNARY_FALSE(g::algo::fleury::isBridge(graph, 5, 3));
+}
+
+TEST_CASE("the bridge oracle should find new bridges without recomputing")
+{
+  const graph_type                graph{makeGraph()};
+  const g::algo::IndexedAdjacency adjacency{
+    g::algo::makeIndexedAdjacency(graph)};
+  g::algo::fleury::BridgeOracle oracle{adjacency};
+  CHECK_EQ(0, oracle.computationCount());
+
+  CHECK_UNARY(oracle.isBridge(edgeIdOf(adjacency, 2, 3)));
+  CHECK_EQ(1, oracle.computationCount());
+
+  oracle.remove(edgeIdOf(adjacency, 2, 3));
+  CHECK_UNARY_FALSE(oracle.isBridge(edgeIdOf(adjacency, 3, 4)));
+
+  oracle.remove(edgeIdOf(adjacency, 4, 5));
+  CHECK_UNARY(oracle.isRemoved(edgeIdOf(adjacency, 4, 5)));
+  CHECK_UNARY(oracle.isBridge(edgeIdOf(adjacency, 3, 4)));
+  CHECK_UNARY(oracle.isBridge(edgeIdOf(adjacency, 5, 3)));
+  CHECK_UNARY_FALSE(oracle.isBridge(edgeIdOf(adjacency, 0, 1)));
+  CHECK_EQ(1, oracle.computationCount());
+}
+
+TEST_CASE("the bridge oracle should agree with findBridges")
+{
+  const graph_type                graph{makeCycleWithChords(60)};
+  const g::algo::IndexedAdjacency adjacency{
+    g::algo::makeIndexedAdjacency(graph)};
+  g::algo::fleury::BridgeOracle oracle{adjacency};
+  std::vector<bool>             isRemoved(adjacency.edgeCount(), false);
+
+  // Removes every 7th edge in turn, which visits every edge since 7 and 120
+  // are coprime.
+  for (std::size_t step{0}; step < adjacency.edgeCount(); ++step) {
+    const std::size_t removed{step * 7 % adjacency.edgeCount()};
+    oracle.remove(removed);
+    isRemoved[removed] = true;
+
+    const std::vector<bool> isBridge{
+      g::algo::fleury::findBridges(adjacency, isRemoved)};
+
+    for (std::size_t edgeId{0}; edgeId < adjacency.edgeCount(); ++edgeId) {
+      if (!isRemoved[edgeId]) {
+        REQUIRE_EQ(isBridge[edgeId], oracle.isBridge(edgeId));
+      }
+    }
+  }
+
+  CHECK_EQ(1, oracle.computationCount());
+}
+
+TEST_CASE("the bridge oracle should do bounded work on a cycle with chords")
+{
+  const graph_type                graph{makeCycleWithChords(5'000)};
+  const g::algo::IndexedAdjacency adjacency{
+    g::algo::makeIndexedAdjacency(graph)};
+  g::algo::fleury::BridgeOracle oracle{adjacency};
+  std::size_t                   vertex{0};
+  std::size_t                   steps{0};
+
+  // Walks the graph the way Fleury's algorithm does.
+  for (;;) {
+    std::size_t remainingArcs{0};
+
+    for (std::size_t arc{adjacency.firstArc(vertex)};
+         arc < adjacency.lastArc(vertex);
+         ++arc) {
+      if (!oracle.isRemoved(adjacency.edgeId(arc))) { ++remainingArcs; }
+    }
+
+    if (remainingArcs == 0) { break; }
+
+    std::size_t arc{adjacency.firstArc(vertex)};
+
+    while (oracle.isRemoved(adjacency.edgeId(arc))
+           || (remainingArcs > 1 && oracle.isBridge(adjacency.edgeId(arc)))) {
+      ++arc;
+      REQUIRE_UNARY(arc < adjacency.lastArc(vertex));
+    }
+
+    oracle.remove(adjacency.edgeId(arc));
+    vertex = adjacency.target(arc);
+    ++steps;
+  }
+
+  CHECK_EQ(adjacency.edgeCount(), steps);
+  CHECK_EQ(1, oracle.computationCount());
+  CHECK_LE(oracle.examinedArcCount(), 8 * adjacency.arcCount());
+}
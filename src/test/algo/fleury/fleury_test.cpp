@@ -109,3 +109,19 @@ TEST_CASE("Fleury should find a traversable path")
     REQUIRE_UNARY(g.isDirectlyReachable(current, next));
   }
 }
+
+TEST_CASE("Fleury should start an open trail at a vertex of odd degree")
+{
+  graph_type g{makeGraph()};
+  REQUIRE_UNARY(g.removeEdge(8, 9));
+
+  const std::vector<g::VertexIdentifier> result{g::algo::fleury::algorithm(g)};
+
+  REQUIRE_EQ(g.edgeCount() + 1, result.size());
+  CHECK_EQ(8, result.front());
+  CHECK_EQ(9, result.back());
+
+  for (std::size_t i{0}; i < (result.size() - 1); ++i) {
+    REQUIRE_UNARY(g.isDirectlyReachable(result[i], result[i + 1]));
+  }
+}
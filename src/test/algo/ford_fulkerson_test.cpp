@@ -2,6 +2,7 @@
 #include <cstdio>
 
 #include <sstream>
+#include <utility>
 
 #include <doctest.h>
 
@@ -98,3 +99,35 @@ TEST_CASE("Ford-Fulkerson should work")
   CHECK_EQ(expectedMaximumFlow, result.maxFlow());
   CHECK_EQ(expectedFlow, result.flow());
 }
+
+TEST_CASE("Ford-Fulkerson should cancel flow along reverse arcs")
+{
+  // The shortest path 0 -> 1 -> 2 -> 3 blocks both longer paths, so the
+  // second unit of flow has to go back from 2 to 1.
+  graph_type graph{};
+
+  for (g::VertexIdentifier vertex{0}; vertex < 8; ++vertex) {
+    REQUIRE_UNARY(graph.addVertex(vertex, nullptr));
+  }
+
+  for (const auto& [source, target] :
+       {std::pair<g::VertexIdentifier, g::VertexIdentifier>{0, 1},
+        {1, 2},
+        {2, 3},
+        {1, 4},
+        {4, 5},
+        {5, 3},
+        {0, 6},
+        {6, 7},
+        {7, 2}}) {
+    REQUIRE_UNARY(graph.addEdge(source, target, 1));
+  }
+
+  const g::algo::ford_fulkerson::Result result{
+    g::algo::ford_fulkerson::algorithm(graph, 0, 3)};
+
+  CHECK_EQ(2, result.maxFlow());
+  CHECK_EQ(0, result.flow().at(g::Edge{1, 2}));
+  CHECK_EQ(1, result.flow().at(g::Edge{1, 4}));
+  CHECK_EQ(1, result.flow().at(g::Edge{7, 2}));
+}
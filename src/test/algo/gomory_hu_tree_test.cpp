@@ -0,0 +1,68 @@
+#include <cstdint>
+
+#include <random>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "algo/gomory_hu_tree.hpp"
+#include "algo/push_relabel/algorithm.hpp"
+#include "random_graph/create_graph.hpp"
+
+namespace {
+using graph_type = g::Graph<
+  g::Directionality::Undirected,
+  g::AdjacencyList,
+  std::nullptr_t,
+  std::int32_t>;
+} // anonymous namespace
+
+TEST_CASE("The Gomory-Hu tree should answer all pairs minimum cut queries")
+{
+  std::mt19937 engine{1337}; // NOLINT
+
+  for (int i{0}; i < 10; ++i) {
+    const g::VertexIdentifier count{12};
+    const graph_type          graph{g::random_graph::createFlowNetwork<
+      g::Directionality::Undirected,
+      g::AdjacencyList>(engine, count, 0.35, 10)};
+    const g::algo::GomoryHuTree tree{g::algo::gomoryHuTree(graph)};
+
+    std::size_t rootCount{0};
+
+    for (g::VertexIdentifier v{0}; v < count; ++v) {
+      if (!tree.parentOf(v).has_value()) { ++rootCount; }
+    }
+
+    REQUIRE_EQ(1, rootCount);
+
+    for (g::VertexIdentifier u{0}; u < count; ++u) {
+      for (g::VertexIdentifier v{u + 1}; v < count; ++v) {
+        const std::int32_t expected{
+          g::algo::push_relabel::algorithm(graph, u, v).maxFlow()};
+        REQUIRE_EQ(expected, tree.minimumCut(u, v));
+        REQUIRE_EQ(expected, tree.minimumCut(v, u));
+      }
+    }
+  }
+}
+
+TEST_CASE("The Gomory-Hu tree of a path should be the path itself")
+{
+  graph_type graph{};
+
+  for (g::VertexIdentifier v{1}; v <= 4; ++v) {
+    G_ASSERT(graph.addVertex(v, nullptr), "Couldn't add %zu to graph.", v);
+  }
+
+  G_ASSERT(graph.addEdge(1, 2, 3), "%s", "Couldn't add edge.");
+  G_ASSERT(graph.addEdge(2, 3, 1), "%s", "Couldn't add edge.");
+  G_ASSERT(graph.addEdge(3, 4, 2), "%s", "Couldn't add edge.");
+
+  const g::algo::GomoryHuTree tree{g::algo::gomoryHuTree(graph)};
+
+  CHECK_EQ(3, tree.minimumCut(1, 2));
+  CHECK_EQ(1, tree.minimumCut(1, 4));
+  CHECK_EQ(2, tree.minimumCut(4, 3));
+  CHECK_EQ(1, tree.minimumCut(2, 3));
+}
@@ -0,0 +1,112 @@
+#include <cstddef>
+
+#include <random>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "algo/grail/algorithm.hpp"
+#include "algo/transitive_closure/algorithm.hpp"
+#include "graph_exception.hpp"
+#include "random_graph/create_graph.hpp"
+
+namespace {
+using DirectedGraph = g::Graph<
+  g::Directionality::Directed,
+  g::AdjacencyList,
+  std::nullptr_t,
+  std::nullptr_t>;
+
+/*!
+ * \brief Creates a random graph that is mostly acyclic.
+ **/
+DirectedGraph randomGraph(
+  std::size_t vertexCount,
+  std::size_t edgeCount,
+  std::size_t backEdgeCount)
+{
+  DirectedGraph graph{};
+  std::mt19937  engine{5};
+  g::random_graph::addVertices(graph, vertexCount);
+  g::random_graph::addRandomEdges(
+    graph,
+    engine,
+    vertexCount,
+    edgeCount,
+    g::random_graph::Orientation::Ascending);
+  g::random_graph::addRandomEdges(
+    graph,
+    engine,
+    vertexCount,
+    backEdgeCount,
+    g::random_graph::Orientation::Descending);
+  return graph;
+}
+} // anonymous namespace
+
+TEST_CASE("GRAIL should answer queries on a small DAG")
+{
+  DirectedGraph graph{};
+
+  for (g::VertexIdentifier v{1}; v <= 5; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(1, 2, nullptr));
+  REQUIRE_UNARY(graph.addEdge(1, 3, nullptr));
+  REQUIRE_UNARY(graph.addEdge(2, 4, nullptr));
+  REQUIRE_UNARY(graph.addEdge(3, 4, nullptr));
+  REQUIRE_UNARY(graph.addEdge(4, 2, nullptr));
+
+  g::algo::grail::ReachabilityIndex index{
+    g::algo::grail::algorithm(graph, 2)};
+
+  CHECK_EQ(2, index.labelingCount());
+  CHECK_EQ(4, index.condensation().componentCount());
+  CHECK_UNARY(index.reaches(1, 4));
+  CHECK_UNARY(index.reaches(4, 2));
+  CHECK_UNARY(index.reaches(3, 2));
+  CHECK_UNARY(index.reaches(5, 5));
+  CHECK_UNARY_FALSE(index.reaches(2, 3));
+  CHECK_UNARY_FALSE(index.reaches(4, 1));
+  CHECK_UNARY_FALSE(index.reaches(1, 5));
+  CHECK_THROWS_AS((void)index.reaches(1, 6), g::GraphException);
+}
+
+TEST_CASE("GRAIL should agree with the transitive closure")
+{
+  const DirectedGraph graph{randomGraph(600, 1500, 20)};
+  const g::algo::transitive_closure::TransitiveClosure closure{
+    g::algo::transitive_closure::algorithm(graph)};
+  const std::size_t vertexCount{closure.vertexIndex().size()};
+
+  // No labels at all only leaves the search.
+  for (std::size_t labelingCount : {0, 1, 4}) {
+    g::algo::grail::ReachabilityIndex index{
+      g::algo::grail::algorithm(graph, labelingCount, 2)};
+
+    for (std::size_t source{0}; source < vertexCount; ++source) {
+      for (std::size_t target{0}; target < vertexCount; ++target) {
+        REQUIRE_EQ(
+          closure.reachesByIndex(source, target),
+          index.reachesByIndex(source, target));
+      }
+    }
+  }
+}
+
+TEST_CASE("GRAIL labels should not depend on the count of threads")
+{
+  const DirectedGraph                     graph{randomGraph(300, 700, 0)};
+  const g::algo::grail::ReachabilityIndex one{
+    g::algo::grail::algorithm(graph, 3, 1)};
+  const g::algo::grail::ReachabilityIndex three{
+    g::algo::grail::algorithm(graph, 3, 3)};
+
+  for (std::size_t c{0}; c < one.condensation().componentCount(); ++c) {
+    for (std::size_t i{0}; i < 3; ++i) {
+      CHECK_EQ(one.labelsOf(c)[i].low, three.labelsOf(c)[i].low);
+      CHECK_EQ(one.labelsOf(c)[i].rank, three.labelsOf(c)[i].rank);
+    }
+  }
+}
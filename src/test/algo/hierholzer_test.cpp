@@ -108,3 +108,41 @@ TEST_CASE("Hierholzer's algorithm should produce a traversable path")
     REQUIRE_UNARY(graph.isDirectlyReachable(current, next));
   }
 }
+
+TEST_CASE("Hierholzer's algorithm should not modify the graph")
+{
+  const graph_type graph{makeGraph()};
+  const graph_type copy{graph};
+  (void)g::algo::hierholzer(graph);
+
+  CHECK_EQ(copy.edgeCount(), graph.edgeCount());
+}
+
+TEST_CASE("Hierholzer's algorithm should handle long circuits")
+{
+  constexpr g::VertexIdentifier vertexCount{100000};
+  graph_type                    graph{};
+
+  for (g::VertexIdentifier v{0}; v < vertexCount; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  // A ring plus a second ring over the even vertices, so that every vertex
+  // has an even degree.
+  for (g::VertexIdentifier v{0}; v < vertexCount; ++v) {
+    REQUIRE_UNARY(graph.addEdge(v, (v + 1) % vertexCount, nullptr));
+  }
+
+  for (g::VertexIdentifier v{0}; v < vertexCount; v += 2) {
+    REQUIRE_UNARY(graph.addEdge(v, (v + 2) % vertexCount, nullptr));
+  }
+
+  const std::vector<g::VertexIdentifier> result{g::algo::hierholzer(graph)};
+
+  REQUIRE_EQ(graph.edgeCount() + 1, result.size());
+  CHECK_EQ(result.front(), result.back());
+
+  for (std::size_t i{0}; i < (result.size() - 1); ++i) {
+    REQUIRE_UNARY(graph.isDirectlyReachable(result[i], result[i + 1]));
+  }
+}
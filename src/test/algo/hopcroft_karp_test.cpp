@@ -0,0 +1,216 @@
+#include <cstdint>
+
+#include <random>
+#include <unordered_set>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "adjacency_matrix.hpp"
+#include "algo/push_relabel/algorithm.hpp"
+#include "algo/hopcroft_karp/algorithm.hpp"
+#include "graph_exception.hpp"
+
+namespace {
+template<typename Graph>
+bool isValidMatching(
+  const Graph&                            graph,
+  const g::algo::hopcroft_karp::Matching& matching)
+{
+  std::unordered_set<g::VertexIdentifier> matched{};
+
+  for (const g::Edge& edge : matching.edges()) {
+    if (
+      !graph.hasEdge(edge.source(), edge.target())
+      && !graph.hasEdge(edge.target(), edge.source())) {
+      return false;
+    }
+
+    if (
+      !matched.insert(edge.source()).second
+      || !matched.insert(edge.target()).second) {
+      return false;
+    }
+
+    if (
+      matching.mateOf(edge.source()) != edge.target()
+      || matching.mateOf(edge.target()) != edge.source()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/*!
+ * Computes the size of a maximum matching as the maximum flow of the unit
+ * capacity network with an additional source and sink.
+ **/
+std::int32_t maximumMatchingSizeByMaxFlow(
+  const std::vector<g::Edge>& edges,
+  g::VertexIdentifier         leftCount,
+  g::VertexIdentifier         rightCount)
+{
+  g::Graph<
+    g::Directionality::Directed,
+    g::AdjacencyList,
+    std::nullptr_t,
+    std::int32_t>
+                            network{};
+  const g::VertexIdentifier source{leftCount + rightCount};
+  const g::VertexIdentifier sink{source + 1};
+
+  for (g::VertexIdentifier v{0}; v <= sink; ++v) {
+    G_ASSERT(network.addVertex(v, nullptr), "Couldn't add %zu.", v);
+  }
+
+  for (g::VertexIdentifier v{0}; v < leftCount; ++v) {
+    G_ASSERT(network.addEdge(source, v, 1), "Couldn't add edge to %zu.", v);
+  }
+
+  for (g::VertexIdentifier v{leftCount}; v < source; ++v) {
+    G_ASSERT(network.addEdge(v, sink, 1), "Couldn't add edge from %zu.", v);
+  }
+
+  for (const g::Edge& edge : edges) {
+    G_ASSERT(
+      network.addEdge(edge.source(), edge.target(), 1),
+      "Couldn't add edge from %zu.",
+      edge.source());
+  }
+
+  return g::algo::push_relabel::algorithm(network, source, sink).maxFlow();
+}
+} // anonymous namespace
+
+TEST_CASE("Hopcroft-Karp should find a maximum matching")
+{
+  g::Graph<
+    g::Directionality::Undirected,
+    g::AdjacencyList,
+    std::nullptr_t,
+    std::nullptr_t>
+    graph{};
+
+  for (g::VertexIdentifier v{0}; v < 8; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  // The greedy choice 0-4 has to be undone to match all left vertices.
+  REQUIRE_UNARY(graph.addEdge(0, 4, nullptr));
+  REQUIRE_UNARY(graph.addEdge(0, 5, nullptr));
+  REQUIRE_UNARY(graph.addEdge(1, 4, nullptr));
+  REQUIRE_UNARY(graph.addEdge(2, 5, nullptr));
+  REQUIRE_UNARY(graph.addEdge(2, 6, nullptr));
+  REQUIRE_UNARY(graph.addEdge(3, 6, nullptr));
+  REQUIRE_UNARY(graph.addEdge(3, 7, nullptr));
+
+  const g::algo::hopcroft_karp::Matching matching{
+    g::algo::hopcroft_karp::algorithm(graph, {0, 1, 2, 3})};
+
+  CHECK_EQ(4, matching.size());
+  CHECK_UNARY(isValidMatching(graph, matching));
+  CHECK_EQ(4, matching.mateOf(1));
+  CHECK_EQ(0, matching.edges().front().source());
+
+  const g::algo::hopcroft_karp::Matching coloured{
+    g::algo::hopcroft_karp::algorithm(graph)};
+
+  CHECK_EQ(4, coloured.size());
+  CHECK_UNARY(isValidMatching(graph, coloured));
+}
+
+TEST_CASE("Hopcroft-Karp should leave isolated vertices unmatched")
+{
+  g::Graph<
+    g::Directionality::Directed,
+    g::AdjacencyMatrix,
+    std::nullptr_t,
+    std::nullptr_t>
+    graph{};
+
+  for (g::VertexIdentifier v{0}; v < 3; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(1, 0, nullptr));
+
+  const g::algo::hopcroft_karp::Matching matching{
+    g::algo::hopcroft_karp::algorithm(graph, {0, 2})};
+
+  REQUIRE_EQ(1, matching.size());
+  CHECK_EQ((g::Edge{0, 1}), matching.edges().front());
+  CHECK_EQ(std::nullopt, matching.mateOf(2));
+}
+
+TEST_CASE("Hopcroft-Karp should reject graphs that are not bipartite")
+{
+  g::Graph<
+    g::Directionality::Undirected,
+    g::AdjacencyList,
+    std::nullptr_t,
+    std::nullptr_t>
+    graph{};
+
+  for (g::VertexIdentifier v{0}; v < 3; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(0, 1, nullptr));
+  REQUIRE_UNARY(graph.addEdge(1, 2, nullptr));
+
+  CHECK_THROWS_AS(
+    (void)g::algo::hopcroft_karp::algorithm(graph, {0, 1}),
+    g::GraphException);
+  CHECK_EQ(1, g::algo::hopcroft_karp::algorithm(graph, {1}).size());
+
+  REQUIRE_UNARY(graph.addEdge(2, 0, nullptr));
+  CHECK_THROWS_AS(
+    (void)g::algo::hopcroft_karp::algorithm(graph), g::GraphException);
+}
+
+TEST_CASE("Hopcroft-Karp should agree with a unit capacity maximum flow")
+{
+  std::mt19937                              engine{99}; // NOLINT
+  std::uniform_int_distribution<std::size_t> sideSize{1, 9};
+  std::bernoulli_distribution               hasEdge{0.25};
+
+  for (int i{0}; i < 50; ++i) {
+    const g::VertexIdentifier leftCount{sideSize(engine)};
+    const g::VertexIdentifier rightCount{sideSize(engine)};
+    g::Graph<
+      g::Directionality::Undirected,
+      g::AdjacencyList,
+      std::nullptr_t,
+      std::nullptr_t>
+                                  graph{};
+    std::vector<g::VertexIdentifier> leftVertices{};
+    std::vector<g::Edge>             edges{};
+
+    for (g::VertexIdentifier v{0}; v < leftCount + rightCount; ++v) {
+      REQUIRE_UNARY(graph.addVertex(v, nullptr));
+
+      if (v < leftCount) { leftVertices.push_back(v); }
+    }
+
+    for (g::VertexIdentifier u{0}; u < leftCount; ++u) {
+      for (g::VertexIdentifier v{leftCount}; v < leftCount + rightCount; ++v) {
+        if (hasEdge(engine)) {
+          REQUIRE_UNARY(graph.addEdge(u, v, nullptr));
+          edges.emplace_back(u, v);
+        }
+      }
+    }
+
+    const g::algo::hopcroft_karp::Matching matching{
+      g::algo::hopcroft_karp::algorithm(graph, leftVertices)};
+
+    REQUIRE_UNARY(isValidMatching(graph, matching));
+    REQUIRE_EQ(
+      static_cast<std::size_t>(
+        maximumMatchingSizeByMaxFlow(edges, leftCount, rightCount)),
+      matching.size());
+    REQUIRE_EQ(
+      matching.size(), g::algo::hopcroft_karp::algorithm(graph).size());
+  }
+}
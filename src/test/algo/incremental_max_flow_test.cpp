@@ -0,0 +1,127 @@
+#include <cstdint>
+
+#include <random>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "adjacency_matrix.hpp"
+#include "algo/incremental_max_flow.hpp"
+#include "algo/push_relabel/algorithm.hpp"
+#include "flow_check/is_valid_flow.hpp"
+#include "graph_exception.hpp"
+#include "random_graph/create_graph.hpp"
+
+namespace {
+using g::flow_check::isValidFlow;
+using g::random_graph::createFlowNetwork;
+
+template<typename Graph>
+void checkRandomCapacityChanges(
+  std::mt19937&       engine,
+  Graph               graph,
+  g::VertexIdentifier sink)
+{
+  g::algo::IncrementalMaxFlow incremental{
+    g::algo::makeIncrementalMaxFlow(graph, 0, sink)};
+  const std::vector<g::Edge>                  edges{graph.edges()};
+  std::uniform_int_distribution<std::size_t>  edgeIndex{0, edges.size() - 1};
+  std::uniform_int_distribution<std::int32_t> capacity{0, 20};
+
+  REQUIRE_EQ(
+    g::algo::push_relabel::algorithm(graph, 0, sink).maxFlow(),
+    incremental.maxFlow());
+
+  for (int i{0}; i < 50; ++i) {
+    const g::Edge&     edge{edges[edgeIndex(engine)]};
+    const std::int32_t newCapacity{capacity(engine)};
+    incremental.setCapacity(edge.source(), edge.target(), newCapacity);
+    REQUIRE_UNARY(graph.removeEdge(edge.source(), edge.target()));
+    REQUIRE_UNARY(graph.addEdge(edge.source(), edge.target(), newCapacity));
+
+    REQUIRE_EQ(
+      g::algo::push_relabel::algorithm(graph, 0, sink).maxFlow(),
+      incremental.maxFlow());
+    REQUIRE_UNARY(isValidFlow(graph, incremental.result(), 0, sink));
+  }
+}
+} // anonymous namespace
+
+TEST_CASE("incremental max flow should follow capacity changes")
+{
+  g::Graph<
+    g::Directionality::Directed,
+    g::AdjacencyList,
+    std::nullptr_t,
+    std::int32_t>
+    graph{};
+
+  for (g::VertexIdentifier v{0}; v < 4; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(0, 1, 3));
+  REQUIRE_UNARY(graph.addEdge(0, 2, 2));
+  REQUIRE_UNARY(graph.addEdge(1, 2, 1));
+  REQUIRE_UNARY(graph.addEdge(1, 3, 2));
+  REQUIRE_UNARY(graph.addEdge(2, 3, 3));
+
+  g::algo::IncrementalMaxFlow incremental{
+    g::algo::makeIncrementalMaxFlow(graph, 0, 3)};
+  CHECK_EQ(5, incremental.maxFlow());
+
+  incremental.setCapacity(1, 3, 0);
+  CHECK_EQ(3, incremental.maxFlow());
+
+  incremental.setCapacity(0, 2, 5);
+  CHECK_EQ(3, incremental.maxFlow());
+
+  incremental.setCapacity(2, 3, 10);
+  CHECK_EQ(6, incremental.maxFlow());
+
+  incremental.setCapacity(1, 3, 4);
+  CHECK_EQ(8, incremental.maxFlow());
+
+  incremental.setCapacity(0, 1, 0);
+  CHECK_EQ(5, incremental.maxFlow());
+  CHECK_EQ(0, incremental.result().flow().at(g::Edge{0, 1}));
+}
+
+TEST_CASE("incremental max flow should throw on invalid capacity changes")
+{
+  g::Graph<
+    g::Directionality::Directed,
+    g::AdjacencyList,
+    std::nullptr_t,
+    std::int32_t>
+    graph{};
+  REQUIRE_UNARY(graph.addVertex(0, nullptr));
+  REQUIRE_UNARY(graph.addVertex(1, nullptr));
+  REQUIRE_UNARY(graph.addEdge(0, 1, 3));
+
+  g::algo::IncrementalMaxFlow incremental{
+    g::algo::makeIncrementalMaxFlow(graph, 0, 1)};
+  CHECK_THROWS_AS(incremental.setCapacity(1, 0, 2), g::GraphException);
+  CHECK_THROWS_AS(incremental.setCapacity(0, 1, -1), g::GraphException);
+  CHECK_THROWS_AS(
+    (void)g::algo::makeIncrementalMaxFlow(graph, 1, 1), g::GraphException);
+}
+
+TEST_CASE("incremental max flow should agree with push-relabel on random "
+          "capacity changes")
+{
+  std::mt19937 engine{314}; // NOLINT
+
+  for (int i{0}; i < 20; ++i) {
+    checkRandomCapacityChanges(
+      engine,
+      createFlowNetwork<g::Directionality::Directed, g::AdjacencyList>(
+        engine, 12),
+      11);
+    checkRandomCapacityChanges(
+      engine,
+      createFlowNetwork<g::Directionality::Undirected, g::AdjacencyMatrix>(
+        engine, 10),
+      9);
+  }
+}
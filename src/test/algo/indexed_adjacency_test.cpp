@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <vector>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "adjacency_matrix.hpp"
+#include "algo/indexed_adjacency.hpp"
+
+TEST_CASE("indexed adjacency should give undirected edges one identifier")
+{
+  g::Graph<
+    g::Directionality::Undirected,
+    g::AdjacencyList,
+    std::nullptr_t,
+    std::nullptr_t>
+    graph{};
+
+  for (g::VertexIdentifier v{10}; v < 14; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(10, 11, nullptr));
+  REQUIRE_UNARY(graph.addEdge(11, 12, nullptr));
+  REQUIRE_UNARY(graph.addEdge(12, 12, nullptr));
+
+  const g::algo::IndexedAdjacency adjacency{
+    g::algo::makeIndexedAdjacency(graph)};
+
+  REQUIRE_EQ(4, adjacency.vertexCount());
+  REQUIRE_EQ(3, adjacency.edgeCount());
+  REQUIRE_EQ(5, adjacency.arcCount());
+
+  const std::size_t v11{adjacency.vertexIndex().indexOf(11)};
+  const std::size_t v13{adjacency.vertexIndex().indexOf(13)};
+  CHECK_EQ(2, adjacency.lastArc(v11) - adjacency.firstArc(v11));
+  CHECK_EQ(adjacency.firstArc(v13), adjacency.lastArc(v13));
+
+  // The loop has a single arc, the other edges one arc per endpoint.
+  std::vector<std::size_t> arcsPerEdge(adjacency.edgeCount(), 0);
+
+  for (std::size_t arc{0}; arc < adjacency.arcCount(); ++arc) {
+    ++arcsPerEdge[adjacency.edgeId(arc)];
+  }
+
+  std::sort(arcsPerEdge.begin(), arcsPerEdge.end());
+  CHECK_EQ((std::vector<std::size_t>{1, 2, 2}), arcsPerEdge);
+}
+
+TEST_CASE("indexed adjacency should keep directed edges one way")
+{
+  g::Graph<
+    g::Directionality::Directed,
+    g::AdjacencyMatrix,
+    std::nullptr_t,
+    std::nullptr_t>
+    graph{};
+
+  for (g::VertexIdentifier v{0}; v < 3; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(0, 1, nullptr));
+  REQUIRE_UNARY(graph.addEdge(1, 0, nullptr));
+  REQUIRE_UNARY(graph.addEdge(2, 0, nullptr));
+
+  const g::algo::IndexedAdjacency adjacency{
+    g::algo::makeIndexedAdjacency(graph)};
+
+  REQUIRE_EQ(3, adjacency.edgeCount());
+  REQUIRE_EQ(3, adjacency.arcCount());
+  REQUIRE_EQ(1, adjacency.lastArc(2) - adjacency.firstArc(2));
+  CHECK_EQ(0, adjacency.target(adjacency.firstArc(2)));
+}
+
+TEST_CASE("indexed adjacency should reverse every arc when transposed")
+{
+  const g::algo::IndexedAdjacency adjacency{
+    g::algo::VertexIndex{{0, 1, 2}},
+    {g::Edge{0, 1}, g::Edge{0, 2}, g::Edge{1, 2}},
+    g::Directionality::Directed};
+  const g::algo::IndexedAdjacency transpose{adjacency.transposed()};
+
+  REQUIRE_EQ(3, transpose.edgeCount());
+  REQUIRE_EQ(3, transpose.arcCount());
+  CHECK_EQ(transpose.firstArc(0), transpose.lastArc(0));
+  REQUIRE_EQ(1, transpose.lastArc(1) - transpose.firstArc(1));
+  CHECK_EQ(0, transpose.target(transpose.firstArc(1)));
+  CHECK_EQ(0, transpose.edgeId(transpose.firstArc(1)));
+  REQUIRE_EQ(2, transpose.lastArc(2) - transpose.firstArc(2));
+  CHECK_EQ(0, transpose.target(transpose.firstArc(2)));
+  CHECK_EQ(1, transpose.edgeId(transpose.firstArc(2)));
+  CHECK_EQ(1, transpose.target(transpose.firstArc(2) + 1));
+  CHECK_EQ(2, transpose.edgeId(transpose.firstArc(2) + 1));
+}
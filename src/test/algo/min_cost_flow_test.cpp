@@ -0,0 +1,182 @@
+#include <cstdint>
+
+#include <random>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "adjacency_matrix.hpp"
+#include "algo/min_cost_flow/algorithm.hpp"
+#include "algo/push_relabel/algorithm.hpp"
+#include "flow_check/is_valid_flow.hpp"
+#include "graph_exception.hpp"
+#include "random_graph/create_graph.hpp"
+
+namespace {
+using Engine = g::algo::min_cost_flow::Engine;
+using g::algo::min_cost_flow::CapacityAndCost;
+
+/*!
+ * \brief Checks that `result` is a valid flow that costs `result.totalCost()`.
+ **/
+template<typename Graph>
+bool isValidFlow(
+  const Graph&                          graph,
+  const g::algo::min_cost_flow::Result& result,
+  g::VertexIdentifier                   source,
+  g::VertexIdentifier                   sink)
+{
+  std::int64_t totalCost{0};
+
+  for (const auto& [edge, flow] : result.flow()) {
+    if (flow < 0) { return false; }
+
+    if (flow > 0) {
+      totalCost
+        += flow * graph.fetchEdgeData(edge.source(), edge.target())->cost();
+    }
+  }
+
+  return g::flow_check::isValidFlow(graph, result, source, sink)
+         && totalCost == result.totalCost();
+}
+
+template<g::Directionality TheDirectionality, typename Implementation>
+g::Graph<TheDirectionality, Implementation, std::nullptr_t, CapacityAndCost>
+createRandomGraph(std::mt19937& engine, g::VertexIdentifier vertexCount)
+{
+  g::Graph<TheDirectionality, Implementation, std::nullptr_t, CapacityAndCost>
+                                              graph{};
+  std::uniform_int_distribution<std::int32_t> capacity{1, 20};
+  std::uniform_int_distribution<std::int64_t> cost{0, 50};
+
+  g::random_graph::addVertices(graph, vertexCount);
+  g::random_graph::addEdgesWithProbability(
+    graph, engine, vertexCount, 0.3, [&](std::mt19937& e) {
+      return CapacityAndCost{capacity(e), cost(e)};
+    });
+  return graph;
+}
+
+g::Graph<
+  g::Directionality::Directed,
+  g::AdjacencyList,
+  std::nullptr_t,
+  CapacityAndCost>
+createGraph()
+{
+  g::Graph<
+    g::Directionality::Directed,
+    g::AdjacencyList,
+    std::nullptr_t,
+    CapacityAndCost>
+    graph{};
+
+  for (g::VertexIdentifier v{0}; v < 4; ++v) {
+    G_ASSERT(graph.addVertex(v, nullptr), "Couldn't add %zu to graph.", v);
+  }
+
+  G_ASSERT(graph.addEdge(0, 1, CapacityAndCost{2, 1}), "Couldn't add %d", 0);
+  G_ASSERT(graph.addEdge(0, 2, CapacityAndCost{1, 2}), "Couldn't add %d", 1);
+  G_ASSERT(graph.addEdge(1, 2, CapacityAndCost{1, 1}), "Couldn't add %d", 2);
+  G_ASSERT(graph.addEdge(1, 3, CapacityAndCost{1, 3}), "Couldn't add %d", 3);
+  G_ASSERT(graph.addEdge(2, 3, CapacityAndCost{2, 1}), "Couldn't add %d", 4);
+  return graph;
+}
+} // anonymous namespace
+
+TEST_CASE("min cost flow should find the cheapest maximum flow")
+{
+  const auto graph{createGraph()};
+
+  for (const Engine engine :
+       {Engine::SuccessiveShortestPaths, Engine::CostScaling}) {
+    const g::algo::min_cost_flow::Result result{
+      g::algo::min_cost_flow::algorithm(graph, 0, 3, engine)};
+
+    CHECK_EQ(3, result.maxFlow());
+    CHECK_EQ(10, result.totalCost());
+    CHECK_EQ(5, result.flow().size());
+    CHECK_EQ(2, result.flow().at(g::Edge{0, 1}));
+    CHECK_EQ(1, result.flow().at(g::Edge{0, 2}));
+    CHECK_EQ(1, result.flow().at(g::Edge{1, 2}));
+    CHECK_EQ(1, result.flow().at(g::Edge{1, 3}));
+    CHECK_EQ(2, result.flow().at(g::Edge{2, 3}));
+  }
+}
+
+TEST_CASE("min cost flow should prefer edges with negative costs")
+{
+  auto graph{createGraph()};
+  REQUIRE_UNARY(graph.removeEdge(1, 3));
+  REQUIRE_UNARY(graph.addEdge(1, 3, CapacityAndCost{1, -5}));
+
+  for (const Engine engine :
+       {Engine::SuccessiveShortestPaths, Engine::CostScaling}) {
+    const g::algo::min_cost_flow::Result result{
+      g::algo::min_cost_flow::algorithm(graph, 0, 3, engine)};
+
+    CHECK_EQ(3, result.maxFlow());
+    CHECK_EQ(2, result.totalCost());
+    CHECK_UNARY(isValidFlow(graph, result, 0, 3));
+  }
+}
+
+TEST_CASE("successive shortest paths should throw on negative cost cycles")
+{
+  auto graph{createGraph()};
+  REQUIRE_UNARY(graph.addEdge(2, 1, CapacityAndCost{1, -3}));
+  CHECK_THROWS_AS(
+    (void)g::algo::min_cost_flow::algorithm(graph, 0, 3), g::GraphException);
+}
+
+TEST_CASE("min cost flow should throw if the source is the sink")
+{
+  const auto graph{createGraph()};
+
+  for (const Engine engine :
+       {Engine::SuccessiveShortestPaths, Engine::CostScaling}) {
+    CHECK_THROWS_AS(
+      (void)g::algo::min_cost_flow::algorithm(graph, 2, 2, engine),
+      g::GraphException);
+  }
+}
+
+TEST_CASE("min cost flow engines should agree on random graphs")
+{
+  std::mt19937 engine{4711}; // NOLINT
+
+  for (int i{0}; i < 25; ++i) {
+    const auto directed{
+      createRandomGraph<g::Directionality::Directed, g::AdjacencyList>(
+        engine, 12)};
+    const auto undirected{
+      createRandomGraph<g::Directionality::Undirected, g::AdjacencyMatrix>(
+        engine, 10)};
+
+    const g::algo::min_cost_flow::Result directedShortestPaths{
+      g::algo::min_cost_flow::algorithm(
+        directed, 0, 11, Engine::SuccessiveShortestPaths)};
+    const g::algo::min_cost_flow::Result directedCostScaling{
+      g::algo::min_cost_flow::algorithm(
+        directed, 0, 11, Engine::CostScaling)};
+    const g::algo::min_cost_flow::Result undirectedShortestPaths{
+      g::algo::min_cost_flow::algorithm(
+        undirected, 0, 9, Engine::SuccessiveShortestPaths)};
+    const g::algo::min_cost_flow::Result undirectedCostScaling{
+      g::algo::min_cost_flow::algorithm(
+        undirected, 0, 9, Engine::CostScaling)};
+
+    REQUIRE_UNARY(isValidFlow(directed, directedShortestPaths, 0, 11));
+    REQUIRE_UNARY(isValidFlow(directed, directedCostScaling, 0, 11));
+    REQUIRE_EQ(directedShortestPaths.maxFlow(), directedCostScaling.maxFlow());
+    REQUIRE_EQ(
+      directedShortestPaths.totalCost(), directedCostScaling.totalCost());
+    REQUIRE_UNARY(isValidFlow(undirected, undirectedShortestPaths, 0, 9));
+    REQUIRE_UNARY(isValidFlow(undirected, undirectedCostScaling, 0, 9));
+    REQUIRE_EQ(
+      undirectedShortestPaths.maxFlow(), undirectedCostScaling.maxFlow());
+    REQUIRE_EQ(
+      undirectedShortestPaths.totalCost(), undirectedCostScaling.totalCost());
+  }
+}
@@ -0,0 +1,72 @@
+#include <cstdint>
+
+#include <vector>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "algo/ford_fulkerson/minimum_cut.hpp"
+#include "algo/push_relabel/algorithm.hpp"
+
+namespace {
+using graph_type = g::Graph<
+  g::Directionality::Directed,
+  g::AdjacencyList,
+  std::nullptr_t,
+  std::int32_t>;
+
+graph_type createGraph()
+{
+  graph_type graph{};
+
+  for (g::VertexIdentifier v{0}; v <= 5; ++v) {
+    G_ASSERT(graph.addVertex(v, nullptr), "Couldn't add %zu to graph.", v);
+  }
+
+  auto addEdge{[&graph](
+                 g::VertexIdentifier source,
+                 g::VertexIdentifier target,
+                 std::int32_t        capacity) {
+    G_ASSERT(
+      graph.addEdge(source, target, capacity),
+      "Couldn't add edge from %zu to %zu to graph.",
+      source,
+      target);
+  }};
+
+  addEdge(0, 1, 16);
+  addEdge(0, 2, 13);
+  addEdge(1, 2, 10);
+  addEdge(2, 1, 4);
+  addEdge(3, 2, 9);
+  addEdge(1, 3, 12);
+  addEdge(2, 4, 14);
+  addEdge(4, 3, 7);
+  addEdge(3, 5, 20);
+  addEdge(4, 5, 4);
+
+  return graph;
+}
+} // anonymous namespace
+
+TEST_CASE("minimumCut should extract the minimum cut of a maximum flow")
+{
+  const graph_type graph{createGraph()};
+  const std::vector<g::algo::ford_fulkerson::Result> results{
+    g::algo::ford_fulkerson::algorithm(graph, 0, 5),
+    g::algo::push_relabel::algorithm(graph, 0, 5)};
+
+  for (const g::algo::ford_fulkerson::Result& result : results) {
+    const g::algo::ford_fulkerson::MinimumCut cut{
+      g::algo::ford_fulkerson::minimumCut(graph, result, 0)};
+
+    CHECK_EQ(23, cut.capacity());
+    CHECK_EQ(
+      (std::vector<g::VertexIdentifier>{0, 1, 2, 4}), cut.sourceSide());
+    CHECK_EQ(
+      (std::vector<g::Edge>{g::Edge{1, 3}, g::Edge{4, 3}, g::Edge{4, 5}}),
+      cut.cutEdges());
+    CHECK_UNARY(cut.isOnSourceSide(4));
+    CHECK_UNARY_FALSE(cut.isOnSourceSide(3));
+  }
+}
@@ -0,0 +1,115 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "algo/multi_source_bfs/algorithm.hpp"
+#include "algo/traversal.hpp"
+
+namespace {
+/*!
+ * \brief Computes the hop distances from `source` with a plain search.
+ **/
+std::vector<std::uint32_t> referenceDistances(
+  const g::algo::IndexedAdjacency& adjacency,
+  std::size_t                      source)
+{
+  struct Levels {
+    void treeArc(std::size_t from, std::size_t arc)
+    {
+      (*distance)[adjacency->target(arc)] = (*distance)[from] + 1;
+    }
+
+    const g::algo::IndexedAdjacency* adjacency;
+    std::vector<std::uint32_t>*      distance;
+  };
+
+  std::vector<std::uint32_t> distance(
+    adjacency.vertexCount(),
+    g::algo::multi_source_bfs::DistanceMatrix::unreachable);
+  distance[source] = 0;
+  g::algo::Traversal traversal{adjacency.vertexCount()};
+  traversal.breadthFirst(adjacency, source, Levels{&adjacency, &distance});
+  return distance;
+}
+} // anonymous namespace
+
+TEST_CASE("multi source BFS should compute a row per source")
+{
+  g::Graph<
+    g::Directionality::Directed,
+    g::AdjacencyList,
+    std::nullptr_t,
+    std::nullptr_t>
+    graph{};
+
+  for (g::VertexIdentifier v{10}; v < 14; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(10, 11, nullptr));
+  REQUIRE_UNARY(graph.addEdge(11, 12, nullptr));
+  REQUIRE_UNARY(graph.addEdge(13, 12, nullptr));
+
+  const g::algo::multi_source_bfs::DistanceMatrix matrix{
+    g::algo::multi_source_bfs::algorithm(graph, {10, 13, 10})};
+
+  REQUIRE_EQ(3, matrix.sources().size());
+  CHECK_EQ(13, matrix.sources()[1]);
+  CHECK_EQ(2, matrix.distance(0, 12).value());
+  CHECK_UNARY_FALSE(matrix.distance(0, 13).has_value());
+  CHECK_EQ(1, matrix.distance(1, 12).value());
+  CHECK_UNARY_FALSE(matrix.distance(1, 10).has_value());
+
+  const auto row{matrix.row(2)};
+  REQUIRE_EQ(4, row.size());
+  CHECK_EQ(0, row[0]);
+  CHECK_EQ(1, row[1]);
+  CHECK_EQ(2, row[2]);
+  CHECK_EQ(g::algo::multi_source_bfs::DistanceMatrix::unreachable, row[3]);
+}
+
+TEST_CASE("multi source BFS should agree with one search per source")
+{
+  g::Graph<
+    g::Directionality::Undirected,
+    g::AdjacencyList,
+    std::nullptr_t,
+    std::nullptr_t>
+                                             graph{};
+  std::mt19937                               engine{42};
+  std::uniform_int_distribution<std::size_t> vertex{0, 299};
+
+  for (g::VertexIdentifier v{0}; v < 300; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  for (std::size_t i{0}; i < 420; ++i) {
+    const g::VertexIdentifier source{vertex(engine)};
+    const g::VertexIdentifier target{vertex(engine)};
+
+    if (source != target) { (void)graph.addEdge(source, target, nullptr); }
+  }
+
+  // More than two words of lanes.
+  std::vector<g::VertexIdentifier> sources{};
+
+  for (std::size_t i{0}; i < 150; ++i) { sources.push_back(vertex(engine)); }
+
+  const g::algo::IndexedAdjacency adjacency{
+    g::algo::makeIndexedAdjacency(graph)};
+  const g::algo::multi_source_bfs::DistanceMatrix matrix{
+    g::algo::multi_source_bfs::algorithm(graph, sources)};
+
+  for (std::size_t i{0}; i < sources.size(); ++i) {
+    const std::vector<std::uint32_t> expected{referenceDistances(
+      adjacency, adjacency.vertexIndex().indexOf(sources[i]))};
+    const auto row{matrix.row(i)};
+    REQUIRE_UNARY(std::equal(expected.begin(), expected.end(), row.begin()));
+  }
+}
@@ -0,0 +1,34 @@
+#include <cstdint>
+
+#include <random>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "algo/push_relabel/algorithm.hpp"
+#include "algo/push_relabel/parallel_algorithm.hpp"
+#include "flow_check/is_valid_flow.hpp"
+#include "random_graph/create_graph.hpp"
+
+TEST_CASE("parallel push-relabel should agree with sequential push-relabel")
+{
+  std::mt19937 engine{4711}; // NOLINT
+
+  for (int i{0}; i < 20; ++i) {
+    const g::VertexIdentifier vertexCount{20 + 10 * static_cast<std::size_t>(i)};
+    const auto                graph{g::random_graph::createFlowNetwork<
+      g::Directionality::Directed,
+      g::AdjacencyList>(engine, vertexCount, 0.1, 50)};
+    const g::VertexIdentifier sink{vertexCount - 1};
+    const std::int32_t        expected{
+      g::algo::push_relabel::algorithm(graph, 0, sink).maxFlow()};
+
+    for (std::size_t threadCount : {1, 2, 4}) {
+      const g::algo::ford_fulkerson::Result result{
+        g::algo::push_relabel::parallelAlgorithm(
+          graph, 0, sink, threadCount)};
+      REQUIRE_EQ(expected, result.maxFlow());
+      CHECK_UNARY(g::flow_check::isValidFlow(graph, result, 0, sink));
+    }
+  }
+}
@@ -0,0 +1,119 @@
+#include <cstdint>
+
+#include <random>
+#include <sstream>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "adjacency_matrix.hpp"
+#include "algo/ford_fulkerson/algorithm.hpp"
+#include "algo/push_relabel/algorithm.hpp"
+#include "dimacs/max_flow_problem.hpp"
+#include "flow_check/is_valid_flow.hpp"
+#include "graph_exception.hpp"
+#include "random_graph/create_graph.hpp"
+
+namespace {
+const char dimacs[] = R"(c The network of the Ford-Fulkerson test.
+p max 6 10
+n 1 s
+n 6 t
+a 1 2 16
+a 1 3 13
+a 2 3 10
+a 3 2 4
+a 4 3 9
+a 2 4 12
+a 3 5 14
+a 5 4 7
+a 4 6 20
+a 5 6 4
+)";
+
+using g::flow_check::isValidFlow;
+using g::random_graph::createFlowNetwork;
+} // anonymous namespace
+
+TEST_CASE("push-relabel should find the maximum flow of a DIMACS instance")
+{
+  std::istringstream                    iss{dimacs};
+  const g::dimacs::MaxFlowProblem       problem{
+    g::dimacs::readMaxFlowProblem(iss)};
+  const g::dimacs::max_flow_graph_type& graph{problem.graph()};
+
+  REQUIRE_EQ(6, graph.vertexCount());
+  REQUIRE_EQ(10, graph.edgeCount());
+  REQUIRE_EQ(1, problem.source());
+  REQUIRE_EQ(6, problem.sink());
+
+  for (const g::algo::push_relabel::SelectionRule rule :
+       {g::algo::push_relabel::SelectionRule::HighestLabel,
+        g::algo::push_relabel::SelectionRule::Fifo}) {
+    const g::algo::ford_fulkerson::Result result{
+      g::algo::push_relabel::algorithm(
+        graph, problem.source(), problem.sink(), rule)};
+
+    CHECK_EQ(23, result.maxFlow());
+    CHECK_UNARY(isValidFlow(graph, result, problem.source(), problem.sink()));
+  }
+}
+
+TEST_CASE("reading a DIMACS instance should merge parallel arcs")
+{
+  std::istringstream iss{"p max 2 2\nn 1 s\nn 2 t\na 1 2 3\na 1 2 4\n"};
+  const g::dimacs::MaxFlowProblem problem{g::dimacs::readMaxFlowProblem(iss)};
+
+  CHECK_EQ(1, problem.graph().edgeCount());
+  CHECK_EQ(7, problem.graph().fetchEdgeData(1, 2));
+}
+
+TEST_CASE("reading a malformed DIMACS instance should throw")
+{
+  std::istringstream iss{"p max 2 1\nn 1 s\na 1 2 3\n"};
+  CHECK_THROWS_AS(
+    (void)g::dimacs::readMaxFlowProblem(iss), g::GraphException);
+}
+
+TEST_CASE("push-relabel should agree with Ford-Fulkerson on random graphs")
+{
+  std::mt19937 engine{20211}; // NOLINT
+
+  for (int i{0}; i < 25; ++i) {
+    const auto directed{
+      createFlowNetwork<g::Directionality::Directed, g::AdjacencyList>(
+        engine, 12)};
+    const auto undirected{
+      createFlowNetwork<g::Directionality::Undirected, g::AdjacencyMatrix>(
+        engine, 10)};
+
+    const std::int32_t expectedDirected{
+      g::algo::ford_fulkerson::algorithm(directed, 0, 11).maxFlow()};
+    const std::int32_t expectedUndirected{
+      g::algo::ford_fulkerson::algorithm(undirected, 0, 9).maxFlow()};
+
+    for (const g::algo::push_relabel::SelectionRule rule :
+         {g::algo::push_relabel::SelectionRule::HighestLabel,
+          g::algo::push_relabel::SelectionRule::Fifo}) {
+      const g::algo::ford_fulkerson::Result directedResult{
+        g::algo::push_relabel::algorithm(directed, 0, 11, rule)};
+      const g::algo::ford_fulkerson::Result undirectedResult{
+        g::algo::push_relabel::algorithm(undirected, 0, 9, rule)};
+
+      REQUIRE_EQ(expectedDirected, directedResult.maxFlow());
+      REQUIRE_UNARY(isValidFlow(directed, directedResult, 0, 11));
+      REQUIRE_EQ(expectedUndirected, undirectedResult.maxFlow());
+      REQUIRE_UNARY(isValidFlow(undirected, undirectedResult, 0, 9));
+    }
+  }
+}
+
+TEST_CASE("push-relabel should throw if the source is the sink")
+{
+  std::mt19937 engine{1};
+  const auto   graph{
+    createFlowNetwork<g::Directionality::Directed, g::AdjacencyList>(
+      engine, 3)};
+  CHECK_THROWS_AS(
+    (void)g::algo::push_relabel::algorithm(graph, 1, 1), g::GraphException);
+}
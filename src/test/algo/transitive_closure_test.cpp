@@ -0,0 +1,137 @@
+#include <cstddef>
+
+#include <random>
+#include <vector>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "algo/transitive_closure/algorithm.hpp"
+#include "algo/traversal.hpp"
+#include "graph_exception.hpp"
+
+namespace {
+using DirectedGraph = g::Graph<
+  g::Directionality::Directed,
+  g::AdjacencyList,
+  std::nullptr_t,
+  std::nullptr_t>;
+
+/*!
+ * \brief Finds the vertices reachable from `source` with a plain search.
+ **/
+std::vector<bool> referenceReachables(
+  const g::algo::IndexedAdjacency& adjacency,
+  std::size_t                      source)
+{
+  struct Marker {
+    void discoverVertex(std::size_t vertex) { (*reached)[vertex] = true; }
+
+    std::vector<bool>* reached;
+  };
+
+  std::vector<bool>  reached(adjacency.vertexCount(), false);
+  g::algo::Traversal traversal{adjacency.vertexCount()};
+  traversal.depthFirst(adjacency, source, Marker{&reached});
+  return reached;
+}
+
+/*!
+ * \brief Checks every pair of vertices of `graph` against a search.
+ **/
+void checkAgainstSearches(const DirectedGraph& graph)
+{
+  const g::algo::IndexedAdjacency adjacency{
+    g::algo::makeIndexedAdjacency(graph)};
+  const g::algo::transitive_closure::TransitiveClosure closure{
+    g::algo::transitive_closure::algorithm(graph)};
+
+  for (std::size_t source{0}; source < adjacency.vertexCount(); ++source) {
+    const std::vector<bool> expected{referenceReachables(adjacency, source)};
+
+    for (std::size_t target{0}; target < adjacency.vertexCount(); ++target) {
+      REQUIRE_EQ(expected[target], closure.reachesByIndex(source, target));
+    }
+  }
+}
+} // anonymous namespace
+
+TEST_CASE("transitive closure should merge strongly connected components")
+{
+  DirectedGraph graph{};
+
+  for (g::VertexIdentifier v{1}; v <= 6; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  // {1, 2, 3} -> {4, 5}, 6 on its own.
+  REQUIRE_UNARY(graph.addEdge(1, 2, nullptr));
+  REQUIRE_UNARY(graph.addEdge(2, 3, nullptr));
+  REQUIRE_UNARY(graph.addEdge(3, 1, nullptr));
+  REQUIRE_UNARY(graph.addEdge(3, 4, nullptr));
+  REQUIRE_UNARY(graph.addEdge(4, 5, nullptr));
+  REQUIRE_UNARY(graph.addEdge(5, 4, nullptr));
+
+  const g::algo::transitive_closure::TransitiveClosure closure{
+    g::algo::transitive_closure::algorithm(graph)};
+  const g::algo::VertexIndex& index{closure.vertexIndex()};
+
+  CHECK_EQ(3, closure.componentCount());
+  CHECK_EQ(
+    closure.componentOf(index.indexOf(1)),
+    closure.componentOf(index.indexOf(3)));
+  CHECK_UNARY(
+    closure.componentOf(index.indexOf(1))
+    > closure.componentOf(index.indexOf(4)));
+
+  CHECK_UNARY(closure.reaches(2, 1));
+  CHECK_UNARY(closure.reaches(1, 5));
+  CHECK_UNARY(closure.reaches(5, 4));
+  CHECK_UNARY(closure.reaches(6, 6));
+  CHECK_UNARY_FALSE(closure.reaches(4, 3));
+  CHECK_UNARY_FALSE(closure.reaches(1, 6));
+  CHECK_UNARY_FALSE(closure.reaches(6, 1));
+  CHECK_THROWS_AS((void)closure.reaches(1, 7), g::GraphException);
+}
+
+TEST_CASE("transitive closure should agree with searches on sparse graphs")
+{
+  DirectedGraph                              graph{};
+  std::mt19937                               engine{7};
+  std::uniform_int_distribution<std::size_t> vertex{0, 399};
+
+  for (g::VertexIdentifier v{0}; v < 400; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  for (std::size_t i{0}; i < 500; ++i) {
+    (void)graph.addEdge(vertex(engine), vertex(engine), nullptr);
+  }
+
+  checkAgainstSearches(graph);
+}
+
+TEST_CASE("transitive closure should agree with searches on dense DAGs")
+{
+  // Enough arcs into every group of components to use the subset tables.
+  DirectedGraph               graph{};
+  std::mt19937                engine{11};
+  std::bernoulli_distribution hasEdge{0.5};
+
+  for (g::VertexIdentifier v{0}; v < 150; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  for (g::VertexIdentifier source{0}; source < 150; ++source) {
+    for (g::VertexIdentifier target{source + 1}; target < 150; ++target) {
+      if (hasEdge(engine)) {
+        REQUIRE_UNARY(graph.addEdge(source, target, nullptr));
+      }
+    }
+  }
+
+  // A cycle through the middle merges some of the vertices.
+  REQUIRE_UNARY(graph.addEdge(90, 60, nullptr));
+
+  checkAgainstSearches(graph);
+}
@@ -0,0 +1,185 @@
+#include <cstddef>
+
+#include <algorithm>
+#include <vector>
+
+#include <doctest.h>
+
+#include "algo/indexed_adjacency.hpp"
+#include "algo/traversal.hpp"
+
+namespace {
+/*!
+ * \brief An event of a search. `target` is only used by tree arcs.
+ **/
+struct Event {
+  char        kind; /*!< 'd'iscover, 't'ree arc or 'f'inish */
+  std::size_t vertex;
+  std::size_t target{0};
+
+  friend bool operator==(const Event& lhs, const Event& rhs) = default;
+};
+
+/*!
+ * \brief Records every event.
+ **/
+struct Recorder {
+  void discoverVertex(std::size_t vertex)
+  {
+    events.push_back(Event{'d', vertex});
+  }
+
+  void treeArc(std::size_t source, std::size_t arc)
+  {
+    events.push_back(Event{'t', source, adjacency->target(arc)});
+  }
+
+  void finishVertex(std::size_t vertex)
+  {
+    events.push_back(Event{'f', vertex});
+  }
+
+  const g::algo::IndexedAdjacency* adjacency;
+  std::vector<Event>               events;
+};
+
+g::algo::IndexedAdjacency makeAdjacency()
+{
+  // 0 -> 1 -> 3, 0 -> 2 -> 3, 4 alone.
+  return g::algo::IndexedAdjacency{
+    g::algo::VertexIndex{{0, 1, 2, 3, 4}},
+    {g::Edge{0, 1}, g::Edge{0, 2}, g::Edge{1, 3}, g::Edge{2, 3}},
+    g::Directionality::Directed};
+}
+} // anonymous namespace
+
+TEST_CASE("breadth first search should visit by distance")
+{
+  const g::algo::IndexedAdjacency adjacency{makeAdjacency()};
+  g::algo::Traversal              traversal{adjacency.vertexCount()};
+  Recorder                        recorder{&adjacency, {}};
+
+  CHECK_EQ(
+    g::algo::Step::Continue,
+    traversal.breadthFirst(adjacency, 0, recorder));
+  CHECK_EQ(
+    (std::vector<Event>{
+      {'d', 0},
+      {'t', 0, 1},
+      {'d', 1},
+      {'t', 0, 2},
+      {'d', 2},
+      {'f', 0},
+      {'t', 1, 3},
+      {'d', 3},
+      {'f', 1},
+      {'f', 2},
+      {'f', 3}}),
+    recorder.events);
+  CHECK_UNARY(traversal.isVisited(3));
+  CHECK_UNARY_FALSE(traversal.isVisited(4));
+}
+
+TEST_CASE("depth first search should finish in recursive order")
+{
+  const g::algo::IndexedAdjacency adjacency{makeAdjacency()};
+  g::algo::Traversal              traversal{adjacency.vertexCount()};
+  Recorder                        recorder{&adjacency, {}};
+
+  traversal.depthFirst(adjacency, 0, recorder);
+
+  CHECK_EQ(
+    (std::vector<Event>{
+      {'d', 0},
+      {'t', 0, 1},
+      {'d', 1},
+      {'t', 1, 3},
+      {'d', 3},
+      {'f', 3},
+      {'f', 1},
+      {'t', 0, 2},
+      {'d', 2},
+      {'f', 2},
+      {'f', 0}}),
+    recorder.events);
+}
+
+TEST_CASE("traversal should skip arcs rejected by the visitor and stop early")
+{
+  const g::algo::IndexedAdjacency adjacency{makeAdjacency()};
+  g::algo::Traversal              traversal{adjacency.vertexCount()};
+
+  struct SkipVertex1 {
+    bool examineArc(std::size_t, std::size_t arc) const
+    {
+      return adjacency->target(arc) != 1;
+    }
+
+    const g::algo::IndexedAdjacency* adjacency;
+  };
+
+  traversal.breadthFirst(adjacency, 0, SkipVertex1{&adjacency});
+  CHECK_UNARY_FALSE(traversal.isVisited(1));
+  CHECK_UNARY(traversal.isVisited(3));
+
+  struct StopAt2 {
+    g::algo::Step discoverVertex(std::size_t vertex) const
+    {
+      return vertex == 2 ? g::algo::Step::Stop : g::algo::Step::Continue;
+    }
+  };
+
+  traversal.reset();
+  CHECK_UNARY_FALSE(traversal.isVisited(0));
+  CHECK_EQ(
+    g::algo::Step::Stop, traversal.depthFirst(adjacency, 0, StopAt2{}));
+  CHECK_UNARY(traversal.isVisited(2));
+}
+
+TEST_CASE("traversal should keep vertices visited across searches")
+{
+  const g::algo::IndexedAdjacency adjacency{makeAdjacency()};
+  g::algo::Traversal              traversal{adjacency.vertexCount()};
+  std::size_t                     componentCount{0};
+
+  for (std::size_t vertex{0}; vertex < adjacency.vertexCount(); ++vertex) {
+    if (!traversal.isVisited(vertex)) {
+      ++componentCount;
+      traversal.depthFirst(adjacency, vertex);
+    }
+  }
+
+  CHECK_EQ(2, componentCount);
+}
+
+TEST_CASE("depth first search should not overflow the stack on long chains")
+{
+  constexpr std::size_t            vertexCount{1000000};
+  std::vector<g::VertexIdentifier> vertices(vertexCount);
+  std::vector<g::Edge>             edges{};
+
+  for (std::size_t i{0}; i < vertexCount; ++i) {
+    vertices[i] = i;
+
+    if (i != 0) { edges.emplace_back(i - 1, i); }
+  }
+
+  const g::algo::IndexedAdjacency adjacency{
+    g::algo::VertexIndex{vertices}, edges, g::Directionality::Undirected};
+  g::algo::Traversal traversal{vertexCount};
+  std::size_t        depth{0};
+
+  struct Deepest {
+    void discoverVertex(std::size_t) { *depth = std::max(*depth, ++current); }
+
+    void finishVertex(std::size_t) { --current; }
+
+    std::size_t* depth;
+    std::size_t  current;
+  };
+
+  traversal.depthFirst(adjacency, 0, Deepest{&depth, 0});
+
+  CHECK_EQ(vertexCount, depth);
+  CHECK_UNARY(traversal.isVisited(vertexCount - 1));
+}
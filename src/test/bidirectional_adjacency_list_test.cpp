@@ -0,0 +1,72 @@
+#include <doctest.h>
+
+#include "bidirectional_adjacency_list.hpp"
+
+TEST_CASE("(BidirectionalAdjacencyList, ShouldConstructEmptyList)")
+{
+  g::BidirectionalAdjacencyList list{};
+
+  for (g::VertexIdentifier i{0}; i < 10; ++i) {
+    for (g::VertexIdentifier j{0}; j < 10; ++j) {
+      REQUIRE_FALSE(list.isDirectlyReachable(i, j));
+    }
+
+    REQUIRE_UNARY(list.directlyReachables(i).empty());
+    REQUIRE_UNARY(list.incoming(i).empty());
+    REQUIRE_EQ(0, list.inDegree(i));
+  }
+}
+
+TEST_CASE("(BidirectionalAdjacencyList, ShouldKeepIncomingInSync)")
+{
+  g::BidirectionalAdjacencyList list{};
+  list.addTo(1, 2);
+  list.addTo(3, 2);
+  list.addTo(3, 2);
+
+  CHECK_UNARY(list.isDirectlyReachable(1, 2));
+  CHECK_FALSE(list.isDirectlyReachable(2, 1));
+  CHECK_EQ((std::vector<g::VertexIdentifier>{1, 3}), list.incoming(2));
+  CHECK_EQ(2, list.inDegree(2));
+
+  list.removeAdjacentFrom(1, 2);
+  CHECK_FALSE(list.isDirectlyReachable(1, 2));
+  CHECK_EQ((std::vector<g::VertexIdentifier>{3}), list.incoming(2));
+
+  list.removeAdjacentFrom(5, 7);
+  CHECK_EQ(1, list.inDegree(2));
+}
+
+TEST_CASE("(BidirectionalAdjacencyList, ShouldRemoveAllEdgesOfAVertex)")
+{
+  g::BidirectionalAdjacencyList list{};
+  list.addTo(1, 2);
+  list.addTo(2, 3);
+  list.addTo(2, 2);
+  list.addTo(4, 2);
+  list.addTo(4, 3);
+
+  list.removeVertex(2);
+
+  CHECK_UNARY(list.directlyReachables(1).empty());
+  CHECK_UNARY(list.directlyReachables(2).empty());
+  CHECK_UNARY(list.incoming(2).empty());
+  CHECK_EQ((std::vector<g::VertexIdentifier>{3}), list.directlyReachables(4));
+  CHECK_EQ((std::vector<g::VertexIdentifier>{4}), list.incoming(3));
+}
+
+TEST_CASE("(BidirectionalAdjacencyList, ShouldBeAbleToSwap)")
+{
+  g::BidirectionalAdjacencyList list1{};
+  g::BidirectionalAdjacencyList list2{};
+  list1.addTo(1, 2);
+  list2.addTo(3, 4);
+
+  swap(list1, list2);
+
+  CHECK_UNARY(list1.isDirectlyReachable(3, 4));
+  CHECK_EQ(1, list2.inDegree(2));
+
+  list2.clear();
+  CHECK_EQ(0, list2.inDegree(2));
+}
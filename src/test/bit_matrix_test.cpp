@@ -0,0 +1,116 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <bit>
+#include <random>
+#include <vector>
+
+#include <doctest.h>
+
+#include "assertion_violation_exception.hpp"
+#include "bit_matrix.hpp"
+
+TEST_CASE("(BitMatrix, ShouldConstructClearedMatrix)")
+{
+  const g::BitMatrix matrix{3, 70};
+
+  CHECK_EQ(3, matrix.rowCount());
+  CHECK_EQ(70, matrix.columnCount());
+  CHECK_EQ(g::BitMatrix::wordsPerBlock, matrix.wordsPerRow());
+
+  for (std::size_t row{0}; row < matrix.rowCount(); ++row) {
+    CHECK_EQ(0, g::countOnes(matrix.row(row)));
+  }
+}
+
+TEST_CASE("(BitMatrix, ShouldEnumerateSetBitsInOrder)")
+{
+  g::BitMatrix matrix{2, 300};
+  matrix.set(1, 299);
+  matrix.set(1, 0);
+  matrix.set(1, 64);
+  matrix.set(1, 63);
+  matrix.set(0, 5);
+  matrix.reset(0, 5);
+
+  std::vector<std::size_t> columns{};
+  matrix.forEachInRow(1, [&columns](std::size_t c) { columns.push_back(c); });
+
+  CHECK_EQ((std::vector<std::size_t>{0, 63, 64, 299}), columns);
+  CHECK_UNARY(matrix.test(1, 64));
+  CHECK_FALSE(matrix.test(0, 5));
+  CHECK_EQ(4, g::countOnes(matrix.row(1)));
+}
+
+TEST_CASE("(BitMatrix, ShouldKeepBitsWhenResized)")
+{
+  g::BitMatrix matrix{};
+
+  // Grows one column at a time, moving the rows whenever the stride grows.
+  for (std::size_t i{0}; i < 600; ++i) {
+    matrix.resize(i + 1, i + 1);
+    matrix.set(i, i);
+    matrix.set(i / 2, i);
+  }
+
+  for (std::size_t i{0}; i < 600; ++i) {
+    REQUIRE_UNARY(matrix.test(i, i));
+    REQUIRE_UNARY(matrix.test(i / 2, i));
+  }
+
+  CHECK_EQ(0, matrix.wordsPerRow() % g::BitMatrix::wordsPerBlock);
+
+  matrix.resize(10, 5);
+  CHECK_UNARY(matrix.test(2, 4));
+  CHECK_EQ(2, g::countOnes(matrix.row(2)));
+
+  matrix.resize(600, 600);
+  CHECK_FALSE(matrix.test(2, 5));
+  CHECK_FALSE(matrix.test(300, 300));
+
+  g::BitMatrix other{1, 1};
+  swap(matrix, other);
+  CHECK_EQ(1, matrix.rowCount());
+  CHECK_UNARY(other.test(2, 4));
+
+  other.clear();
+  CHECK_EQ(0, other.rowCount());
+}
+
+TEST_CASE("(BitMatrix, RowOperationsShouldMatchWordByWordResults)")
+{
+  std::mt19937_64                      engine{7};
+  std::vector<g::BitMatrix::word_type> lhs(37);
+  std::vector<g::BitMatrix::word_type> rhs(37);
+
+  for (std::size_t i{0}; i < lhs.size(); ++i) {
+    lhs[i] = engine();
+    rhs[i] = engine();
+  }
+
+  std::size_t                          lhsOnes{0};
+  std::size_t                          commonOnes{0};
+  std::vector<g::BitMatrix::word_type> ored{lhs};
+  std::vector<g::BitMatrix::word_type> anded{lhs};
+
+  for (std::size_t i{0}; i < lhs.size(); ++i) {
+    lhsOnes += static_cast<std::size_t>(std::popcount(lhs[i]));
+    commonOnes += static_cast<std::size_t>(std::popcount(lhs[i] & rhs[i]));
+    ored[i] |= rhs[i];
+    anded[i] &= rhs[i];
+  }
+
+  CHECK_EQ(lhsOnes, g::countOnes(lhs));
+  CHECK_EQ(commonOnes, g::countCommonOnes(lhs, rhs));
+
+  std::vector<g::BitMatrix::word_type> destination{lhs};
+  g::orInto(destination, rhs);
+  CHECK_EQ(ored, destination);
+
+  destination = lhs;
+  g::andInto(destination, rhs);
+  CHECK_EQ(anded, destination);
+
+  std::vector<g::BitMatrix::word_type> shorter(3);
+  CHECK_THROWS_AS(g::orInto(shorter, rhs), g::AssertionViolationException);
+}
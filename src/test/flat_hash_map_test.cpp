@@ -0,0 +1,179 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <iterator>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <doctest.h>
+
+#include "edge.hpp"
+#include "flat_hash_map.hpp"
+
+namespace {
+/*!
+ * \brief Maps every key to the same hash, so that every key probes the same
+ *        slots.
+ **/
+struct ConstantHash {
+  std::size_t operator()(int) const noexcept { return 0; }
+};
+
+template<typename Map>
+bool equals(const Map& map, const std::unordered_map<int, int>& expected)
+{
+  if (map.size() != expected.size()) { return false; }
+
+  std::size_t count{0};
+
+  for (const auto& [key, value] : map) {
+    const auto it{expected.find(key)};
+
+    if (it == expected.end() || it->second != value) { return false; }
+
+    ++count;
+  }
+
+  return count == expected.size();
+}
+
+template<typename Map>
+void checkRandomOperations(std::size_t operationCount, int keyCount)
+{
+  Map                                map{};
+  std::unordered_map<int, int>       expected{};
+  std::mt19937                       engine{5489U};
+  std::uniform_int_distribution<int> keys{0, keyCount - 1};
+
+  for (std::size_t i{0}; i < operationCount; ++i) {
+    const int key{keys(engine)};
+
+    if (engine() % 3 == 0) {
+      CHECK_EQ(expected.erase(key), map.erase(key));
+    }
+    else {
+      const auto [it, inserted]{map.emplace(key, static_cast<int>(i))};
+      const auto [expectedIt, expectedInserted]{
+        expected.emplace(key, static_cast<int>(i))};
+      CHECK_EQ(expectedInserted, inserted);
+      CHECK_EQ(expectedIt->second, it->second);
+    }
+  }
+
+  CHECK_UNARY(equals(map, expected));
+
+  for (int key{0}; key < keyCount; ++key) {
+    CHECK_EQ(expected.count(key) == 1, map.contains(key));
+  }
+}
+} // anonymous namespace
+
+TEST_CASE("(FlatHashMap, ShouldInsertFindAndErase)")
+{
+  g::FlatHashMap<int, std::string> map{};
+  CHECK_UNARY(map.empty());
+  CHECK_EQ(0, map.capacity());
+  CHECK_UNARY(map.find(1) == map.end());
+  CHECK_UNARY(map.begin() == map.end());
+
+  CHECK_UNARY(map.emplace(1, "one").second);
+  CHECK_UNARY(map.emplace(2, "two").second);
+  const auto [it, inserted]{map.emplace(1, "uno")};
+  CHECK_UNARY_FALSE(inserted);
+  CHECK_EQ("one", it->second);
+  CHECK_EQ(2, map.size());
+  CHECK_EQ(16, map.capacity());
+
+  map.find(2)->second = "dos";
+  CHECK_EQ("dos", map.find(2)->second);
+
+  CHECK_EQ(1, map.erase(1));
+  CHECK_EQ(0, map.erase(1));
+  CHECK_UNARY_FALSE(map.contains(1));
+  CHECK_EQ(1, map.size());
+
+  map.clear();
+  CHECK_UNARY(map.empty());
+  CHECK_EQ(16, map.capacity());
+}
+
+TEST_CASE("(FlatHashMap, ShouldBehaveLikeAnUnorderedMap)")
+{
+  checkRandomOperations<g::FlatHashMap<int, int>>(100'000, 5'000);
+}
+
+TEST_CASE("(FlatHashMap, ShouldReuseDeletedSlotsOfCollidingKeys)")
+{
+  // Every key lands in the same group, so erasing leaves deleted slots that
+  // probes have to skip.
+  checkRandomOperations<g::FlatHashMap<int, int, ConstantHash>>(20'000, 100);
+}
+
+TEST_CASE("(FlatHashMap, ShouldNotGrowWhenChurning)")
+{
+  g::FlatHashMap<int, int> map{};
+  map.reserve(100);
+  const std::size_t capacity{map.capacity()};
+  CHECK_UNARY(capacity >= 100);
+
+  for (int i{0}; i < 100'000; ++i) {
+    REQUIRE_UNARY(map.emplace(i, i).second);
+
+    if (i >= 50) { REQUIRE_EQ(1, map.erase(i - 50)); }
+  }
+
+  CHECK_EQ(50, map.size());
+  CHECK_EQ(capacity, map.capacity());
+}
+
+TEST_CASE("(FlatHashMap, ShouldCopyMoveAndCompare)")
+{
+  g::FlatHashMap<g::Edge, int> map{};
+
+  for (g::VertexIdentifier i{0}; i < 1'000; ++i) {
+    REQUIRE_UNARY(map.emplace(g::Edge{i, i + 1}, static_cast<int>(i)).second);
+  }
+
+  g::FlatHashMap<g::Edge, int> copy{map};
+  CHECK_UNARY(copy == map);
+
+  copy.find(g::Edge{3, 4})->second = -1;
+  CHECK_UNARY_FALSE(copy == map);
+  CHECK_EQ(3, map.find(g::Edge{3, 4})->second);
+
+  g::FlatHashMap<g::Edge, int> moved{std::move(copy)};
+  CHECK_EQ(1'000, moved.size());
+  CHECK_EQ(-1, moved.find(g::Edge{3, 4})->second);
+
+  copy = moved;
+  CHECK_UNARY(copy == moved);
+
+  std::size_t count{0};
+
+  for (auto it{moved.begin()}; it != moved.end();) {
+    it = it->first.source() % 2 == 0 ? moved.erase(it) : std::next(it);
+    ++count;
+  }
+
+  CHECK_EQ(1'000, count);
+  CHECK_EQ(500, moved.size());
+  CHECK_UNARY(moved.contains(g::Edge{1, 2}));
+  CHECK_UNARY_FALSE(moved.contains(g::Edge{2, 3}));
+}
+
+TEST_CASE("(FlatHashMap, ShouldHashEdgesWithLargeIdentifiers)")
+{
+  g::FlatHashMap<g::Edge, int> map{};
+  const g::VertexIdentifier    large{g::VertexIdentifier{1} << 40};
+
+  REQUIRE_UNARY(map.emplace(g::Edge{large, 1}, 1).second);
+  REQUIRE_UNARY(map.emplace(g::Edge{1, large}, 2).second);
+  REQUIRE_UNARY(map.emplace(g::Edge{large + 1, 0}, 3).second);
+
+  CHECK_EQ(1, map.find(g::Edge{large, 1})->second);
+  CHECK_EQ(2, map.find(g::Edge{1, large})->second);
+  CHECK_EQ(3, map.find(g::Edge{large + 1, 0})->second);
+  CHECK_UNARY_FALSE(map.contains(g::Edge{0, large + 1}));
+}
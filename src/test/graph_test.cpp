@@ -7,28 +7,48 @@
 #include <iostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "adjacency_list.hpp"
 #include "adjacency_matrix.hpp"
+#include "bidirectional_adjacency_list.hpp"
+#include "flat_hash_map.hpp"
 #include "graph.hpp"
+#include "small_adjacency_list.hpp"
+#include "sorted_adjacency_list.hpp"
 
 using VertexData = std::string;
 using EdgeData   = int;
 
-#define TMPL template<typename Implementation>
-
-TMPL using DirectedGraph
-  = g::Graph<g::Directionality::Directed, Implementation, VertexData, EdgeData>;
-
-TMPL using UndirectedGraph = g::
-  Graph<g::Directionality::Undirected, Implementation, VertexData, EdgeData>;
-
-#define DGRAPH DirectedGraph<Implementation>
-#define UDGRAPH UndirectedGraph<Implementation>
-
-#define CALL_TEST(TestFunction)     \
-  TestFunction<g::AdjacencyList>(); \
-  TestFunction<g::AdjacencyMatrix>()
+#define TMPL template<typename Implementation, typename Maps>
+
+template<typename Implementation, typename Maps = g::StdHashMaps>
+using DirectedGraph = g::Graph<
+  g::Directionality::Directed,
+  Implementation,
+  VertexData,
+  EdgeData,
+  Maps>;
+
+template<typename Implementation, typename Maps = g::StdHashMaps>
+using UndirectedGraph = g::Graph<
+  g::Directionality::Undirected,
+  Implementation,
+  VertexData,
+  EdgeData,
+  Maps>;
+
+#define DGRAPH DirectedGraph<Implementation, Maps>
+#define UDGRAPH UndirectedGraph<Implementation, Maps>
+
+#define CALL_TEST(TestFunction)                                  \
+  TestFunction<g::AdjacencyList, g::StdHashMaps>();              \
+  TestFunction<g::AdjacencyMatrix, g::StdHashMaps>();            \
+  TestFunction<g::BidirectionalAdjacencyList, g::StdHashMaps>(); \
+  TestFunction<g::SmallAdjacencyList, g::StdHashMaps>();         \
+  TestFunction<g::SortedAdjacencyList, g::StdHashMaps>();        \
+  TestFunction<g::AdjacencyList, g::FlatHashMaps>();             \
+  TestFunction<g::BidirectionalAdjacencyList, g::FlatHashMaps>()
 
 #define IMPL_TEST(TestName) \
   TEST_CASE("Graph" #TestName) { CALL_TEST(TestName##Test); }
@@ -656,6 +676,38 @@ GRAPH_TEST(ShouldBeAbleToGetEdgeDataBothWaysWithAnUndirectedGraph)
   CHECK_EQ(56456456, *data2);
 }
 
+GRAPH_TEST(ShouldStoreEachEdgeOfAnUndirectedGraphOnce)
+{
+  UDGRAPH g{};
+  REQUIRE_UNARY(g.addVertex(1, "one"));
+  REQUIRE_UNARY(g.addVertex(2, "two"));
+  REQUIRE_UNARY(g.addVertex(3, "three"));
+  REQUIRE_UNARY(g.addEdge(2, 1, 21));
+  REQUIRE_UNARY(g.addEdge(3, 3, 33));
+  CHECK_FALSE(g.addEdge(1, 2, 12));
+
+  CHECK_EQ(2, g.m_edgeMap.size());
+  CHECK_EQ(2, g.edgeCount());
+  CHECK_EQ(21, g.m_edgeMap.find(g::Edge{1, 2})->second);
+  CHECK_UNARY(g.m_edgeMap.find(g::Edge{2, 1}) == g.m_edgeMap.end());
+
+  std::vector<g::Edge> edges{g.edges()};
+  std::sort(edges.begin(), edges.end());
+  CHECK_EQ((std::vector<g::Edge>{g::Edge{1, 2}, g::Edge{3, 3}}), edges);
+
+  std::vector<g::Edge> arcs{g.edgesUndirectedWithReverseEdges()};
+  std::sort(arcs.begin(), arcs.end());
+  CHECK_EQ(
+    (std::vector<g::Edge>{g::Edge{1, 2}, g::Edge{2, 1}, g::Edge{3, 3}}), arcs);
+
+  CHECK_UNARY(g.removeEdge(3, 3));
+  CHECK_FALSE(g.removeEdge(3, 3));
+  CHECK_FALSE(g.isDirectlyReachable(3, 3));
+  CHECK_UNARY(g.removeVertex(2));
+  CHECK_FALSE(g.hasEdges());
+  CHECK_EQ(0, g.edgeCount());
+}
+
 GRAPH_TEST(ShouldBeAbleToFetchEdgeIteratorBothWaysInAnUndirectedGraph)
 {
   UDGRAPH g{};
@@ -758,6 +810,41 @@ GRAPH_TEST(ShouldRemoveAllIncidentEdgesWhenGraphIsUndirected)
   CHECK(expected == edges);
 }
 
+GRAPH_TEST(ShouldAddEdgesInABatch)
+{
+  const std::vector<std::pair<g::VertexIdentifier, EdgeData>> edges{
+    {3, 13}, {1, 11}, {2, 12}, {3, 99}, {7, 17}};
+
+  DGRAPH directed{};
+  UDGRAPH undirected{};
+
+  for (g::VertexIdentifier i{1}; i <= 3; ++i) {
+    REQUIRE_UNARY(directed.addVertex(i, std::to_string(i)));
+    REQUIRE_UNARY(undirected.addVertex(i, std::to_string(i)));
+  }
+
+  REQUIRE_UNARY(directed.addEdge(1, 2, 0));
+  REQUIRE_UNARY(undirected.addEdge(2, 1, 0));
+
+  CHECK_EQ(0, directed.addEdges(7, edges));
+  CHECK_EQ(2, directed.addEdges(1, edges));
+  CHECK_EQ(3, directed.edgeCount());
+  CHECK_EQ(13, directed.fetchEdgeData(1, 3).value());
+  CHECK_EQ(11, directed.fetchEdgeData(1, 1).value());
+  CHECK_EQ(0, directed.fetchEdgeData(1, 2).value());
+  CHECK_UNARY_FALSE(directed.hasEdge(3, 1));
+  CHECK_EQ(3, directed.directlyReachables(1).size());
+
+  CHECK_EQ(2, undirected.addEdges(1, edges));
+  CHECK_EQ(3, undirected.edgeCount());
+  CHECK_EQ(13, undirected.fetchEdgeData(3, 1).value());
+  CHECK_UNARY(undirected.hasEdge(1, 1));
+  CHECK_EQ(
+    (std::vector<g::VertexIdentifier>{1}), undirected.directlyReachables(3));
+  CHECK_EQ(2, undirected.addEdges(3, edges));
+  CHECK_EQ(2, undirected.directlyReachables(2).size());
+}
+
 GRAPH_TEST(ShouldSustianRandomizedTestOnDirectedGraph)
 {
   DGRAPH g{};
@@ -838,3 +925,74 @@ GRAPH_TEST(ShouldSustianRandomizedTestOnUndirectedGraph)
 
   CHECK_UNARY(true);
 }
+
+TEST_CASE("Graph should hand batches to implementations that take them")
+{
+  static_assert(g::BatchInsertable<g::SortedAdjacencyList>);
+  static_assert(!g::BatchInsertable<g::AdjacencyList>);
+
+  DirectedGraph<g::SortedAdjacencyList> g{};
+
+  for (int i{0}; i < 100; ++i) {
+    REQUIRE_UNARY(g.addVertex(i, std::to_string(i)));
+  }
+
+  std::vector<std::pair<g::VertexIdentifier, EdgeData>> edges{};
+
+  for (int i{99}; i >= 0; i -= 3) { edges.emplace_back(i, i); }
+
+  CHECK_EQ(34, g.addEdges(5, edges));
+  CHECK_EQ(34, g.edgeCount());
+  const std::vector<g::VertexIdentifier> targets{g.directlyReachables(5)};
+  REQUIRE_EQ(34, targets.size());
+  CHECK_UNARY(std::is_sorted(targets.begin(), targets.end()));
+  CHECK_EQ(42, g.fetchEdgeData(5, 42).value());
+}
+
+TEST_CASE("Graph should answer incoming queries with an in-adjacency index")
+{
+  DirectedGraph<g::BidirectionalAdjacencyList> g{};
+
+  for (int i{1}; i <= 4; ++i) {
+    REQUIRE_UNARY(g.addVertex(i, std::to_string(i)));
+  }
+
+  REQUIRE_UNARY(g.addEdge(1, 3, 13));
+  REQUIRE_UNARY(g.addEdge(2, 3, 23));
+  REQUIRE_UNARY(g.addEdge(3, 4, 34));
+  REQUIRE_UNARY(g.addEdge(4, 4, 44));
+
+  CHECK_EQ((std::vector<g::VertexIdentifier>{1, 2}), g.incoming(3));
+  CHECK_EQ(2, g.inDegree(3));
+  CHECK_EQ(0, g.inDegree(1));
+  CHECK_EQ((std::vector<g::VertexIdentifier>{3, 4}), g.incoming(4));
+
+  REQUIRE_UNARY(g.removeEdge(1, 3));
+  CHECK_EQ((std::vector<g::VertexIdentifier>{2}), g.incoming(3));
+
+  REQUIRE_UNARY(g.removeVertex(4));
+  CHECK_EQ(1, g.edgeCount());
+  CHECK_UNARY(g.hasEdge(2, 3));
+  CHECK_UNARY(g.directlyReachables(3).empty());
+  CHECK_EQ(0, g.inDegree(4));
+}
+
+TEST_CASE("Graph should keep the in-adjacency of undirected graphs symmetric")
+{
+  UndirectedGraph<g::BidirectionalAdjacencyList> g{};
+
+  for (int i{1}; i <= 3; ++i) {
+    REQUIRE_UNARY(g.addVertex(i, std::to_string(i)));
+  }
+
+  REQUIRE_UNARY(g.addEdge(1, 2, 12));
+  REQUIRE_UNARY(g.addEdge(3, 2, 32));
+
+  CHECK_EQ((std::vector<g::VertexIdentifier>{1, 3}), g.incoming(2));
+  CHECK_EQ((std::vector<g::VertexIdentifier>{2}), g.incoming(1));
+
+  REQUIRE_UNARY(g.removeVertex(2));
+  CHECK_FALSE(g.hasEdges());
+  CHECK_EQ(0, g.inDegree(1));
+  CHECK_UNARY(g.directlyReachables(3).empty());
+}
@@ -0,0 +1,88 @@
+#include <vector>
+
+#include <doctest.h>
+
+#include "small_adjacency_list.hpp"
+
+TEST_CASE("(SmallAdjacencyList, ShouldConstructEmptyList)")
+{
+  g::SmallAdjacencyList list{};
+
+  for (g::VertexIdentifier i{0}; i < 10; ++i) {
+    for (g::VertexIdentifier j{0}; j < 10; ++j) {
+      REQUIRE_FALSE(list.isDirectlyReachable(i, j));
+    }
+
+    REQUIRE_UNARY(list.directlyReachables(i).empty());
+  }
+
+  CHECK_EQ(0, list.slabSize());
+}
+
+TEST_CASE("(SmallAdjacencyList, ShouldKeepSmallRowsOutOfTheSlab)")
+{
+  g::SmallAdjacencyList list{};
+
+  for (g::VertexIdentifier v{0}; v < 100; ++v) {
+    for (g::VertexIdentifier w{1}; w <= 4; ++w) { list.addTo(v, v + w); }
+
+    list.addTo(v, v + 1);
+  }
+
+  CHECK_EQ(0, list.slabSize());
+  CHECK_EQ(
+    (std::vector<g::VertexIdentifier>{51, 52, 53, 54}),
+    list.directlyReachables(50));
+
+  list.removeAdjacentFrom(50, 52);
+  CHECK_EQ(
+    (std::vector<g::VertexIdentifier>{51, 53, 54}),
+    list.directlyReachables(50));
+}
+
+TEST_CASE("(SmallAdjacencyList, ShouldSpillLargeRowsIntoTheSlab)")
+{
+  g::SmallAdjacencyList list{};
+  std::vector<g::VertexIdentifier> expected{};
+
+  for (g::VertexIdentifier w{0}; w < 20; ++w) {
+    list.addTo(1, w);
+    list.addTo(2, w);
+    expected.push_back(w);
+  }
+
+  CHECK_EQ(expected, list.directlyReachables(1));
+  CHECK_EQ(20, list.neighbors(2).size());
+  CHECK_UNARY(list.isDirectlyReachable(2, 19));
+
+  const std::size_t slabSize{list.slabSize()};
+
+  // The blocks of a removed vertex are recycled by the next spilled row.
+  list.removeVertex(1);
+  CHECK_UNARY(list.directlyReachables(1).empty());
+  CHECK_FALSE(list.isDirectlyReachable(2, 1));
+
+  for (g::VertexIdentifier w{0}; w < 20; ++w) { list.addTo(3, w); }
+
+  CHECK_EQ(slabSize, list.slabSize());
+  CHECK_EQ(20, list.neighbors(3).size());
+}
+
+TEST_CASE("(SmallAdjacencyList, ShouldBeAbleToSwap)")
+{
+  g::SmallAdjacencyList list1{};
+  g::SmallAdjacencyList list2{};
+  list1.addTo(1, 2);
+
+  for (g::VertexIdentifier w{0}; w < 10; ++w) { list2.addTo(3, w); }
+
+  swap(list1, list2);
+
+  CHECK_UNARY(list1.isDirectlyReachable(3, 9));
+  CHECK_UNARY(list2.isDirectlyReachable(1, 2));
+  CHECK_EQ(0, list2.slabSize());
+
+  list1.clear();
+  CHECK_EQ(0, list1.slabSize());
+  CHECK_FALSE(list1.isDirectlyReachable(3, 9));
+}
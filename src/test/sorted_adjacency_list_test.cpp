@@ -0,0 +1,89 @@
+#include <cstddef>
+
+#include <vector>
+
+#include <doctest.h>
+
+#include "sorted_adjacency_list.hpp"
+
+TEST_CASE("(SortedAdjacencyList, ShouldConstructEmptyList)")
+{
+  g::SortedAdjacencyList list{};
+
+  for (g::VertexIdentifier i{0}; i < 10; ++i) {
+    for (g::VertexIdentifier j{0}; j < 10; ++j) {
+      REQUIRE_FALSE(list.isDirectlyReachable(i, j));
+    }
+
+    REQUIRE_UNARY(list.directlyReachables(i).empty());
+    REQUIRE_UNARY(list.neighbors(i).empty());
+  }
+}
+
+TEST_CASE("(SortedAdjacencyList, ShouldKeepTargetsSorted)")
+{
+  g::SortedAdjacencyList list{};
+  list.addTo(1, 7);
+  list.addTo(1, 3);
+  list.addTo(1, 5);
+  list.addTo(1, 3);
+  list.addAllTo(1, {9, 4, 5, 4, 0});
+
+  CHECK_EQ(
+    (std::vector<g::VertexIdentifier>{0, 3, 4, 5, 7, 9}),
+    list.directlyReachables(1));
+  CHECK_UNARY(list.isDirectlyReachable(1, 4));
+  CHECK_FALSE(list.isDirectlyReachable(1, 6));
+  CHECK_FALSE(list.isDirectlyReachable(4, 1));
+
+  list.removeAdjacentFrom(1, 5);
+  list.removeAdjacentFrom(1, 6);
+  list.removeAdjacentFrom(8, 1);
+  CHECK_EQ(5, list.neighbors(1).size());
+  CHECK_FALSE(list.isDirectlyReachable(1, 5));
+}
+
+TEST_CASE("(SortedAdjacencyList, ShouldRemoveAllEdgesOfAVertex)")
+{
+  g::SortedAdjacencyList list{};
+  list.addTo(1, 2);
+  list.addTo(2, 3);
+  list.addTo(2, 2);
+  list.addAllTo(4, {3, 2});
+
+  list.removeVertex(2);
+
+  CHECK_UNARY(list.directlyReachables(1).empty());
+  CHECK_UNARY(list.directlyReachables(2).empty());
+  CHECK_EQ((std::vector<g::VertexIdentifier>{3}), list.directlyReachables(4));
+
+  swap(list, list);
+  list.clear();
+  CHECK_UNARY(list.neighbors(4).empty());
+}
+
+TEST_CASE("(SortedAdjacencyList, ShouldIntersectNeighborhoods)")
+{
+  g::SortedAdjacencyList list{};
+  list.addAllTo(0, {1, 2, 4, 8, 16});
+  list.addAllTo(1, {2, 3, 4, 5, 16, 17});
+
+  CHECK_EQ(
+    (std::vector<g::VertexIdentifier>{2, 4, 16}),
+    g::intersect(list.neighbors(0), list.neighbors(1)));
+  CHECK_EQ(3, g::intersectionSize(list.neighbors(1), list.neighbors(0)));
+  CHECK_EQ(0, g::intersectionSize(list.neighbors(0), list.neighbors(2)));
+
+  // Lopsided enough to gallop.
+  std::vector<g::VertexIdentifier> large{};
+
+  for (g::VertexIdentifier v{0}; v < 3000; v += 3) { large.push_back(v); }
+
+  list.addAllTo(2, large);
+  list.addAllTo(3, {0, 1, 299, 300, 2997, 2998, 5000});
+
+  CHECK_EQ(
+    (std::vector<g::VertexIdentifier>{0, 300, 2997}),
+    g::intersect(list.neighbors(3), list.neighbors(2)));
+  CHECK_EQ(3, g::intersectionSize(list.neighbors(2), list.neighbors(3)));
+}
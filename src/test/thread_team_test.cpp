@@ -0,0 +1,34 @@
+#include <atomic>
+#include <vector>
+
+#include <doctest.h>
+
+#include "thread_team.hpp"
+
+TEST_CASE("(ThreadTeam, ShouldVisitEveryIndexExactlyOnce)")
+{
+  for (std::size_t threadCount{1}; threadCount <= 4; ++threadCount) {
+    g::ThreadTeam team{threadCount};
+    REQUIRE_EQ(threadCount, team.threadCount());
+
+    for (std::size_t count : {0, 1, 7, 1000}) {
+      std::vector<std::atomic<int>> visits(count);
+      team.parallelFor(
+        count,
+        [&visits, threadCount](
+          std::size_t begin, std::size_t end, std::size_t thread) {
+          REQUIRE_UNARY(thread < threadCount);
+
+          for (std::size_t i{begin}; i < end; ++i) { ++visits[i]; }
+        });
+
+      for (const std::atomic<int>& visit : visits) { REQUIRE_EQ(1, visit); }
+    }
+  }
+}
+
+TEST_CASE("(ThreadTeam, ShouldTreatZeroThreadsAsOne)")
+{
+  g::ThreadTeam team{0};
+  CHECK_EQ(1, team.threadCount());
+}
@@ -0,0 +1,85 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+#include <vector>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "graph.hpp"
+#include "graph_exception.hpp"
+#include "vertex_interner.hpp"
+
+TEST_CASE("(VertexInterner, ShouldHandOutDenseIdentifiers)")
+{
+  g::VertexInterner<std::uint64_t> interner{};
+
+  CHECK_EQ(0, interner.intern(1'000'000'000'000ULL));
+  CHECK_EQ(1, interner.intern(7));
+  CHECK_EQ(0, interner.intern(1'000'000'000'000ULL));
+  CHECK_EQ(2, interner.intern(UINT64_MAX));
+  CHECK_EQ(3, interner.size());
+
+  CHECK_UNARY(interner.contains(7));
+  CHECK_UNARY_FALSE(interner.contains(8));
+  CHECK_EQ(1, interner.find(7).value());
+  CHECK_UNARY_FALSE(interner.find(8).has_value());
+  CHECK_EQ(2, interner.identifierOf(UINT64_MAX));
+  CHECK_EQ(7, interner.keyOf(1));
+  CHECK_THROWS_AS((void)interner.identifierOf(8), g::GraphException);
+  CHECK_THROWS_AS((void)interner.keyOf(3), g::GraphException);
+
+  interner.clear();
+  CHECK_EQ(0, interner.size());
+  CHECK_EQ(0, interner.intern(7));
+}
+
+TEST_CASE("(VertexInterner, ShouldSizeGraphsByTheVertexCount)")
+{
+  g::Graph<
+    g::Directionality::Undirected,
+    g::AdjacencyList,
+    std::nullptr_t,
+    std::int64_t>
+                                 graph{};
+  g::VertexInterner<std::string> cities{};
+
+  for (const char* name : {"Arad", "Zerind", "Oradea"}) {
+    REQUIRE_UNARY(graph.addVertex(cities.intern(name), nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(
+    cities.identifierOf("Arad"), cities.identifierOf("Zerind"), 75));
+  REQUIRE_UNARY(graph.addEdge(
+    cities.identifierOf("Zerind"), cities.identifierOf("Oradea"), 71));
+
+  CHECK_EQ(3, graph.vertexCount());
+  CHECK_EQ(
+    75,
+    graph.fetchEdgeData(
+      cities.identifierOf("Zerind"), cities.identifierOf("Arad"))
+      .value());
+
+  const std::vector<g::VertexIdentifier> neighbors{
+    graph.m_implementation.directlyReachables(cities.identifierOf("Zerind"))};
+  REQUIRE_EQ(2, neighbors.size());
+  CHECK_EQ("Arad", cities.keyOf(neighbors[0]));
+  CHECK_EQ("Oradea", cities.keyOf(neighbors[1]));
+}
+
+TEST_CASE("(VertexInterner, ShouldBeAbleToSwap)")
+{
+  g::VertexInterner<std::string> a{};
+  g::VertexInterner<std::string> b{};
+  (void)a.intern("x");
+  (void)a.intern("y");
+  (void)b.intern("z");
+
+  swap(a, b);
+
+  CHECK_EQ(1, a.size());
+  CHECK_EQ("z", a.keyOf(0));
+  CHECK_EQ(2, b.size());
+  CHECK_EQ(1, b.identifierOf("y"));
+}
@@ -0,0 +1,136 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <doctest.h>
+
+#include "algo/a_star/algorithm.hpp"
+#include "algo/dijkstra/algorithm.hpp"
+#include "graph.hpp"
+#include "romania/create_graph.hpp"
+#include "romania/heuristic.hpp"
+#include "weighted_adjacency_list.hpp"
+
+TEST_CASE("(WeightedAdjacencyList, ShouldStoreEdgeDataNextToTheTargets)")
+{
+  g::WeightedAdjacencyList<std::string> list{};
+  list.addTo(1, 2, "a");
+  list.addTo(1, 0, "b");
+  list.addTo(1, 2, "c");
+  list.addTo(3, 1);
+
+  CHECK_EQ(3, list.arcCount());
+  CHECK_EQ(std::string{"c"}, *list.edgeData(1, 2));
+  CHECK_EQ(std::string{}, *list.edgeData(3, 1));
+  CHECK_EQ(nullptr, list.edgeData(2, 1));
+  CHECK_EQ(nullptr, list.edgeData(9, 9));
+  CHECK_EQ(
+    (std::vector<g::VertexIdentifier>{2, 0}), list.directlyReachables(1));
+  REQUIRE_EQ(2, list.edgeDataRow(1).size());
+  CHECK_EQ(std::string{"b"}, list.edgeDataRow(1)[1]);
+  CHECK_UNARY(list.targetRow(9).empty());
+
+  std::vector<std::pair<g::VertexIdentifier, std::string>> edges{};
+  list.forEachOutEdge(
+    1, [&edges](g::VertexIdentifier target, const std::string& data) {
+      edges.emplace_back(target, data);
+    });
+  CHECK_EQ(
+    (std::vector<std::pair<g::VertexIdentifier, std::string>>{
+      {2, "c"}, {0, "b"}}),
+    edges);
+
+  list.removeAdjacentFrom(1, 2);
+  list.removeAdjacentFrom(1, 2);
+  CHECK_EQ(2, list.arcCount());
+  CHECK_FALSE(list.isDirectlyReachable(1, 2));
+  CHECK_EQ(std::string{"b"}, *list.edgeData(1, 0));
+
+  list.removeVertex(1);
+  CHECK_EQ(0, list.arcCount());
+  CHECK_UNARY(list.directlyReachables(3).empty());
+
+  g::WeightedAdjacencyList<std::string> other{};
+  other.addTo(0, 0, "loop");
+  swap(list, other);
+  CHECK_EQ(1, list.arcCount());
+  CHECK_EQ(0, other.arcCount());
+
+  list.clear();
+  CHECK_FALSE(list.isDirectlyReachable(0, 0));
+}
+
+TEST_CASE("graph should keep edge data in a WeightedAdjacencyList")
+{
+  g::Graph<
+    g::Directionality::Undirected,
+    g::WeightedAdjacencyList<int>,
+    std::nullptr_t,
+    int>
+    graph{};
+
+  for (g::VertexIdentifier v{0}; v < 4; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(0, 1, 10));
+  REQUIRE_UNARY(graph.addEdge(1, 2, 20));
+  REQUIRE_UNARY(graph.addEdge(3, 1, 30));
+  REQUIRE_UNARY(graph.addEdge(2, 2, 22));
+  CHECK_UNARY_FALSE(graph.addEdge(1, 0, 40));
+  CHECK_UNARY_FALSE(graph.addEdge(0, 7, 40));
+
+  CHECK_UNARY(graph.m_edgeMap.empty());
+  CHECK_EQ(4, graph.edgeCount());
+  CHECK_EQ(4, graph.edges().size());
+  CHECK_EQ(7, graph.edgesUndirectedWithReverseEdges().size());
+  CHECK_EQ(10, graph.fetchEdgeData(1, 0).value());
+  CHECK_UNARY(graph.hasEdge(1, 3));
+  CHECK_UNARY_FALSE(graph.fetchEdgeData(0, 2).has_value());
+
+  int sum{0};
+  graph.forEachOutEdge(1, [&sum](g::VertexIdentifier, int data) {
+    sum += data;
+  });
+  CHECK_EQ(60, sum);
+
+  const std::vector<std::pair<g::VertexIdentifier, int>> batch{
+    {0, 5}, {2, 2}, {1, 1}};
+  CHECK_EQ(1, graph.addEdges(2, batch));
+  CHECK_EQ(5, graph.fetchEdgeData(0, 2).value());
+  CHECK_UNARY(graph.removeEdge(0, 2));
+
+  CHECK_UNARY(graph.removeEdge(2, 1));
+  CHECK_UNARY_FALSE(graph.removeEdge(1, 2));
+  CHECK_UNARY(graph.removeVertex(2));
+  CHECK_UNARY(graph.removeVertex(1));
+  CHECK_UNARY_FALSE(graph.hasEdges());
+}
+
+TEST_CASE("dijkstra and A* should work with a WeightedAdjacencyList")
+{
+  using Implementation = g::WeightedAdjacencyList<std::int64_t>;
+
+  const g::romania::graph_type<Implementation> romaniaGraph{
+    g::romania::createGraph<Implementation>()};
+
+  const g::algo::ShortestPaths result{
+    g::algo::dijkstra::algorithm(romaniaGraph, g::romania::City::Arad)};
+
+  CHECK_EQ(418, result.distanceTo(g::romania::City::Bucharest));
+  CHECK_EQ(824, result.distanceTo(g::romania::City::Neamt));
+
+  const g::algo::a_star::Path path{g::algo::a_star::algorithm(
+    romaniaGraph,
+    {g::romania::City::Arad},
+    [](g::VertexIdentifier city) {
+      return city == g::romania::City::Bucharest;
+    },
+    &g::romania::heuristic,
+    /* useClosedList */ true)};
+
+  CHECK_EQ(418, path.g());
+}
@@ -0,0 +1,156 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <doctest.h>
+
+#include "adjacency_list.hpp"
+#include "algo/dijkstra/algorithm.hpp"
+#include "graph.hpp"
+#include "romania/create_graph.hpp"
+#include "weighted_adjacency_matrix.hpp"
+
+TEST_CASE("(WeightedAdjacencyMatrix, ShouldStoreEdgeData)")
+{
+  g::WeightedAdjacencyMatrix<std::string> matrix{};
+  matrix.addTo(1, 2, "a");
+  matrix.addTo(2, 1, "b");
+  matrix.addTo(1, 2, "c");
+  matrix.addTo(0, 3);
+
+  CHECK_EQ(3, matrix.arcCount());
+  CHECK_EQ(4, matrix.dimension());
+  CHECK_EQ(std::string{"c"}, *matrix.edgeData(1, 2));
+  CHECK_EQ(std::string{}, *matrix.edgeData(0, 3));
+  CHECK_EQ(nullptr, matrix.edgeData(3, 0));
+  CHECK_EQ(nullptr, matrix.edgeData(9, 9));
+  CHECK_EQ((std::vector<g::VertexIdentifier>{2}), matrix.directlyReachables(1));
+
+  matrix.removeAdjacentFrom(1, 2);
+  matrix.removeAdjacentFrom(1, 2);
+  CHECK_EQ(2, matrix.arcCount());
+  CHECK_FALSE(matrix.isDirectlyReachable(1, 2));
+  CHECK_EQ(std::string{}, matrix.edgeDataRow(1)[2]);
+}
+
+TEST_CASE("(WeightedAdjacencyMatrix, ShouldKeepEdgeDataWhenGrowing)")
+{
+  g::WeightedAdjacencyMatrix<std::int64_t> matrix{};
+
+  for (std::int64_t i{1}; i < 200; ++i) {
+    const auto v{static_cast<g::VertexIdentifier>(i)};
+    matrix.addTo(v - 1, v, i);
+    matrix.addTo(v, 0, -i);
+  }
+
+  for (std::int64_t i{1}; i < 200; ++i) {
+    const auto v{static_cast<g::VertexIdentifier>(i)};
+    REQUIRE_EQ(i, *matrix.edgeData(v - 1, v));
+    REQUIRE_EQ(-i, *matrix.edgeData(v, 0));
+  }
+
+  std::vector<std::pair<g::VertexIdentifier, std::int64_t>> edges{};
+  matrix.forEachOutEdge(
+    5, [&edges](g::VertexIdentifier target, std::int64_t data) {
+      edges.emplace_back(target, data);
+    });
+  CHECK_EQ(
+    (std::vector<std::pair<g::VertexIdentifier, std::int64_t>>{
+      {0, -5}, {6, 6}}),
+    edges);
+
+  matrix.removeVertex(0);
+  CHECK_EQ(198, matrix.arcCount());
+
+  g::WeightedAdjacencyMatrix<std::int64_t> other{};
+  swap(matrix, other);
+  CHECK_EQ(0, matrix.arcCount());
+  CHECK_EQ(7, *other.edgeData(6, 7));
+
+  other.clear();
+  CHECK_EQ(0, other.dimension());
+}
+
+TEST_CASE("graph should keep edge data in a WeightedAdjacencyMatrix")
+{
+  g::Graph<
+    g::Directionality::Undirected,
+    g::WeightedAdjacencyMatrix<int>,
+    std::nullptr_t,
+    int>
+    graph{};
+
+  for (g::VertexIdentifier v{0}; v < 4; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(0, 1, 10));
+  REQUIRE_UNARY(graph.addEdge(1, 2, 20));
+  REQUIRE_UNARY(graph.addEdge(3, 1, 30));
+  CHECK_UNARY_FALSE(graph.addEdge(1, 0, 40));
+  CHECK_UNARY_FALSE(graph.addEdge(0, 7, 40));
+
+  CHECK_UNARY(graph.m_edgeMap.empty());
+  CHECK_EQ(3, graph.edgeCount());
+  CHECK_EQ(3, graph.edges().size());
+  CHECK_EQ(10, graph.fetchEdgeData(1, 0).value());
+  CHECK_UNARY(graph.hasEdge(1, 3));
+  CHECK_UNARY_FALSE(graph.fetchEdgeData(0, 2).has_value());
+
+  int sum{0};
+  graph.forEachOutEdge(1, [&sum](g::VertexIdentifier, int data) {
+    sum += data;
+  });
+  CHECK_EQ(60, sum);
+
+  REQUIRE_UNARY(graph.addEdge(2, 2, 22));
+  CHECK_EQ(4, graph.edgeCount());
+  CHECK_EQ(4, graph.edges().size());
+  CHECK_UNARY(graph.removeEdge(2, 2));
+
+  CHECK_UNARY(graph.removeEdge(2, 1));
+  CHECK_UNARY_FALSE(graph.removeEdge(1, 2));
+  CHECK_UNARY(graph.removeVertex(1));
+  CHECK_UNARY_FALSE(graph.hasEdges());
+}
+
+TEST_CASE("graph should visit the out edges of an edge map graph")
+{
+  g::Graph<
+    g::Directionality::Directed,
+    g::AdjacencyList,
+    std::nullptr_t,
+    int>
+    graph{};
+
+  for (g::VertexIdentifier v{0}; v < 3; ++v) {
+    REQUIRE_UNARY(graph.addVertex(v, nullptr));
+  }
+
+  REQUIRE_UNARY(graph.addEdge(0, 1, 5));
+  REQUIRE_UNARY(graph.addEdge(0, 2, 7));
+  REQUIRE_UNARY(graph.addEdge(2, 0, 100));
+
+  int sum{0};
+  graph.forEachOutEdge(0, [&sum](g::VertexIdentifier, int data) {
+    sum += data;
+  });
+  CHECK_EQ(12, sum);
+}
+
+TEST_CASE("dijkstra should work with a WeightedAdjacencyMatrix")
+{
+  using Implementation = g::WeightedAdjacencyMatrix<std::int64_t>;
+
+  const g::romania::graph_type<Implementation> romaniaGraph{
+    g::romania::createGraph<Implementation>()};
+
+  const g::algo::ShortestPaths result{
+    g::algo::dijkstra::algorithm(romaniaGraph, g::romania::City::Arad)};
+
+  CHECK_EQ(418, result.distanceTo(g::romania::City::Bucharest));
+  CHECK_EQ(824, result.distanceTo(g::romania::City::Neamt));
+}
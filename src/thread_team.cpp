@@ -0,0 +1,82 @@
+#include <algorithm>
+
+#include "thread_team.hpp"
+
+namespace g {
+ThreadTeam::ThreadTeam(std::size_t threadCount)
+  : m_threadCount{std::max<std::size_t>(threadCount, 1)}
+  , m_start{static_cast<std::ptrdiff_t>(m_threadCount)}
+  , m_finish{static_cast<std::ptrdiff_t>(m_threadCount)}
+  , m_body{nullptr}
+  , m_count{0}
+  , m_grain{1}
+  , m_next{0}
+  , m_stop{false}
+  , m_threads{}
+{
+  m_threads.reserve(m_threadCount - 1);
+
+  for (std::size_t thread{1}; thread < m_threadCount; ++thread) {
+    m_threads.emplace_back([this, thread] { work(thread); });
+  }
+}
+
+ThreadTeam::~ThreadTeam()
+{
+  m_stop = true;
+
+  if (!m_threads.empty()) { m_start.arrive_and_wait(); }
+
+  for (std::thread& thread : m_threads) { thread.join(); }
+}
+
+std::size_t ThreadTeam::threadCount() const { return m_threadCount; }
+
+void ThreadTeam::parallelFor(std::size_t count, const body_type& body)
+{
+  if (count == 0) { return; }
+
+  if (m_threads.empty()) {
+    body(0, count, 0);
+    return;
+  }
+
+  m_body  = &body;
+  m_count = count;
+  m_grain = std::max<std::size_t>(1, count / (8 * m_threadCount));
+  m_next.store(0, std::memory_order_relaxed);
+
+  m_start.arrive_and_wait();
+  runChunks(0);
+  m_finish.arrive_and_wait();
+}
+
+void ThreadTeam::work(std::size_t thread)
+{
+  for (;;) {
+    m_start.arrive_and_wait();
+
+    if (m_stop) { return; }
+
+    runChunks(thread);
+    m_finish.arrive_and_wait();
+  }
+}
+
+void ThreadTeam::runChunks(std::size_t thread)
+{
+  for (;;) {
+    const std::size_t begin{
+      m_next.fetch_add(m_grain, std::memory_order_relaxed)};
+
+    if (begin >= m_count) { return; }
+
+    (*m_body)(begin, std::min(begin + m_grain, m_count), thread);
+  }
+}
+
+std::size_t defaultThreadCount()
+{
+  return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+} // namespace g